@@ -1,47 +1,138 @@
 #include <pebble.h>
+#include "glyph_atlas.auto.h"
+#include "numeral_tables.auto.h"
+#include "lunar_table.auto.h"
 
 // ==================== 常數定義 ====================
 
 // 動畫參數
 #define ANIMATION_DURATION_MS 300
 #define ANIMATION_OFFSET_Y 5
+// 韌體動畫約 30 fps，一次換圖動畫約 ANIMATION_FRAMES 次更新回呼（用於估算省電策略省下的重繪）
+#define ANIMATION_FRAME_MS 33
+#define ANIMATION_FRAMES ((ANIMATION_DURATION_MS + ANIMATION_FRAME_MS - 1) / ANIMATION_FRAME_MS)
+// 批次動畫兩次換圖之間以此延遲重新排程待命（見「動畫系統」一節）
+#define ANIMATION_PARK_MS (24u * 60 * 60 * 1000)
+// 換圖動畫的影格率上限（見「動畫系統」一節）：距上一影格不足 ANIMATION_FRAME_INTERVAL_MS 的更新回呼不重繪。
+// Aplite 的 CPU 較慢且每影格須打包寫回黑白畫面，上限較低
+#if defined(PBL_PLATFORM_APLITE)
+    #define ANIMATION_FPS_CAP 15
+#else
+    #define ANIMATION_FPS_CAP 30
+#endif
+#define ANIMATION_FRAME_INTERVAL_MS MAX(ANIMATION_FRAME_MS, 1000 / ANIMATION_FPS_CAP)
+// 緩動表的分段數：ANIMATION_EASE_IN[i] 為進度 i / ANIMATION_EASE_STEPS 時的位移比例（Q10 定點）
+#define ANIMATION_EASE_STEPS 16
+#define ANIMATION_EASE_SHIFT 10
+
+// 省電策略：電量不高於此百分比且未充電時改為靜態更新（0 表示不依電量降級）
+#define POWER_SAVE_BATTERY_DEFAULT 20
+// 勿擾模式查詢僅 Basalt 以後的韌體提供
+#if !defined(PBL_PLATFORM_APLITE)
+    #define POWER_HAS_QUIET_TIME
+#endif
+
+// 設定儲存格式版本：欄位語意改變時遞增；只在結尾附加欄位不需遞增
+#define SETTINGS_VERSION 1
+#define SETTINGS_FLAG_IS_DARK           (1 << 0)
+#define SETTINGS_FLAG_BW_HOUR_ACCENT    (1 << 1)
+#define SETTINGS_FLAG_ANIMATION         (1 << 2)
+#define SETTINGS_FLAG_QUIET_TIME_STATIC (1 << 3)
+#define SETTINGS_FLAG_LUNAR_DATE        (1 << 4)
+#define SETTINGS_FLAG_SECONDS           (1 << 5)
+
+// 秒數指示：開啟時改以 SECOND_UNIT 訂閱 tick，只重畫日期列下方的細長進度條（見「秒數指示」一節）；
+// 開始顯示後 timeout 秒或偵測到手腕放下即自動關閉，甩動手腕再次開始
+#define SECONDS_BAR_HEIGHT 2
+#define SECONDS_TIMEOUT_DEFAULT_S 30
+// 手腕放下：錶面朝上的重力分量 z（mG，錶面朝上平放約 -1000）連續 SECONDS_WRIST_DOWN_S 秒高於此值
+#define SECONDS_WRIST_DOWN_Z (-300)
+#define SECONDS_WRIST_DOWN_S 2
+
+// 效能計數器：建置時定義 PERF_COUNTERS 才編入（見「效能計數器」一節），
+// 顯示除錯覆蓋層並每小時經 AppMessage 將統計送至手機，一般建置完全不含這些程式碼
+#if defined(PERF_COUNTERS)
+    #define PERF_OVERLAY_HEIGHT 32
+#endif
+
+// 字形來源：整張圖集解碼後約 31 KB（Emery 約 54 KB），Aplite 約 24 KB 的堆積放不下，
+// 因此 Aplite 維持逐張資源載入並以點陣圖快取緩衝，其餘平台改用圖集。
+// CCWATCHFACE_RLE=1 pebble build 定義 USE_RLE_GLYPHS：四個平台都改為字形串流（見「字形串流」一節），
+// 字形以 RLE 存於單一 raw 資源，繪製時分段讀取並直接解碼寫入畫面，不載入圖集也不配置快取槽位
+#if defined(USE_RLE_GLYPHS)
+#elif !defined(PBL_PLATFORM_APLITE)
+    #define USE_GLYPH_ATLAS
+#else
+    #define USE_GLYPH_CACHE
+#endif
+
+// 繪製方式：預設由單一畫布圖層依格子表繪製所有字形，只重畫有變動的格子；
+// 建置時定義 USE_BITMAP_LAYERS 則改回每個格子一個 BitmapLayer
+#if !defined(USE_BITMAP_LAYERS)
+    #define USE_CANVAS_RENDERER
+#endif
+
+// 畫布的字形繪製：預設擷取畫面緩衝區，以專用核心直接寫入（見「畫面直寫」一節）；
+// 建置時定義 USE_GRAPHICS_BLIT 則改用 graphics_draw_bitmap_in_rect
+#if defined(USE_CANVAS_RENDERER) && !defined(USE_GRAPHICS_BLIT)
+    #define USE_FRAMEBUFFER_BLITTER
+#endif
+#if defined(USE_RLE_GLYPHS) && !defined(USE_FRAMEBUFFER_BLITTER)
+    #error "RLE glyphs are decoded by the framebuffer blitter"
+#endif
+
+// 日期列：一天至多變動一次，BitmapLayer 模式下 8 格改由一個圖層直接自字形的儲存空間合成繪製
+// （見「日期列合成」一節）；畫布模式本來就只重畫有變動的格子，不需要合成
+#if !defined(USE_CANVAS_RENDERER)
+    #define USE_DATE_ROW_COMPOSITOR
+#endif
+
+// 字形放大：圖集只存底稿尺寸的字形（GLYPH_*_SCALE 由 tools/build_atlas.py 依平台產生），
+// 繪製時以最近鄰整數倍放大到格子尺寸（見「字形放大」一節）；Emery 的日期字形即沿用 11x11 的底稿
+#if GLYPH_TIME_SCALE > 1 || GLYPH_DATE_SCALE > 1
+    #define USE_GLYPH_SCALING
+#endif
+#if defined(USE_GLYPH_SCALING) && defined(USE_FRAMEBUFFER_BLITTER) && !defined(PBL_COLOR)
+    #error "The 1-bit framebuffer blitter does not scale glyphs"
+#endif
+#if GLYPH_TIME_SCALE > 1 && defined(USE_BITMAP_LAYERS)
+    #error "Scaled time glyphs need the canvas renderer"
+#endif
+
+// 版面重排：Timeline Quick View 等由下方遮蔽錶盤時，依版面表移動或隱藏格子（見「版面重排」一節）；
+// Aplite 韌體沒有未遮蔽區域服務
+#if !defined(PBL_PLATFORM_APLITE)
+    #define USE_UNOBSTRUCTED_AREA
+#endif
 
-// 特殊資源 ID 標記
-#define RESOURCE_ID_NONE 0
+#if defined(USE_GLYPH_ATLAS)
+    #define GLYPH_ATLAS_PALETTE_MAX 16
+#elif defined(USE_RLE_GLYPHS)
+    // 串流的像素值即語意色插槽索引（透明、Black、White、Red）
+    #define GLYPH_PALETTE_SIZE 4
+    // 每次以 resource_load_byte_range 讀入堆疊上的位元組數
+    #define GLYPH_RLE_CHUNK 64
+#else
+    // 點陣圖快取的固定槽位（依字形類別）：每個格子一個槽位（時 2、分 2、日期列 8），
+    // 另加一個分鐘的備用槽供每分鐘的預取使用。換字時先歸還舊槽位再借用，顯示中的格子不需更多槽位；
+    // 時與日期變動的頻率低，沒有備用槽，於交界時照常載入
+    #define GLYPH_CACHE_HOUR_SLOTS 2
+    #define GLYPH_CACHE_MINUTE_SLOTS 3
+    #define GLYPH_CACHE_DATE_SLOTS 8
+    #define GLYPH_CACHE_SLOTS (GLYPH_CACHE_HOUR_SLOTS + GLYPH_CACHE_MINUTE_SLOTS + GLYPH_CACHE_DATE_SLOTS)
+    // 字形為 1/2-bit 原始像素資料，調色盤依語意色插槽排列
+    #define GLYPH_PALETTE_SIZE 4
+    // 字形預取：於分鐘交界前幾秒先將下一分鐘的字形載入快取
+    #define GLYPH_PREFETCH_LEAD_S 5
+#endif
 
-// 平台相關佈局
+// 字形格子尺寸；各格子的位置見版面表 CELL_LAYOUT
 #if defined(PBL_PLATFORM_EMERY)
     #define TIME_IMAGE_SIZE GSize(88, 88)
     #define DATE_IMAGE_SIZE GSize(22, 22)
-    #define TIME_COL1_X 8
-    #define TIME_COL2_X 104
-    #define TIME_ROW1_Y 8
-    #define TIME_ROW2_Y 104
-    #define DATE_ROW_Y 199
-    #define DATE_MONTH1_X 8
-    #define DATE_MONTH2_X 31
-    #define DATE_YUE_X 54
-    #define DATE_DAY1_X 77
-    #define DATE_DAY2_X 100
-    #define DATE_RI_X 123
-    #define DATE_ZHOU_X 146
-    #define DATE_WEEK_X 169
 #else
     #define TIME_IMAGE_SIZE GSize(66, 66)
     #define DATE_IMAGE_SIZE GSize(11, 11)
-    #define TIME_COL1_X 4
-    #define TIME_COL2_X 74
-    #define TIME_ROW1_Y 4
-    #define TIME_ROW2_Y 74
-    #define DATE_ROW_Y 149
-    #define DATE_MONTH1_X 4
-    #define DATE_MONTH2_X 16
-    #define DATE_YUE_X 28
-    #define DATE_DAY1_X 50
-    #define DATE_DAY2_X 62
-    #define DATE_RI_X 74
-    #define DATE_ZHOU_X 117
-    #define DATE_WEEK_X 129
 #endif
 
 // ==================== 列舉與類型定義 ====================
@@ -55,7 +146,21 @@ typedef enum {
     KEY_BACKGROUND_COLOR = 4,
     KEY_TEXT_COLOR = 5,
     KEY_BW_HOUR_ACCENT = 6,
-
+    KEY_POWER_SAVE_BATTERY = 7,
+    KEY_POWER_SAVE_QUIET_TIME = 8,
+    KEY_LUNAR_DATE = 9,
+    KEY_SECONDS_INDICATOR = 10,
+    KEY_SECONDS_TIMEOUT = 11,
+    // 設定差異同步（見 handle_settings_update）；錶盤以 KEY_SETTINGS_VERSION 回傳目前持有的版本
+    KEY_SETTINGS_VERSION = 12,
+    KEY_SETTINGS_BASE = 13,
+    // 效能計數器匯出（錶盤 → 手機）：KEY_PERF_FIRST + PerfField
+    KEY_PERF_FIRST = 20,
+
+    // 以下僅供本機儲存，不經由 AppMessage 傳送
+    KEY_POWER_FRAMES_SAVED = 100,
+    KEY_SETTINGS = 101,
+    KEY_GLYPH_SNAPSHOT = 102,
 } SettingKey;
 
 // 圖層類型（用於主題應用）
@@ -65,8 +170,22 @@ typedef enum {
     LAYER_TYPE_MINUTE_NORMAL,
     LAYER_TYPE_DATE,
     LAYER_TYPE_STATIC,
+    LAYER_TYPE_COUNT,
 } LayerType;
 
+// 版面錨點：錶盤下方被遮蔽時，LAYOUT_ANCHOR_BOTTOM 的格子隨可見區域底部上移，LAYOUT_ANCHOR_TOP 的格子不動
+typedef enum {
+    LAYOUT_ANCHOR_TOP,
+    LAYOUT_ANCHOR_BOTTOM,
+} LayoutAnchor;
+
+// 版面表的一格：尺寸由類型決定（時間字形或日期字形）
+typedef struct {
+    LayerType type;
+    LayoutAnchor anchor;
+    GPoint origin;            // 未遮蔽時的左上角
+} CellLayout;
+
 // 動畫狀態
 typedef enum {
     ANIM_STATE_IDLE,
@@ -74,13 +193,36 @@ typedef enum {
     ANIM_STATE_FADE_IN,
 } AnimationState;
 
-// 顯示圖層結構
+// 格子顯示的字形：圖集與快取為點陣圖；字形串流為字形編號，繪製時才自資源解碼
+#if defined(USE_RLE_GLYPHS)
+typedef GlyphId GlyphImage;
+#define GLYPH_IMAGE_NONE GLYPH_NONE
+#else
+typedef const GBitmap *GlyphImage;
+#define GLYPH_IMAGE_NONE NULL
+#endif
+
+// 顯示圖層結構：時間與日期的一個格子
 typedef struct {
-    BitmapLayer *layer;
+#if defined(USE_CANVAS_RENDERER)
+    GRect frame;              // 目前位置，動畫期間偏離 base_frame
+    GRect drawn;              // 上次實際畫在畫面上的範圍，重畫前以背景色清除
+    GlyphImage shown;         // 格子中顯示的字形（離場動畫期間仍是舊字形）
+#else
+    BitmapLayer *layer;       // 日期列的格子為 NULL，改由日期列圖層繪製；圖層的 frame 只含墨跡範圍
+    GRect frame;              // 目前位置，意義同畫布模式
+#if defined(USE_DATE_ROW_COMPOSITOR)
+    const GBitmap *shown;     // 僅日期列的格子使用，意義同畫布模式
+#endif
+#endif
+    GRect ink;                // 顯示中字形的墨跡範圍，相對於 frame 左上角（見「墨跡裁切」一節）
+#if !defined(USE_RLE_GLYPHS)
     GBitmap *bitmap;
-    uint32_t current_resource_id;
-    PropertyAnimation *animation;
+#endif
+    GlyphId current_glyph;
     AnimationState anim_state;
+    uint8_t cell;             // 於 ALL_DISPLAY_LAYERS 中的索引
+    bool hidden;              // 版面重排時放不下而隱藏；字形照常更新，點陣圖不釋放
     GRect base_frame;
     LayerType type;
 } DisplayLayer;
@@ -96,11 +238,243 @@ typedef struct {
     bool bw_hour_accent;
 } ThemeConfig;
 
+#if defined(USE_GLYPH_ATLAS)
+// 字形圖集：atlas 的調色盤保留原始語意色，palettes 為各 LayerType 套用主題後的版本
+typedef struct {
+    GBitmap *bitmap;
+    int palette_size;
+    GColor palettes[LAYER_TYPE_COUNT][GLYPH_ATLAS_PALETTE_MAX];
+} GlyphAtlas;
+#elif defined(USE_RLE_GLYPHS)
+// 字形串流：handle 為 GLYPH_RLE 資源，palettes 為各 LayerType 套用主題後的語意色插槽
+typedef struct {
+    ResHandle handle;
+    GColor palettes[LAYER_TYPE_COUNT][GLYPH_PALETTE_SIZE];
+} GlyphStream;
+#else
+// 快取槽位類別：同類字形尺寸與位元深度相同，可互相重用槽位
+typedef enum {
+    GLYPH_SLOT_HOUR,
+    GLYPH_SLOT_MINUTE,
+    GLYPH_SLOT_DATE,
+    GLYPH_SLOT_CLASS_COUNT
+} GlyphSlotClass;
+
+// 點陣圖快取槽位：bitmap 於視窗載入時配置並常駐，resource_id 為 0 表示空槽；
+// 以 (resource_id, type) 為鍵，refs > 0 表示有圖層正在借用
+typedef struct {
+    GBitmap *bitmap;
+    uint32_t resource_id;
+    uint32_t last_used;
+    uint16_t bytes;
+    uint8_t refs;
+    uint8_t slot_class;  // GlyphSlotClass，決定點陣圖尺寸與格式
+    bool prefetched;     // 由預取載入且尚未被借用
+    LayerType type;
+} GlyphCacheEntry;
+
+// 快取命中統計
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t bytes_used;         // 存放字形的槽位位元組數
+    uint32_t prefetch_loads;     // 預取時實際自資源載入的次數（不計入 misses）
+    uint32_t prefetch_hits;      // 借用到預取載入的項目
+    uint32_t prefetch_wasted;    // 預取載入的項目在借用前即被淘汰
+} GlyphCacheStats;
+
+// palettes 為各 LayerType 套用主題後的調色盤，槽位中的點陣圖以 gbitmap_set_palette 共用
+typedef struct {
+    GlyphCacheEntry entries[GLYPH_CACHE_SLOTS];
+    uint32_t clock;
+    GlyphCacheStats stats;
+    GColor palettes[LAYER_TYPE_COUNT][GLYPH_PALETTE_SIZE];
+} GlyphCache;
+#endif
+
+#if defined(USE_FRAMEBUFFER_BLITTER) && defined(PBL_COLOR) && !defined(USE_RLE_GLYPHS)
+// 2-bit 字形的查表：以一個來源位元組（4 像素）為索引，colors 為套用主題後的 4 個畫面像素
+// （位元組 k 為第 k 個像素），masks 的位元 k 表示該像素不透明
+typedef struct {
+    uint32_t key;                 // 建表時調色盤前 4 色的 argb，內容相同即可沿用
+    bool valid;
+    uint8_t masks[256];
+    uint32_t colors[256];
+} BlitLut;
+#endif
+
+#if defined(USE_CANVAS_RENDERER)
+// 畫布：dirty_cells 的位元 i 對應 ALL_DISPLAY_LAYERS[i]
+typedef struct {
+    Layer *layer;
+    uint16_t dirty_cells;
+    bool full_redraw;
+#if defined(USE_FRAMEBUFFER_BLITTER) && defined(PBL_COLOR) && !defined(USE_RLE_GLYPHS)
+    BlitLut luts[LAYER_TYPE_COUNT];   // 同一 LayerType 的格子共用調色盤
+#endif
+#if defined(USE_GLYPH_SCALING) && !defined(USE_RLE_GLYPHS)
+    GBitmap *scratch;                 // 放大後的字形，交給 graphics_draw_bitmap_in_rect 繪製
+#endif
+} Canvas;
+#endif
+
+#if !defined(USE_CANVAS_RENDERER)
+// 格子群組：所有格子圖層的父圖層；dirty 表示已標記重繪、尚未畫出
+typedef struct {
+    Layer *layer;
+    bool dirty;
+} CellGroup;
+#endif
+
+#if defined(USE_DATE_ROW_COMPOSITOR)
+// 日期列：一個圖層畫出 8 個格子的字形
+typedef struct {
+    Layer *layer;
+#if defined(USE_GLYPH_SCALING)
+    GBitmap *scratch;         // 放大後的日期字形，見 glyph_draw_scaled
+#endif
+} DateRow;
+#endif
+
+// 換圖批次：cells 的位元 i 對應 ALL_DISPLAY_LAYERS[i]
+typedef struct {
+    Animation *animation;     // 第一次換圖時建立，之後每批重複使用
+    bool restarting;          // 已取消待命，stopped 回呼應立即重新排程播放
+    uint16_t cells;
+    int16_t offset_y;         // 批次內格子目前相對 base_frame 的位移
+    bool started;             // 已開始播放；之後的換字請求不再加入，而是先將本批收尾
+    bool swapped;             // 已於中點換上新字形
+    uint16_t next_frame_ms;   // 下一影格最早的播放時間（自動畫開始起算，見 ANIMATION_FRAME_INTERVAL_MS）
+    uint32_t frame_start_ms;  // 上一影格開始更新的時間（clock_now_ms）
+    uint16_t frame_cost_ms;   // 上一影格自更新至畫布繪製完成的耗時，超過影格間隔時略過下一影格
+    uint8_t frames;           // 本次換圖實際畫出的影格數
+    uint8_t dropped;          // 因上一影格超時而略過的影格數
+    uint16_t cost_ms;         // 本次換圖各影格耗時的總和
+} AnimationBatch;
+
+// 版面重排的結果（見「版面重排」一節）
+typedef struct {
+    int16_t bottom_shift;     // LAYOUT_ANCHOR_BOTTOM 的格子上移的像素數
+    bool bottom_hidden;       // 可見區域放不下 LAYOUT_ANCHOR_BOTTOM 的格子，改為隱藏
+    bool hide_until_done;     // 進行中的遮蔽動畫結束時放不下，整段動畫都維持隱藏
+} Layout;
+
+// 秒數指示（見「秒數指示」一節）：drawn_width 為畫面上已畫出的進度寬度，每次只補畫或清除差異的欄位
+typedef struct {
+    bool enabled;                 // 使用者設定
+    uint8_t timeout_s;            // 開始顯示後自動關閉的秒數
+    bool active;                  // 正以 SECOND_UNIT 訂閱 tick 並顯示進度
+    uint8_t active_s;             // 本次已顯示的秒數
+    uint8_t wrist_down_s;         // 連續偵測到手腕放下的秒數
+    uint8_t second;               // 要顯示的秒數
+    int16_t drawn_width;
+    bool full_redraw;             // 進度條的範圍已被清除（畫布整個重畫、圖層剛建立），須整條重畫
+    Layer *layer;
+} SecondsIndicator;
+
+// 省電策略：依電量、勿擾模式與焦點決定換圖是否播放動畫，不改動使用者的動畫設定
+typedef struct {
+    uint8_t battery_threshold;    // 電量不高於此百分比且未充電時改為靜態更新；0 表示停用
+    bool quiet_time_static;       // 勿擾模式期間改為靜態更新
+    BatteryChargeState battery;
+    bool obscured;                // 通知等視窗覆蓋錶盤（失去焦點）
+    bool tick_downgraded;         // 本次 tick 已計入降級省下的影格
+    bool tick_deferred;           // 本次 tick 已計入延後的重繪
+    uint8_t animation_redraws;    // 一次換圖動畫造成的重繪次數（見 anim_batch_count_redraws）
+    uint32_t frames_saved;        // 累計省下的影格數，跨次啟動保留
+    uint32_t frames_saved_stored; // flash 中的 frames_saved，未變動時結束不重寫
+} PowerPolicy;
+
+// 儲存的設定：整組以一筆資料寫入 KEY_SETTINGS。
+// 新欄位只能附加在結尾，讀到較短的舊資料時缺少的欄位保留預設值。
+typedef struct {
+    uint8_t version;
+    uint8_t flags;                // SETTINGS_FLAG_*
+    uint8_t battery_threshold;
+    uint8_t background;           // 以下為解析後主題色的 GColor8 argb 值
+    uint8_t text;
+    uint8_t hour_accent;
+    uint8_t minute_accent;
+    uint8_t seconds_timeout;      // 秒數指示自動關閉的秒數
+    uint32_t sync_version;        // 已套用的手機設定版本（KEY_SETTINGS_VERSION）
+} StoredSettings;
+
+// 離開時保存的畫面：glyphs[i] 為 ALL_DISPLAY_LAYERS[i] 顯示的字形。
+// 版本、字形數或主題任一不符時整筆作廢，改為照常從空白畫面播放動畫
+#define GLYPH_SNAPSHOT_VERSION 1
+#define GLYPH_SNAPSHOT_CELLS 12
+typedef struct {
+    uint32_t theme_generation;    // 保存時的 theme_generation()；換色後舊畫面作廢
+    uint8_t version;              // GLYPH_SNAPSHOT_VERSION；格式改變時遞增
+    uint8_t glyph_count;          // 保存時的 GLYPH_COUNT；字形表改變後舊資料作廢
+    uint8_t glyphs[GLYPH_SNAPSHOT_CELLS];
+} GlyphSnapshot;
+
+#if defined(PERF_COUNTERS)
+// 匯出欄位，順序即 AppMessage 鍵值順序（KEY_PERF_FIRST 起），須與 package.json 的 messageKeys 一致。
+// HEAP_* 為啟動以來的值，其餘為上次匯出以來的區間統計
+typedef enum {
+    PERF_HEAP_USED,
+    PERF_HEAP_PEAK,               // 字形載入前後取樣的 heap_bytes_used 最大值
+    PERF_TICKS,
+    PERF_TICK_MS_TOTAL,
+    PERF_TICK_MS_MAX,
+    PERF_ANIM_CREATED,
+    PERF_ANIM_CANCELLED,
+    PERF_LOAD_MS_TOTAL,
+    PERF_LOAD_MS_MAX,
+    PERF_SECONDS_DRAWS,           // 秒數指示的繪製次數、重畫面積（像素）與耗時
+    PERF_SECONDS_PIXELS,
+    PERF_SECONDS_DRAW_MS,
+    PERF_ANIM_FRAMES,             // 換圖動畫畫出的影格數、因超時略過的影格數與各影格耗時總和
+    PERF_ANIM_DROPPED,
+    PERF_ANIM_FRAME_MS,
+    PERF_LOADS,                   // 以下 LAYER_TYPE_COUNT 欄為各 LayerType 的字形載入次數
+    PERF_FIELD_COUNT = PERF_LOADS + LAYER_TYPE_COUNT,
+} PerfField;
+
+typedef struct {
+    uint32_t values[PERF_FIELD_COUNT];
+    uint16_t tick_anim_created;   // 上一次 tick 開始與取消的換圖批次數（覆蓋層顯示）
+    uint16_t tick_anim_cancelled;
+    uint32_t tick_ms;             // 上一次 tick 的耗時
+    Layer *overlay;
+} PerfCounters;
+#endif
+
 // 應用狀態
 typedef struct {
     Window *main_window;
     ThemeConfig theme;
     bool animation_enabled;
+    bool lunar_date;                  // 日期列改為顯示農曆（閏月、初一至三十）
+#if defined(USE_GLYPH_ATLAS)
+    GlyphAtlas atlas;
+#elif defined(USE_RLE_GLYPHS)
+    GlyphStream glyph_stream;
+#else
+    GlyphCache glyph_cache;
+    AppTimer *prefetch_timer;
+#endif
+#if defined(USE_CANVAS_RENDERER)
+    Canvas canvas;
+#else
+    CellGroup cell_group;
+#endif
+#if defined(USE_DATE_ROW_COMPOSITOR)
+    DateRow date_row;
+#endif
+    AnimationBatch anim_batch;
+    Layout layout;
+    PowerPolicy power;
+    SecondsIndicator seconds;
+    StoredSettings stored_settings;   // 上次寫入 flash 的內容，用來判斷設定是否真的變動
+    uint32_t sync_version;            // 已套用的手機設定版本，隨設定一起儲存
+    GlyphSnapshot glyph_snapshot;     // flash 中保存的畫面，離開時未變動則不重寫
+#if defined(PERF_COUNTERS)
+    PerfCounters perf;
+#endif
 
     DisplayLayer hour_layers[2];
     DisplayLayer minute_layers[2];
@@ -116,52 +490,53 @@ typedef struct {
 
 static AppState s_app;
 
-// ==================== 資源映射表 ====================
-//
-// 每個陣列將數字索引對應至圖片資源 ID，供時間與日期圖層查表使用。
-// 命名規則：
-//   UPPERCASE（U）  = 大號大寫中文數字圖片，用於顯示「時」
-//   LOWERCASE（L）  = 大號小寫中文數字圖片，用於顯示「分」
-//   DATE_UPPERCASE（SU）/ DATE_LOWERCASE（SL）= 同上的縮小版，用於顯示「月日」
-//   TENS = 十位圖，ONES = 個位圖
-//   RESOURCE_ID_NONE = 該位置不顯示圖片（例如小時十位不足時）
-
-static const uint32_t TIME_UPPERCASE_TENS_RESOURCES[] = {
-    RESOURCE_ID_NONE, RESOURCE_ID_IMG_U10, RESOURCE_ID_IMG_U2,
-};
-
-static const uint32_t TIME_UPPERCASE_ONES_RESOURCES[] = {
-    RESOURCE_ID_IMG_U10, RESOURCE_ID_IMG_U1, RESOURCE_ID_IMG_U2, RESOURCE_ID_IMG_U3,
-    RESOURCE_ID_IMG_U4, RESOURCE_ID_IMG_U5, RESOURCE_ID_IMG_U6, RESOURCE_ID_IMG_U7,
-    RESOURCE_ID_IMG_U8, RESOURCE_ID_IMG_U9
-};
-
-static const uint32_t TIME_LOWERCASE_TENS_RESOURCES[] = {
-    RESOURCE_ID_IMG_L0, RESOURCE_ID_IMG_L10, RESOURCE_ID_IMG_L20, RESOURCE_ID_IMG_L30,
-    RESOURCE_ID_IMG_L4, RESOURCE_ID_IMG_L5,
-};
-
-static const uint32_t TIME_LOWERCASE_ONES_RESOURCES[] = {
-    RESOURCE_ID_IMG_L10, RESOURCE_ID_IMG_L1, RESOURCE_ID_IMG_L2, RESOURCE_ID_IMG_L3,
-    RESOURCE_ID_IMG_L4, RESOURCE_ID_IMG_L5, RESOURCE_ID_IMG_L6, RESOURCE_ID_IMG_L7,
-    RESOURCE_ID_IMG_L8, RESOURCE_ID_IMG_L9
-};
-
-static const uint32_t DATE_UPPERCASE_ONES_RESOURCES[] = {
-    RESOURCE_ID_IMG_SU10, RESOURCE_ID_IMG_SU1, RESOURCE_ID_IMG_SU2, RESOURCE_ID_IMG_SU3,
-    RESOURCE_ID_IMG_SU4, RESOURCE_ID_IMG_SU5, RESOURCE_ID_IMG_SU6, RESOURCE_ID_IMG_SU7,
-    RESOURCE_ID_IMG_SU8, RESOURCE_ID_IMG_SU9
+// 全部格子，依建立與疊放順序排列
+static DisplayLayer *const ALL_DISPLAY_LAYERS[] = {
+    &s_app.hour_layers[0], &s_app.hour_layers[1],
+    &s_app.minute_layers[0], &s_app.minute_layers[1],
+    &s_app.month_layers[0], &s_app.month_layers[1],
+    &s_app.day_layers[0], &s_app.day_layers[1],
+    &s_app.week_layer, &s_app.yue_layer, &s_app.ri_layer, &s_app.zhou_layer
 };
 
-static const uint32_t DATE_LOWERCASE_TENS_RESOURCES[] = {
-    RESOURCE_ID_NONE, RESOURCE_ID_IMG_SL10, RESOURCE_ID_IMG_SL20, RESOURCE_ID_IMG_SL30,
-};
+#define DISPLAY_LAYER_COUNT ARRAY_LENGTH(ALL_DISPLAY_LAYERS)
+_Static_assert(DISPLAY_LAYER_COUNT == GLYPH_SNAPSHOT_CELLS, "GlyphSnapshot must cover every display layer");
+#if defined(USE_GLYPH_CACHE)
+_Static_assert(GLYPH_CACHE_SLOTS == DISPLAY_LAYER_COUNT + 1, "Glyph cache holds one slot per cell plus a spare");
+#endif
 
-static const uint32_t DATE_LOWERCASE_ONES_RESOURCES[] = {
-    RESOURCE_ID_IMG_SL10, RESOURCE_ID_IMG_SL1, RESOURCE_ID_IMG_SL2, RESOURCE_ID_IMG_SL3,
-    RESOURCE_ID_IMG_SL4, RESOURCE_ID_IMG_SL5, RESOURCE_ID_IMG_SL6, RESOURCE_ID_IMG_SL7,
-    RESOURCE_ID_IMG_SL8, RESOURCE_ID_IMG_SL9,
+// 版面表：依 ALL_DISPLAY_LAYERS 順序為時（2 格）、分（2 格）、月（2 格）、日（2 格）、星期，
+// 以及固定的「月」「日」「周」；時間兩列固定在上方，日期列貼齊下方
+static const CellLayout CELL_LAYOUT[] = {
+#if defined(PBL_PLATFORM_EMERY)
+    {LAYER_TYPE_HOUR, LAYOUT_ANCHOR_TOP, {8, 8}},
+    {LAYER_TYPE_HOUR, LAYOUT_ANCHOR_TOP, {104, 8}},
+    {LAYER_TYPE_MINUTE_NORMAL, LAYOUT_ANCHOR_TOP, {8, 104}},
+    {LAYER_TYPE_MINUTE_ACCENT, LAYOUT_ANCHOR_TOP, {104, 104}},
+    {LAYER_TYPE_DATE, LAYOUT_ANCHOR_BOTTOM, {8, 199}},
+    {LAYER_TYPE_DATE, LAYOUT_ANCHOR_BOTTOM, {31, 199}},
+    {LAYER_TYPE_DATE, LAYOUT_ANCHOR_BOTTOM, {77, 199}},
+    {LAYER_TYPE_DATE, LAYOUT_ANCHOR_BOTTOM, {100, 199}},
+    {LAYER_TYPE_DATE, LAYOUT_ANCHOR_BOTTOM, {169, 199}},
+    {LAYER_TYPE_STATIC, LAYOUT_ANCHOR_BOTTOM, {54, 199}},
+    {LAYER_TYPE_STATIC, LAYOUT_ANCHOR_BOTTOM, {123, 199}},
+    {LAYER_TYPE_STATIC, LAYOUT_ANCHOR_BOTTOM, {146, 199}},
+#else
+    {LAYER_TYPE_HOUR, LAYOUT_ANCHOR_TOP, {4, 4}},
+    {LAYER_TYPE_HOUR, LAYOUT_ANCHOR_TOP, {74, 4}},
+    {LAYER_TYPE_MINUTE_NORMAL, LAYOUT_ANCHOR_TOP, {4, 74}},
+    {LAYER_TYPE_MINUTE_ACCENT, LAYOUT_ANCHOR_TOP, {74, 74}},
+    {LAYER_TYPE_DATE, LAYOUT_ANCHOR_BOTTOM, {4, 149}},
+    {LAYER_TYPE_DATE, LAYOUT_ANCHOR_BOTTOM, {16, 149}},
+    {LAYER_TYPE_DATE, LAYOUT_ANCHOR_BOTTOM, {50, 149}},
+    {LAYER_TYPE_DATE, LAYOUT_ANCHOR_BOTTOM, {62, 149}},
+    {LAYER_TYPE_DATE, LAYOUT_ANCHOR_BOTTOM, {129, 149}},
+    {LAYER_TYPE_STATIC, LAYOUT_ANCHOR_BOTTOM, {28, 149}},
+    {LAYER_TYPE_STATIC, LAYOUT_ANCHOR_BOTTOM, {74, 149}},
+    {LAYER_TYPE_STATIC, LAYOUT_ANCHOR_BOTTOM, {117, 149}},
+#endif
 };
+_Static_assert(ARRAY_LENGTH(CELL_LAYOUT) == GLYPH_SNAPSHOT_CELLS, "CELL_LAYOUT must cover every display layer");
 
 // ==================== 主題系統 ====================
 
@@ -194,33 +569,7 @@ static void theme_init_defaults(ThemeConfig *theme) {
 #endif
 }
 
-static void theme_load_from_storage(ThemeConfig *theme) {
-    theme_init_defaults(theme);
-
-#if defined(PBL_COLOR)
-    if (persist_exists(KEY_BACKGROUND_COLOR)) {
-        theme->background = GColorFromHEX(persist_read_int(KEY_BACKGROUND_COLOR));
-    }
-    if (persist_exists(KEY_TEXT_COLOR)) {
-        theme->text = GColorFromHEX(persist_read_int(KEY_TEXT_COLOR));
-    }
-    if (persist_exists(KEY_HOUR_COLOR)) {
-        theme->hour_accent = GColorFromHEX(persist_read_int(KEY_HOUR_COLOR));
-    }
-    if (persist_exists(KEY_MINUTE_COLOR)) {
-        theme->minute_accent = GColorFromHEX(persist_read_int(KEY_MINUTE_COLOR));
-    }
-#else
-    if (persist_exists(KEY_THEME_IS_DARK)) {
-        theme->is_dark = persist_read_bool(KEY_THEME_IS_DARK);
-    }
-    if (persist_exists(KEY_BW_HOUR_ACCENT)) {
-        theme->bw_hour_accent = persist_read_bool(KEY_BW_HOUR_ACCENT);
-    }
-    theme_resolve_colors(theme);
-#endif
-}
-
+#if defined(USE_GLYPH_ATLAS)
 static int get_palette_size(GBitmap *bitmap) {
     switch (gbitmap_get_format(bitmap)) {
         case GBitmapFormat1Bit:
@@ -230,19 +579,11 @@ static int get_palette_size(GBitmap *bitmap) {
         default:                        return 0;  // GBitmapFormat8Bit 等無調色盤格式
     }
 }
+#endif
 
-static void theme_apply_to_bitmap(const ThemeConfig *theme, GBitmap *bitmap, LayerType type) {
-    if (!bitmap) return;
-
-    GColor *palette = gbitmap_get_palette(bitmap);
-    if (!palette) {
-        // 8-bit 等非調色盤格式無法直接修改顏色，跳過主題套用
-        return;
-    }
-
-    int palette_size = get_palette_size(bitmap);
-    if (palette_size == 0) return;
-
+// 將來源調色盤中的語意色替換為主題色寫入 dest；source 與 dest 可為同一陣列（就地改寫）
+static void theme_map_palette(const ThemeConfig *theme, const GColor *source, GColor *dest,
+                              int palette_size, LayerType type) {
     GColor accent_color = (type == LAYER_TYPE_HOUR) ? theme->hour_accent :
                           (type == LAYER_TYPE_MINUTE_ACCENT) ? theme->minute_accent :
                           theme->text;
@@ -251,523 +592,2738 @@ static void theme_apply_to_bitmap(const ThemeConfig *theme, GBitmap *bitmap, Lay
     //   彩色平台：Red → 強調色，Black → 文字色（或強調色，視圖層類型）
     //   黑白平台：White → 強調色（同背景色），Black → 文字色（單色調色盤的唯一前景色）
     for (int i = 0; i < palette_size; i++) {
+        dest[i] = source[i];
 #if defined(PBL_COLOR)
-        if (gcolor_equal(palette[i], GColorRed)) {
-            palette[i] = accent_color;
-        } else if (gcolor_equal(palette[i], GColorBlack)) {
-            palette[i] = (type == LAYER_TYPE_MINUTE_ACCENT) ? accent_color : theme->text;
+        if (gcolor_equal(source[i], GColorRed)) {
+            dest[i] = accent_color;
+        } else if (gcolor_equal(source[i], GColorBlack)) {
+            dest[i] = (type == LAYER_TYPE_MINUTE_ACCENT) ? accent_color : theme->text;
         }
 #else
-        if (gcolor_equal(palette[i], GColorBlack)) {
-            palette[i] = theme->text;
-        } else if (gcolor_equal(palette[i], GColorWhite)) {
-            palette[i] = accent_color;
+        if (gcolor_equal(source[i], GColorBlack)) {
+            dest[i] = theme->text;
+        } else if (gcolor_equal(source[i], GColorWhite)) {
+            dest[i] = accent_color;
         }
 #endif
     }
 }
 
-// ==================== 圖層管理系統 ====================
+// ==================== 設定儲存 ====================
+//
+// 全部設定存為單一 StoredSettings，啟動時只需一次 persist_read_data。
+// 手機只送出變動的鍵值，但仍可能送出完整設定（首次同步、重新同步），
+// 因此先套用至 s_app，再與上次寫入的內容比較，有差異才寫入 flash。
+
+static void settings_capture(StoredSettings *stored) {
+    const ThemeConfig *theme = &s_app.theme;
+    uint8_t flags = 0;
+    if (theme->is_dark) flags |= SETTINGS_FLAG_IS_DARK;
+    if (theme->bw_hour_accent) flags |= SETTINGS_FLAG_BW_HOUR_ACCENT;
+    if (s_app.animation_enabled) flags |= SETTINGS_FLAG_ANIMATION;
+    if (s_app.power.quiet_time_static) flags |= SETTINGS_FLAG_QUIET_TIME_STATIC;
+    if (s_app.lunar_date) flags |= SETTINGS_FLAG_LUNAR_DATE;
+    if (s_app.seconds.enabled) flags |= SETTINGS_FLAG_SECONDS;
+
+    *stored = (StoredSettings){
+        .version = SETTINGS_VERSION,
+        .flags = flags,
+        .battery_threshold = s_app.power.battery_threshold,
+        .background = theme->background.argb,
+        .text = theme->text.argb,
+        .hour_accent = theme->hour_accent.argb,
+        .minute_accent = theme->minute_accent.argb,
+        .seconds_timeout = s_app.seconds.timeout_s,
+        .sync_version = s_app.sync_version,
+    };
+}
 
-static void display_layer_init(DisplayLayer *dl, Layer *parent, GRect frame, LayerType type) {
-    if (!dl || !parent) return;
+static void settings_apply(const StoredSettings *stored) {
+    ThemeConfig *theme = &s_app.theme;
+    theme->background = (GColor){.argb = stored->background};
+    theme->text = (GColor){.argb = stored->text};
+    theme->hour_accent = (GColor){.argb = stored->hour_accent};
+    theme->minute_accent = (GColor){.argb = stored->minute_accent};
+    theme->is_dark = stored->flags & SETTINGS_FLAG_IS_DARK;
+    theme->bw_hour_accent = stored->flags & SETTINGS_FLAG_BW_HOUR_ACCENT;
+    theme_resolve_colors(theme);
 
-    memset(dl, 0, sizeof(DisplayLayer));
+    s_app.animation_enabled = stored->flags & SETTINGS_FLAG_ANIMATION;
+    s_app.power.battery_threshold = stored->battery_threshold;
+    s_app.power.quiet_time_static = stored->flags & SETTINGS_FLAG_QUIET_TIME_STATIC;
+    s_app.lunar_date = stored->flags & SETTINGS_FLAG_LUNAR_DATE;
+    s_app.seconds.enabled = stored->flags & SETTINGS_FLAG_SECONDS;
+    s_app.seconds.timeout_s = MAX(1, stored->seconds_timeout);
+    s_app.sync_version = stored->sync_version;
+}
 
-    dl->base_frame = frame;
-    dl->type = type;
-    dl->anim_state = ANIM_STATE_IDLE;
+static void settings_init_defaults(void) {
+    theme_init_defaults(&s_app.theme);
+    s_app.animation_enabled = true;
+    s_app.power.battery_threshold = POWER_SAVE_BATTERY_DEFAULT;
+    s_app.power.quiet_time_static = true;
+    s_app.seconds.timeout_s = SECONDS_TIMEOUT_DEFAULT_S;
+}
 
-    dl->layer = bitmap_layer_create(frame);
-    if (!dl->layer) {
-        APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to create bitmap layer");
+// 舊版逐鍵儲存的設定：讀入 s_app 後刪除各鍵，回傳是否找到任何舊鍵
+static bool settings_migrate_legacy(void) {
+    static const uint32_t LEGACY_KEYS[] = {
+        KEY_HOUR_COLOR, KEY_MINUTE_COLOR, KEY_THEME_IS_DARK, KEY_ANIMATION_ENABLED,
+        KEY_BACKGROUND_COLOR, KEY_TEXT_COLOR, KEY_BW_HOUR_ACCENT,
+        KEY_POWER_SAVE_BATTERY, KEY_POWER_SAVE_QUIET_TIME,
+    };
+
+    bool found = false;
+    for (size_t i = 0; i < ARRAY_LENGTH(LEGACY_KEYS); i++) {
+        uint32_t key = LEGACY_KEYS[i];
+        if (!persist_exists(key)) continue;
+
+        int32_t value = persist_read_int(key);
+        switch (key) {
+            // 舊版於黑白平台不寫入顏色鍵；即使存在也會被 theme_resolve_colors() 覆蓋
+            case KEY_BACKGROUND_COLOR: s_app.theme.background = GColorFromHEX(value); break;
+            case KEY_TEXT_COLOR: s_app.theme.text = GColorFromHEX(value); break;
+            case KEY_HOUR_COLOR: s_app.theme.hour_accent = GColorFromHEX(value); break;
+            case KEY_MINUTE_COLOR: s_app.theme.minute_accent = GColorFromHEX(value); break;
+            case KEY_THEME_IS_DARK: s_app.theme.is_dark = value != 0; break;
+            case KEY_BW_HOUR_ACCENT: s_app.theme.bw_hour_accent = value != 0; break;
+            case KEY_ANIMATION_ENABLED: s_app.animation_enabled = value != 0; break;
+            case KEY_POWER_SAVE_BATTERY: s_app.power.battery_threshold = (uint8_t)value; break;
+            case KEY_POWER_SAVE_QUIET_TIME: s_app.power.quiet_time_static = value != 0; break;
+        }
+        persist_delete(key);
+        found = true;
+    }
+    theme_resolve_colors(&s_app.theme);
+    return found;
+}
+
+// 與上次寫入的內容相同時不寫入 flash
+static void settings_save(void) {
+    StoredSettings current;
+    settings_capture(&current);
+    if (memcmp(&current, &s_app.stored_settings, sizeof(current)) == 0) return;
+
+    if (persist_write_data(KEY_SETTINGS, &current, sizeof(current)) != (int)sizeof(current)) {
+        APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to save settings");
+        return;
+    }
+    s_app.stored_settings = current;
+}
+
+static void settings_load(void) {
+    settings_init_defaults();
+
+    // 以目前預設值為底讀入，較短的舊版資料只覆蓋前段欄位
+    StoredSettings stored;
+    settings_capture(&stored);
+    int size = persist_read_data(KEY_SETTINGS, &stored, sizeof(stored));
+
+    if (size > 0 && stored.version == SETTINGS_VERSION) {
+        settings_apply(&stored);
+        settings_capture(&s_app.stored_settings);
+        return;
+    }
+
+    if (size > 0) {
+        // 較新版本寫入的資料無法解讀：沿用預設值，等使用者再次儲存設定時才覆寫
+        APP_LOG(APP_LOG_LEVEL_WARNING, "Unknown settings version: %d", (int)stored.version);
+        return;
+    }
+
+    // 首次安裝或由逐鍵儲存升級：寫入一次完整設定，之後啟動只讀這一筆
+    if (settings_migrate_legacy()) {
+        APP_LOG(APP_LOG_LEVEL_INFO, "Migrated per-key settings");
+    }
+    settings_save();
+}
+
+// ==================== 效能計數器 ====================
+//
+// 以 PERF_COUNTERS 建置時記錄堆積用量、字形載入與 tick 的耗時、動畫建立與取消次數、
+// 秒數指示的繪製次數與重畫面積，以及各 LayerType 的字形載入次數。畫面頂端的覆蓋層顯示上一次 tick 的數值；
+// 每逢整點以 AppMessage 送出一次，由 src/js/app.js 依平台累計。
+// 未定義 PERF_COUNTERS 時以下皆為空函式，不佔用任何記憶體。
+
+// 毫秒時鐘：效能計數器的耗時與換圖動畫的影格預算共用
+static uint32_t clock_now_ms(void) {
+    time_t seconds;
+    uint16_t ms;
+    time_ms(&seconds, &ms);
+    return (uint32_t)seconds * 1000 + ms;
+}
+
+#if defined(PERF_COUNTERS)
+
+static void perf_sample_heap(void) {
+    uint32_t *values = s_app.perf.values;
+    values[PERF_HEAP_USED] = (uint32_t)heap_bytes_used();
+    values[PERF_HEAP_PEAK] = MAX(values[PERF_HEAP_PEAK], values[PERF_HEAP_USED]);
+}
+
+static uint32_t perf_load_begin(void) {
+    perf_sample_heap();
+    return clock_now_ms();
+}
+
+static void perf_load_end(LayerType type, uint32_t start) {
+    uint32_t *values = s_app.perf.values;
+    uint32_t elapsed = clock_now_ms() - start;
+    perf_sample_heap();
+    values[PERF_LOAD_MS_TOTAL] += elapsed;
+    values[PERF_LOAD_MS_MAX] = MAX(values[PERF_LOAD_MS_MAX], elapsed);
+    values[PERF_LOADS + type]++;
+}
+
+static uint32_t perf_seconds_draw_begin(void) {
+    return clock_now_ms();
+}
+
+// 韌體計時精度為 1 ms，單次繪製多半計為 0，DRAW_MS 只反映較慢的繪製；重畫面積為精確值
+static void perf_seconds_draw_end(uint32_t start, uint32_t pixels) {
+    uint32_t *values = s_app.perf.values;
+    values[PERF_SECONDS_DRAWS]++;
+    values[PERF_SECONDS_PIXELS] += pixels;
+    values[PERF_SECONDS_DRAW_MS] += clock_now_ms() - start;
+}
+
+static void perf_note_animation_created(void) {
+    s_app.perf.values[PERF_ANIM_CREATED]++;
+}
+
+static void perf_note_animation_cancelled(void) {
+    s_app.perf.values[PERF_ANIM_CANCELLED]++;
+}
+
+static void perf_note_animation_frames(uint32_t frames, uint32_t dropped, uint32_t cost_ms) {
+    uint32_t *values = s_app.perf.values;
+    values[PERF_ANIM_FRAMES] += frames;
+    values[PERF_ANIM_DROPPED] += dropped;
+    values[PERF_ANIM_FRAME_MS] += cost_ms;
+}
+
+// 送出後清除區間統計；送出失敗時保留，併入下一次匯出
+static void perf_export(void) {
+    DictionaryIterator *iter;
+    if (app_message_outbox_begin(&iter) != APP_MSG_OK) return;
+
+    for (int i = 0; i < PERF_FIELD_COUNT; i++) {
+        dict_write_int32(iter, KEY_PERF_FIRST + i, (int32_t)s_app.perf.values[i]);
+    }
+    if (app_message_outbox_send() != APP_MSG_OK) return;
+
+    uint32_t *values = s_app.perf.values;
+    memset(&values[PERF_TICKS], 0, sizeof(uint32_t) * (PERF_FIELD_COUNT - PERF_TICKS));
+}
+
+static uint32_t perf_tick_begin(void) {
+    s_app.perf.tick_anim_created = (uint16_t)s_app.perf.values[PERF_ANIM_CREATED];
+    s_app.perf.tick_anim_cancelled = (uint16_t)s_app.perf.values[PERF_ANIM_CANCELLED];
+    return clock_now_ms();
+}
+
+static void perf_tick_end(uint32_t start, TimeUnits units_changed) {
+    PerfCounters *perf = &s_app.perf;
+    perf->tick_ms = clock_now_ms() - start;
+    perf->tick_anim_created = (uint16_t)perf->values[PERF_ANIM_CREATED] - perf->tick_anim_created;
+    perf->tick_anim_cancelled = (uint16_t)perf->values[PERF_ANIM_CANCELLED] - perf->tick_anim_cancelled;
+    perf->values[PERF_TICKS]++;
+    perf->values[PERF_TICK_MS_TOTAL] += perf->tick_ms;
+    perf->values[PERF_TICK_MS_MAX] = MAX(perf->values[PERF_TICK_MS_MAX], perf->tick_ms);
+
+    if (units_changed & HOUR_UNIT) {
+        perf_export();
+    }
+    if (perf->overlay) {
+        layer_mark_dirty(perf->overlay);
+    }
+}
+
+static void perf_overlay_update_proc(Layer *layer, GContext *ctx) {
+    const PerfCounters *perf = &s_app.perf;
+    char text[96];
+    snprintf(text, sizeof(text), "tick %lums anim +%u -%u\nheap %lu/%lu B",
+             (unsigned long)perf->tick_ms, perf->tick_anim_created, perf->tick_anim_cancelled,
+             (unsigned long)perf->values[PERF_HEAP_USED], (unsigned long)perf->values[PERF_HEAP_PEAK]);
+
+    GRect bounds = layer_get_bounds(layer);
+    graphics_context_set_fill_color(ctx, GColorBlack);
+    graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+    graphics_context_set_text_color(ctx, GColorWhite);
+    graphics_draw_text(ctx, text, fonts_get_system_font(FONT_KEY_GOTHIC_14), bounds,
+                       GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
+}
+
+// 須於所有格子之後加入，覆蓋層才會畫在最上層
+static void perf_overlay_load(Layer *parent) {
+    GRect bounds = layer_get_bounds(parent);
+    s_app.perf.overlay = layer_create(GRect(0, 0, bounds.size.w, PERF_OVERLAY_HEIGHT));
+    if (!s_app.perf.overlay) return;
+
+    layer_set_update_proc(s_app.perf.overlay, perf_overlay_update_proc);
+    layer_add_child(parent, s_app.perf.overlay);
+    perf_sample_heap();
+}
+
+static void perf_overlay_unload(void) {
+    if (s_app.perf.overlay) {
+        layer_destroy(s_app.perf.overlay);
+        s_app.perf.overlay = NULL;
+    }
+}
+#else
+static inline uint32_t perf_load_begin(void) { return 0; }
+static inline void perf_load_end(LayerType type, uint32_t start) {}
+static inline uint32_t perf_seconds_draw_begin(void) { return 0; }
+static inline void perf_seconds_draw_end(uint32_t start, uint32_t pixels) {}
+static inline void perf_note_animation_created(void) {}
+static inline void perf_note_animation_cancelled(void) {}
+static inline void perf_note_animation_frames(uint32_t frames, uint32_t dropped, uint32_t cost_ms) {}
+static inline uint32_t perf_tick_begin(void) { return 0; }
+static inline void perf_tick_end(uint32_t start, TimeUnits units_changed) {}
+static inline void perf_overlay_load(Layer *parent) {}
+static inline void perf_overlay_unload(void) {}
+#endif
+
+#if defined(USE_GLYPH_ATLAS)
+// ==================== 字形圖集 ====================
+//
+// 所有字形打包於單一圖集資源（tools/build_atlas.py 產生），於 main_window_load 一次載入。
+// 每個圖層持有一張指向圖集的子點陣圖，換字時只以 gbitmap_set_bounds 移動可視範圍，
+// 不需讀取資源也不需配置記憶體。圖集本身的調色盤保留原始語意色，
+// 各 LayerType 另有一份套用主題後的調色盤，由子點陣圖以 gbitmap_set_palette 共用。
+
+static void glyph_atlas_apply_theme(void) {
+    GlyphAtlas *atlas = &s_app.atlas;
+    if (!atlas->bitmap) return;
+
+    GColor *source = gbitmap_get_palette(atlas->bitmap);
+    if (!source) return;
+
+    for (int type = 0; type < LAYER_TYPE_COUNT; type++) {
+        theme_map_palette(&s_app.theme, source, atlas->palettes[type], atlas->palette_size, type);
+    }
+}
+
+static void glyph_atlas_load(void) {
+    GlyphAtlas *atlas = &s_app.atlas;
+    atlas->bitmap = gbitmap_create_with_resource(RESOURCE_ID_GLYPH_ATLAS);
+    if (!atlas->bitmap) {
+        APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to load glyph atlas");
+        return;
+    }
+
+    if (!gbitmap_get_palette(atlas->bitmap)) {
+        APP_LOG(APP_LOG_LEVEL_WARNING, "Glyph atlas has no palette, theme not applied");
+    }
+    atlas->palette_size = get_palette_size(atlas->bitmap);
+    if (atlas->palette_size > GLYPH_ATLAS_PALETTE_MAX) {
+        atlas->palette_size = GLYPH_ATLAS_PALETTE_MAX;
+    }
+    glyph_atlas_apply_theme();
+}
+
+static void glyph_atlas_unload(void) {
+    if (s_app.atlas.bitmap) {
+        gbitmap_destroy(s_app.atlas.bitmap);
+        s_app.atlas.bitmap = NULL;
+    }
+}
+
+#elif defined(USE_GLYPH_CACHE)
+// ==================== 點陣圖快取 ====================
+//
+// 字形依 (resource_id, LayerType) 快取，圖層改為向快取借用點陣圖，
+// 分鐘輪替回到近期顯示過的圖片時即可免去 flash 讀取。
+//
+// 所有槽位的點陣圖於視窗載入時一次配置（時、分、日期字形各一種固定尺寸與格式，尺寸為該類裁切後字形的最大值），
+// 換字時以 resource_load 將 raw 資源直接讀入槽位，並以 gbitmap_set_bounds 縮為該字形的墨跡範圍，
+// 穩定運作時不再配置或釋放記憶體，Aplite 的小堆積也不會因 66x66 與 11x11 的圖片反覆配置而碎片化。
+// 槽位數為格子數加一個備用槽（見 GLYPH_CACHE_SLOTS），需要載入時依 LRU 重用未被借用的槽位。
+//
+// raw 資源的像素值即語意色插槽索引（tools/build_atlas.py 產生），索引 i 恆為 GLYPH_SLOT_PALETTE[i]，
+// 因此槽位只需指向所屬 LayerType 的共用主題調色盤；主題變更只需重算 palettes 並重繪。
+
+static const GColor GLYPH_SLOT_PALETTE[GLYPH_PALETTE_SIZE] = {
+    GColorClear, GColorBlack, GColorWhite, GColorClear,
+};
+
+static void glyph_cache_apply_theme(void) {
+    GlyphCache *cache = &s_app.glyph_cache;
+    for (int type = 0; type < LAYER_TYPE_COUNT; type++) {
+        theme_map_palette(&s_app.theme, GLYPH_SLOT_PALETTE, cache->palettes[type], GLYPH_PALETTE_SIZE, type);
+    }
+}
+
+#define GLYPH_RAW_FORMAT(bits) ((bits) == 1 ? GBitmapFormat1BitPalette : GBitmapFormat2BitPalette)
+
+static const struct {
+    GSize size;
+    uint8_t bits;
+    uint8_t slots;
+} GLYPH_SLOT_CLASSES[GLYPH_SLOT_CLASS_COUNT] = {
+    [GLYPH_SLOT_HOUR] = {{GLYPH_RAW_HOUR_WIDTH, GLYPH_RAW_HOUR_HEIGHT}, GLYPH_RAW_HOUR_BITS, GLYPH_CACHE_HOUR_SLOTS},
+    [GLYPH_SLOT_MINUTE] = {{GLYPH_RAW_MINUTE_WIDTH, GLYPH_RAW_MINUTE_HEIGHT}, GLYPH_RAW_MINUTE_BITS,
+                           GLYPH_CACHE_MINUTE_SLOTS},
+    [GLYPH_SLOT_DATE] = {{GLYPH_RAW_DATE_WIDTH, GLYPH_RAW_DATE_HEIGHT}, GLYPH_RAW_DATE_BITS, GLYPH_CACHE_DATE_SLOTS},
+};
+
+static GlyphSlotClass glyph_slot_class_for(LayerType type) {
+    switch (type) {
+        case LAYER_TYPE_HOUR:          return GLYPH_SLOT_HOUR;
+        case LAYER_TYPE_MINUTE_ACCENT:
+        case LAYER_TYPE_MINUTE_NORMAL: return GLYPH_SLOT_MINUTE;
+        default:                       return GLYPH_SLOT_DATE;
+    }
+}
+
+static void glyph_cache_init(void) {
+    GlyphCache *cache = &s_app.glyph_cache;
+    memset(cache, 0, sizeof(GlyphCache));
+    glyph_cache_apply_theme();
+
+    int index = 0;
+    for (int slot_class = 0; slot_class < GLYPH_SLOT_CLASS_COUNT; slot_class++) {
+        GSize size = GLYPH_SLOT_CLASSES[slot_class].size;
+        GBitmapFormat format = GLYPH_RAW_FORMAT(GLYPH_SLOT_CLASSES[slot_class].bits);
+        for (int i = 0; i < GLYPH_SLOT_CLASSES[slot_class].slots; i++, index++) {
+            GlyphCacheEntry *entry = &cache->entries[index];
+            entry->slot_class = (uint8_t)slot_class;
+            entry->bitmap = gbitmap_create_blank_with_palette(size, format, cache->palettes[LAYER_TYPE_STATIC], false);
+            if (!entry->bitmap) {
+                APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to allocate glyph slot %d", index);
+                continue;
+            }
+            entry->bytes = gbitmap_get_bytes_per_row(entry->bitmap) * size.h;
+        }
+    }
+}
+
+static void glyph_cache_deinit(void) {
+    GlyphCache *cache = &s_app.glyph_cache;
+    for (int i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+        if (cache->entries[i].bitmap) {
+            gbitmap_destroy(cache->entries[i].bitmap);
+            cache->entries[i].bitmap = NULL;
+        }
+    }
+}
+
+// 清空槽位內容，點陣圖保留供下一張字形重用
+static void glyph_cache_drop(GlyphCacheEntry *entry) {
+    GlyphCache *cache = &s_app.glyph_cache;
+    if (entry->prefetched) cache->stats.prefetch_wasted++;
+    cache->stats.bytes_used -= entry->bytes;
+    entry->resource_id = 0;
+    entry->refs = 0;
+    entry->prefetched = false;
+}
+
+static GlyphCacheEntry *glyph_cache_find_bitmap(const GBitmap *bitmap) {
+    GlyphCache *cache = &s_app.glyph_cache;
+    for (int i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+        if (cache->entries[i].resource_id && cache->entries[i].bitmap == bitmap) {
+            return &cache->entries[i];
+        }
+    }
+    return NULL;
+}
+
+// 將裁切後的 raw 字形（size 為墨跡範圍）讀入槽位左上角，並將點陣圖的範圍縮為 size；
+// 列寬與資源相同時一次讀完，否則逐列讀入
+static bool glyph_slot_load(GlyphCacheEntry *entry, uint32_t resource_id, GSize size) {
+    ResHandle handle = resource_get_handle(resource_id);
+    if (!handle) return false;
+
+    GSize slot_size = GLYPH_SLOT_CLASSES[entry->slot_class].size;
+    if (size.w > slot_size.w || size.h > slot_size.h) return false;
+    GBitmap *bitmap = entry->bitmap;
+    uint8_t *data = gbitmap_get_data(bitmap);
+    uint16_t stride = gbitmap_get_bytes_per_row(bitmap);
+    uint16_t row_bytes = (size.w * GLYPH_SLOT_CLASSES[entry->slot_class].bits + 7) / 8;
+    size_t bytes = (size_t)row_bytes * size.h;
+    if (resource_size(handle) != bytes) return false;
+
+    if (stride == row_bytes) {
+        if (resource_load(handle, data, bytes) != bytes) return false;
+    } else {
+        for (int y = 0; y < size.h; y++) {
+            if (resource_load_byte_range(handle, y * row_bytes, data + y * stride, row_bytes) != row_bytes) {
+                return false;
+            }
+        }
+    }
+    gbitmap_set_bounds(bitmap, GRect(0, 0, size.w, size.h));
+    return true;
+}
+
+// prefetch 為 true 時只確保圖片已在快取中（不借用、不計入命中統計），沒有可重用的槽位時放棄而不記錄錯誤
+static GBitmap *glyph_cache_get(GlyphId glyph, LayerType type, bool prefetch) {
+    GlyphCache *cache = &s_app.glyph_cache;
+    uint32_t resource_id = GLYPH_RESOURCE_IDS[glyph];
+    GlyphSlotClass slot_class = glyph_slot_class_for(type);
+    GlyphCacheEntry *slot = NULL;
+
+    for (int i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+        GlyphCacheEntry *entry = &cache->entries[i];
+        if (!entry->bitmap || entry->slot_class != slot_class) continue;
+
+        if (entry->resource_id == resource_id && entry->type == type) {
+            entry->last_used = ++cache->clock;
+            if (!prefetch) {
+                entry->refs++;
+                cache->stats.hits++;
+                if (entry->prefetched) {
+                    entry->prefetched = false;
+                    cache->stats.prefetch_hits++;
+                }
+            }
+            return entry->bitmap;
+        }
+        // 優先使用空槽，其次為最久未使用且未被借用的槽位；預取不淘汰同一輪預取的項目
+        if (prefetch && entry->prefetched) continue;
+        if (entry->refs == 0 && (!slot || (slot->resource_id && (!entry->resource_id ||
+                                                                  entry->last_used < slot->last_used)))) {
+            slot = entry;
+        }
+    }
+
+    if (prefetch) {
+        cache->stats.prefetch_loads++;
+    } else {
+        cache->stats.misses++;
+    }
+    if (!slot) {
+        // 每個格子都有自己的槽位，借用時走到這裡代表槽位過少
+        if (!prefetch) {
+            APP_LOG(APP_LOG_LEVEL_ERROR, "No free glyph cache slot for resource %lu", (unsigned long)resource_id);
+        }
+        return NULL;
+    }
+    if (slot->resource_id) {
+        glyph_cache_drop(slot);
+        cache->stats.evictions++;
+    }
+
+    if (!glyph_slot_load(slot, resource_id, GLYPH_INK_RECTS[glyph].size)) {
+        APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to read glyph resource %lu", (unsigned long)resource_id);
+        return NULL;
+    }
+    gbitmap_set_palette(slot->bitmap, cache->palettes[type], false);
+
+    slot->resource_id = resource_id;
+    slot->type = type;
+    slot->refs = prefetch ? 0 : 1;
+    slot->prefetched = prefetch;
+    slot->last_used = ++cache->clock;
+    cache->stats.bytes_used += slot->bytes;
+    return slot->bitmap;
+}
+
+static GBitmap *glyph_cache_acquire(GlyphId glyph, LayerType type) {
+    return glyph_cache_get(glyph, type, false);
+}
+
+static void glyph_cache_prefetch(GlyphId glyph, LayerType type) {
+    glyph_cache_get(glyph, type, true);
+}
+
+static void glyph_cache_release(GBitmap *bitmap) {
+    GlyphCacheEntry *entry = glyph_cache_find_bitmap(bitmap);
+    if (!entry || entry->refs == 0) return;
+
+    entry->refs--;
+}
+#endif
+
+// ==================== 版面 ====================
+//
+// 格子位置來自版面表 CELL_LAYOUT，再套用目前的重排結果（s_app.layout，見「版面重排」一節）。
+
+static GSize layout_cell_size(LayerType type) {
+    switch (type) {
+        case LAYER_TYPE_HOUR:
+        case LAYER_TYPE_MINUTE_ACCENT:
+        case LAYER_TYPE_MINUTE_NORMAL:
+            return TIME_IMAGE_SIZE;
+        default:
+            return DATE_IMAGE_SIZE;
+    }
+}
+
+// 第 i 格依目前版面的基準位置（不含換圖動畫的位移）
+static GRect layout_cell_frame(size_t i) {
+    const CellLayout *cell = &CELL_LAYOUT[i];
+    GRect frame = (GRect){.origin = cell->origin, .size = layout_cell_size(cell->type)};
+    if (cell->anchor == LAYOUT_ANCHOR_BOTTOM) {
+        frame.origin.y -= s_app.layout.bottom_shift;
+    }
+    return frame;
+}
+
+// 貼齊下方的格子（日期列）於目前版面的聯集，向下多留 ANIMATION_OFFSET_Y（換圖動畫的位移範圍）
+static GRect layout_bottom_frame(void) {
+    int16_t x0 = INT16_MAX, y0 = INT16_MAX, x1 = INT16_MIN, y1 = INT16_MIN;
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        if (CELL_LAYOUT[i].anchor != LAYOUT_ANCHOR_BOTTOM) continue;
+        GRect cell = layout_cell_frame(i);
+        x0 = MIN(x0, cell.origin.x);
+        y0 = MIN(y0, cell.origin.y);
+        x1 = MAX(x1, cell.origin.x + cell.size.w);
+        y1 = MAX(y1, cell.origin.y + cell.size.h);
+    }
+    return GRect(x0, y0, x1 - x0, y1 - y0 + ANIMATION_OFFSET_Y);
+}
+
+// 由畫布或日期列合成繪製的格子：有字形且未因版面重排而隱藏
+static inline bool layout_cell_visible(const DisplayLayer *dl) {
+    return dl->shown && !dl->hidden;
+}
+
+// ==================== 字形放大 ====================
+//
+// 圖集中的字形為底稿尺寸，格子（DisplayLayer.frame）仍是畫面上的尺寸，兩者相差 glyph_scale 倍。
+// 自行寫入像素的路徑（畫面直寫、字形串流）在寫入時以最近鄰放大；交給 SDK 繪製的路徑（畫布、日期列合成）
+// 先以索引複製放大到暫存點陣圖（glyph_draw_scaled）。倍數為 1 時與原本的逐像素複製相同。
+
+static inline int glyph_scale(LayerType type) {
+    switch (type) {
+        case LAYER_TYPE_HOUR:
+        case LAYER_TYPE_MINUTE_ACCENT:
+        case LAYER_TYPE_MINUTE_NORMAL:
+            return GLYPH_TIME_SCALE;
+        default:
+            return GLYPH_DATE_SCALE;
+    }
+}
+
+#if defined(USE_GLYPH_SCALING) && !defined(USE_RLE_GLYPHS)
+static uint8_t bitmap_palette_bpp(GBitmapFormat format) {
+    switch (format) {
+        case GBitmapFormat1BitPalette: return 1;
+        case GBitmapFormat2BitPalette: return 2;
+        case GBitmapFormat4BitPalette: return 4;
+        default:                       return 0;
+    }
+}
+
+// row 以 MSB 在前存放 bpp 位元的像素索引
+static inline uint8_t bitmap_get_index(const uint8_t *row, int x, int bpp) {
+    int bit = x * bpp;
+    return (row[bit >> 3] >> (8 - bpp - (bit & 7))) & ((1 << bpp) - 1);
+}
+
+static inline void bitmap_set_index(uint8_t *row, int x, int bpp, uint8_t index) {
+    int bit = x * bpp;
+    int shift = 8 - bpp - (bit & 7);
+    uint8_t mask = (uint8_t)(((1 << bpp) - 1) << shift);
+    row[bit >> 3] = (uint8_t)((row[bit >> 3] & ~mask) | (index << shift));
+}
+
+// 將 glyph 放大 scale 倍後左上角 extent 範圍內的索引複製到 data（size 大小、每列 stride 位元組）的 (dx, dy)，
+// 超出 data 的部分略過；兩者須為相同位元數的調色盤格式
+static void glyph_copy_indices(uint8_t *data, uint16_t stride, GSize size, int dx, int dy,
+                               const GBitmap *glyph, int scale, GSize extent, int bpp) {
+    GRect src = gbitmap_get_bounds(glyph);
+    const uint8_t *src_data = gbitmap_get_data(glyph);
+    uint16_t src_stride = gbitmap_get_bytes_per_row(glyph);
+    for (int y = MAX(0, -dy); y < extent.h && dy + y < size.h; y++) {
+        const uint8_t *src_row = src_data + (src.origin.y + y / scale) * src_stride;
+        uint8_t *dst_row = data + (dy + y) * stride;
+        for (int x = MAX(0, -dx); x < extent.w && dx + x < size.w; x++) {
+            bitmap_set_index(dst_row, dx + x, bpp, bitmap_get_index(src_row, src.origin.x + x / scale, bpp));
+        }
+    }
+}
+
+// 放大的字形先以索引複製到暫存點陣圖（沿用字形的調色盤），只畫出其左上角 frame 大小的範圍；
+// 不需放大或沒有暫存點陣圖時直接畫出字形
+static void glyph_draw_scaled(GContext *ctx, const GBitmap *glyph, GRect frame, int scale, GBitmap *scratch) {
+    int bpp = bitmap_palette_bpp(gbitmap_get_format(glyph));
+    if (scale == 1 || !scratch || bpp != bitmap_palette_bpp(gbitmap_get_format(scratch))) {
+        graphics_draw_bitmap_in_rect(ctx, glyph, frame);
+        return;
+    }
+
+    GRect bounds = gbitmap_get_bounds(glyph);
+    GRect scratch_bounds = gbitmap_get_bounds(scratch);
+    GSize extent = GSize(MIN(frame.size.w, MIN(bounds.size.w * scale, scratch_bounds.size.w)),
+                         MIN(frame.size.h, MIN(bounds.size.h * scale, scratch_bounds.size.h)));
+    glyph_copy_indices(gbitmap_get_data(scratch), gbitmap_get_bytes_per_row(scratch), scratch_bounds.size, 0, 0,
+                       glyph, scale, extent, bpp);
+    gbitmap_set_palette(scratch, gbitmap_get_palette(glyph), false);
+    graphics_draw_bitmap_in_rect(ctx, scratch, GRect(frame.origin.x, frame.origin.y, extent.w, extent.h));
+}
+#endif
+
+// ==================== 墨跡裁切 ====================
+//
+// 字形資源只存墨跡範圍（不透明像素的外接矩形，tools/build_atlas.py 裁切），四周的透明邊界不載入也不合成。
+// GLYPH_INK_RECTS 記錄該範圍於原本方形字形中的位置；格子的 frame 仍是整個方形，
+// 各繪製路徑改將字形畫在 frame 左上角加上墨跡位移之處，畫面與未裁切時相同。
+
+// 墨跡範圍於格子中的位置與大小（畫面像素，已乘上放大倍數）
+static GRect glyph_ink_rect(GlyphId glyph, LayerType type) {
+    if (glyph == GLYPH_NONE) return GRectZero;
+    GRect ink = GLYPH_INK_RECTS[glyph];
+    int scale = glyph_scale(type);
+    return GRect(ink.origin.x * scale, ink.origin.y * scale, ink.size.w * scale, ink.size.h * scale);
+}
+
+// 格子中字形實際繪製的範圍
+static inline GRect display_layer_ink_frame(const DisplayLayer *dl) {
+    return GRect(dl->frame.origin.x + dl->ink.origin.x, dl->frame.origin.y + dl->ink.origin.y,
+                 dl->ink.size.w, dl->ink.size.h);
+}
+
+#if defined(USE_FRAMEBUFFER_BLITTER)
+// ==================== 畫面直寫 ====================
+//
+// 畫布重繪時以 graphics_capture_frame_buffer 取得畫面，直接寫入字形，不經 graphics_draw_bitmap_in_rect
+// 逐像素解碼調色盤與合成。字形皆為 1-bit 或 2-bit 調色盤格式（tools/build_atlas.py 量化），
+// 調色盤為各 LayerType 套用主題後的共用調色盤：
+//   黑白平台：畫面為 1-bit（LSB 在前），每次處理 32 個像素，將來源拆成不透明與白色兩個位元平面，
+//             以 mask-and-or 一次寫入一個字組
+//   彩色平台：畫面為每像素一個 GColor8，2-bit 字形以每個來源位元組（4 像素）查表，
+//             全不透明時一次寫入 4 個像素，全透明時略過
+// 座標為畫布圖層座標，畫布圖層位於畫面原點。字形串流只用到 blit_fill，字形核心見「字形串流」一節。
+
+#if !defined(USE_RLE_GLYPHS)
+static bool blit_supported(const GBitmap *bitmap) {
+    GBitmapFormat format = gbitmap_get_format(bitmap);
+    return (format == GBitmapFormat1BitPalette || format == GBitmapFormat2BitPalette) && gbitmap_get_palette(bitmap);
+}
+
+// 字形放大 scale 倍後在畫面上實際寫入的範圍（已裁切），以及對應的來源起點（放大後的座標，
+// 來源像素為 src / scale）
+static bool blit_clip(const GBitmap *fb, const GBitmap *glyph, GRect frame, int scale, GRect *area, GPoint *src) {
+    GRect bounds = gbitmap_get_bounds(glyph);
+    *area = GRect(frame.origin.x, frame.origin.y,
+                  MIN(frame.size.w, bounds.size.w * scale), MIN(frame.size.h, bounds.size.h * scale));
+    GRect screen = gbitmap_get_bounds(fb);
+    grect_clip(area, &screen);
+    if (grect_is_empty(area)) return false;
+
+    *src = GPoint(bounds.origin.x * scale + area->origin.x - frame.origin.x,
+                  bounds.origin.y * scale + area->origin.y - frame.origin.y);
+    return true;
+}
+#endif
+
+#if defined(PBL_COLOR)
+// 取出由第 bit 個位元起的 8 個位元（來源像素為 MSB 在前）
+static inline uint8_t blit_read8(const uint8_t *row, int bit) {
+    int byte = bit >> 3;
+    int shift = bit & 7;
+    if (shift == 0) return row[byte];
+    return (uint8_t)((row[byte] << shift) | (row[byte + 1] >> (8 - shift)));
+}
+
+static inline uint8_t blit_pixel_index(const uint8_t *row, int x, int bpp) {
+    int bit = x * bpp;
+    return (uint8_t)((row[bit >> 3] >> (8 - bpp - (bit & 7))) & ((1 << bpp) - 1));
+}
+
+#if !defined(USE_RLE_GLYPHS)
+static const BlitLut *blit_lut_for(LayerType type, const GColor *palette) {
+    BlitLut *lut = &s_app.canvas.luts[type];
+    uint32_t key = (uint32_t)palette[0].argb | (uint32_t)palette[1].argb << 8 |
+                   (uint32_t)palette[2].argb << 16 | (uint32_t)palette[3].argb << 24;
+    if (lut->valid && lut->key == key) return lut;
+
+    for (int b = 0; b < 256; b++) {
+        uint32_t colors = 0;
+        uint8_t mask = 0;
+        for (int k = 0; k < 4; k++) {
+            GColor color = palette[(b >> (6 - 2 * k)) & 0x3];
+            if (color.a == 0) continue;
+            colors |= (uint32_t)(color.argb | 0xC0) << (8 * k);
+            mask |= (uint8_t)(1u << k);
+        }
+        lut->colors[b] = colors;
+        lut->masks[b] = mask;
+    }
+    lut->key = key;
+    lut->valid = true;
+    return lut;
+}
+#endif
+
+static void blit_fill(GBitmap *fb, GRect rect, GColor color) {
+    GRect screen = gbitmap_get_bounds(fb);
+    grect_clip(&rect, &screen);
+    if (grect_is_empty(&rect)) return;
+
+    uint8_t *data = gbitmap_get_data(fb);
+    uint16_t stride = gbitmap_get_bytes_per_row(fb);
+    for (int y = rect.origin.y; y < rect.origin.y + rect.size.h; y++) {
+        memset(data + y * stride + rect.origin.x, color.argb | 0xC0, rect.size.w);
+    }
+}
+
+#if !defined(USE_RLE_GLYPHS)
+#if defined(USE_GLYPH_SCALING)
+// 放大的字形逐來源像素解碼一次，連續寫入 scale 個畫面像素；來源列相同的畫面列各自重新解碼
+static void blit_glyph_scaled(GBitmap *fb, const GBitmap *glyph, GRect area, GPoint src, int scale) {
+    const GColor *palette = gbitmap_get_palette(glyph);
+    int bpp = gbitmap_get_format(glyph) == GBitmapFormat2BitPalette ? 2 : 1;
+    const uint8_t *src_data = gbitmap_get_data(glyph);
+    uint16_t src_stride = gbitmap_get_bytes_per_row(glyph);
+    uint8_t *dst_data = gbitmap_get_data(fb);
+    uint16_t dst_stride = gbitmap_get_bytes_per_row(fb);
+
+    for (int row = 0; row < area.size.h; row++) {
+        const uint8_t *src_row = src_data + (src.y + row) / scale * src_stride;
+        uint8_t *dst = dst_data + (area.origin.y + row) * dst_stride + area.origin.x;
+        // 第一個來源像素可能已被裁掉一部分，只剩 run 個畫面像素
+        int run = scale - src.x % scale;
+        for (int x = 0, sx = src.x / scale; x < area.size.w; sx++, run = scale) {
+            int end = MIN(x + run, area.size.w);
+            GColor color = palette[blit_pixel_index(src_row, sx, bpp)];
+            if (color.a) {
+                for (int k = x; k < end; k++) dst[k] = color.argb | 0xC0;
+            }
+            x = end;
+        }
+    }
+}
+#endif
+
+static void blit_glyph(GBitmap *fb, const GBitmap *glyph, GRect frame, LayerType type) {
+    int scale = glyph_scale(type);
+    GRect area;
+    GPoint src;
+    if (!blit_clip(fb, glyph, frame, scale, &area, &src)) return;
+#if defined(USE_GLYPH_SCALING)
+    if (scale > 1) {
+        blit_glyph_scaled(fb, glyph, area, src, scale);
+        return;
+    }
+#endif
+
+    const GColor *palette = gbitmap_get_palette(glyph);
+    int bpp = gbitmap_get_format(glyph) == GBitmapFormat2BitPalette ? 2 : 1;
+    const BlitLut *lut = bpp == 2 ? blit_lut_for(type, palette) : NULL;
+    const uint8_t *src_data = gbitmap_get_data(glyph);
+    uint16_t src_stride = gbitmap_get_bytes_per_row(glyph);
+    uint8_t *dst_data = gbitmap_get_data(fb);
+    uint16_t dst_stride = gbitmap_get_bytes_per_row(fb);
+
+    for (int row = 0; row < area.size.h; row++) {
+        const uint8_t *src_row = src_data + (src.y + row) * src_stride;
+        uint8_t *dst = dst_data + (area.origin.y + row) * dst_stride + area.origin.x;
+        int x = 0;
+        if (lut) {
+            for (int bit = src.x * 2; x + 4 <= area.size.w; x += 4, bit += 8) {
+                uint8_t b = blit_read8(src_row, bit);
+                uint8_t mask = lut->masks[b];
+                if (mask == 0xF) {
+                    memcpy(dst + x, &lut->colors[b], 4);
+                } else if (mask) {
+                    for (int k = 0; k < 4; k++) {
+                        if (mask & (1u << k)) dst[x + k] = (uint8_t)(lut->colors[b] >> (8 * k));
+                    }
+                }
+            }
+        }
+        for (; x < area.size.w; x++) {
+            GColor color = palette[blit_pixel_index(src_row, src.x + x, bpp)];
+            if (color.a) dst[x] = color.argb | 0xC0;
+        }
+    }
+}
+#endif
+#else
+static inline uint32_t blit_reverse32(uint32_t x) {
+    x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+    x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+    x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+    x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+    return (x >> 16) | (x << 16);
+}
+
+// 取出偶數位元，緊縮至低 16 位元
+static inline uint32_t blit_compress_even(uint32_t x) {
+    x &= 0x55555555u;
+    x = (x | (x >> 1)) & 0x33333333u;
+    x = (x | (x >> 2)) & 0x0F0F0F0Fu;
+    x = (x | (x >> 4)) & 0x00FF00FFu;
+    return (x | (x >> 8)) & 0x0000FFFFu;
+}
+
+// 取出由第 bit 個位元起的 32 個位元（MSB 在前），超出該列的部分補 0
+static inline uint32_t blit_read32(const uint8_t *row, int row_bytes, int bit) {
+    int byte = bit >> 3;
+    uint64_t bits = 0;
+    for (int i = 0; i < 5; i++) {
+        bits = (bits << 8) | (byte + i < row_bytes ? row[byte + i] : 0);
+    }
+    return (uint32_t)(bits >> (8 - (bit & 7)));
+}
+
+// 將 32 個像素的 mask / value（位元 i 為畫面上第 x + i 個像素）寫入 1-bit 畫面的一列
+static inline void blit_write32(uint8_t *row, int x, uint32_t mask, uint32_t value) {
+    uint8_t *word = row + (x >> 5) * 4;
+    int shift = x & 31;
+    uint32_t dst;
+    value &= mask;
+
+    memcpy(&dst, word, 4);
+    dst = (dst & ~(mask << shift)) | (value << shift);
+    memcpy(word, &dst, 4);
+
+    if (shift && (mask >> (32 - shift))) {
+        memcpy(&dst, word + 4, 4);
+        dst = (dst & ~(mask >> (32 - shift))) | (value >> (32 - shift));
+        memcpy(word + 4, &dst, 4);
+    }
+}
+
+static void blit_fill(GBitmap *fb, GRect rect, GColor color) {
+    GRect screen = gbitmap_get_bounds(fb);
+    grect_clip(&rect, &screen);
+    if (grect_is_empty(&rect)) return;
+
+    uint8_t *data = gbitmap_get_data(fb);
+    uint16_t stride = gbitmap_get_bytes_per_row(fb);
+    uint32_t value = gcolor_equal(color, GColorWhite) ? ~0u : 0;
+    for (int y = rect.origin.y; y < rect.origin.y + rect.size.h; y++) {
+        for (int x = 0; x < rect.size.w; x += 32) {
+            int n = MIN(32, rect.size.w - x);
+            blit_write32(data + y * stride, rect.origin.x + x, n == 32 ? ~0u : (1u << n) - 1, value);
+        }
+    }
+}
+
+#if !defined(USE_RLE_GLYPHS)
+static void blit_glyph(GBitmap *fb, const GBitmap *glyph, GRect frame, LayerType type) {
+    GRect area;
+    GPoint src;
+    if (!blit_clip(fb, glyph, frame, 1, &area, &src)) return;
+
+    // 調色盤索引 i 是否不透明、是否為白色（位元 i 對應索引 i）
+    const GColor *palette = gbitmap_get_palette(glyph);
+    int bpp = gbitmap_get_format(glyph) == GBitmapFormat2BitPalette ? 2 : 1;
+    uint8_t opaque = 0;
+    uint8_t white = 0;
+    for (int i = 0; i < (1 << bpp); i++) {
+        if (palette[i].a == 0) continue;
+        opaque |= (uint8_t)(1u << i);
+        if (gcolor_equal(palette[i], GColorWhite)) white |= (uint8_t)(1u << i);
+    }
+
+    const uint8_t *src_data = gbitmap_get_data(glyph);
+    uint16_t src_stride = gbitmap_get_bytes_per_row(glyph);
+    uint8_t *dst_data = gbitmap_get_data(fb);
+    uint16_t dst_stride = gbitmap_get_bytes_per_row(fb);
+
+    for (int row = 0; row < area.size.h; row++) {
+        const uint8_t *src_row = src_data + (src.y + row) * src_stride;
+        uint8_t *dst_row = dst_data + (area.origin.y + row) * dst_stride;
+
+        for (int x = 0; x < area.size.w; x += 32) {
+            int n = MIN(32, area.size.w - x);
+            int bit = (src.x + x) * bpp;
+
+            // 位元平面：位元 i 為第 x + i 個像素調色盤索引的高位（hi）與低位（lo）
+            uint32_t hi = 0;
+            uint32_t lo;
+            if (bpp == 1) {
+                lo = blit_reverse32(blit_read32(src_row, src_stride, bit));
+            } else {
+                uint32_t first = blit_reverse32(blit_read32(src_row, src_stride, bit));
+                uint32_t second = n > 16 ? blit_reverse32(blit_read32(src_row, src_stride, bit + 32)) : 0;
+                hi = blit_compress_even(first) | (blit_compress_even(second) << 16);
+                lo = blit_compress_even(first >> 1) | (blit_compress_even(second >> 1) << 16);
+            }
+
+            uint32_t mask = 0;
+            uint32_t value = 0;
+            for (int i = 0; i < (1 << bpp); i++) {
+                uint32_t select = ((i & 2) ? hi : ~hi) & ((i & 1) ? lo : ~lo);
+                if (opaque & (1u << i)) mask |= select;
+                if (white & (1u << i)) value |= select;
+            }
+            blit_write32(dst_row, area.origin.x + x, mask & (n == 32 ? ~0u : (1u << n) - 1), value);
+        }
+    }
+}
+#endif
+#endif
+#endif
+
+#if defined(USE_RLE_GLYPHS)
+// ==================== 字形串流 ====================
+//
+// 字形以 RLE 依序存於單一 raw 資源 GLYPH_RLE（tools/build_atlas.py 產生），GLYPH_RLE_INDEX 記錄各字形的位置與底稿尺寸。
+// 每個位元組為一段同色像素，依列優先排列並可跨越列尾，像素值為語意色插槽。
+// 畫面直寫時每次以 resource_load_byte_range 讀入 GLYPH_RLE_CHUNK 位元組到堆疊，逐段換成所屬 LayerType 的主題色，
+// 以 blit_fill 填入擷取的畫面（放大的字形一段即 scale 列高的矩形），透明段只前進不寫入。
+// 不配置任何點陣圖，圖集與 Aplite 的快取槽位都不需要；代價是每次重畫格子都重新讀取 flash。
+
+static const GColor GLYPH_STREAM_SLOTS[GLYPH_PALETTE_SIZE] = {
+    GColorClear, GColorBlack, GColorWhite, PBL_IF_COLOR_ELSE(GColorRed, GColorClear),
+};
+
+static void glyph_stream_apply_theme(void) {
+    GlyphStream *stream = &s_app.glyph_stream;
+    for (int type = 0; type < LAYER_TYPE_COUNT; type++) {
+        theme_map_palette(&s_app.theme, GLYPH_STREAM_SLOTS, stream->palettes[type], GLYPH_PALETTE_SIZE, type);
+    }
+}
+
+static void glyph_stream_load(void) {
+    GlyphStream *stream = &s_app.glyph_stream;
+    stream->handle = resource_get_handle(RESOURCE_ID_GLYPH_RLE);
+    if (!stream->handle) {
+        APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to find glyph stream");
+    }
+    glyph_stream_apply_theme();
+}
+
+static void glyph_stream_unload(void) {
+    s_app.glyph_stream.handle = NULL;
+}
+
+static bool blit_supported(GlyphImage glyph) {
+    return s_app.glyph_stream.handle != NULL;
+}
+
+// 解碼到 frame 下緣（或畫面底部）即停止，其後的位元組不再讀取
+static void blit_glyph(GBitmap *fb, GlyphImage glyph, GRect frame, LayerType type) {
+    const GlyphRle *rle = &GLYPH_RLE_INDEX[glyph];
+    int scale = glyph_scale(type);
+    GRect area = GRect(frame.origin.x, frame.origin.y,
+                       MIN(frame.size.w, rle->width * scale), MIN(frame.size.h, rle->height * scale));
+    GRect screen = gbitmap_get_bounds(fb);
+    grect_clip(&area, &screen);
+    if (grect_is_empty(&area)) return;
+
+    const GColor *palette = s_app.glyph_stream.palettes[type];
+    int bottom = area.origin.y + area.size.h;
+    uint8_t chunk[GLYPH_RLE_CHUNK];
+    uint32_t offset = rle->offset;
+    uint32_t end = offset + rle->size;
+    // 目前的來源像素：x 為底稿座標，y 為該列放大後於畫面上的頂端
+    int x = 0;
+    int y = frame.origin.y;
+    while (offset < end && y < bottom) {
+        size_t n = MIN(sizeof(chunk), end - offset);
+        if (resource_load_byte_range(s_app.glyph_stream.handle, offset, chunk, n) != n) {
+            APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to read glyph %d", (int)glyph);
+            return;
+        }
+        offset += n;
+
+        for (size_t i = 0; i < n && y < bottom; i++) {
+            GColor color = palette[chunk[i] >> GLYPH_RLE_SLOT_SHIFT];
+            int run = (chunk[i] & GLYPH_RLE_LENGTH_MASK) + 1;
+            // 跨越列尾的一段依列拆開
+            while (run > 0) {
+                int span = MIN(run, rle->width - x);
+                if (color.a) {
+                    GRect rect = GRect(frame.origin.x + x * scale, y, span * scale, scale);
+                    grect_clip(&rect, &area);
+                    if (!grect_is_empty(&rect)) blit_fill(fb, rect, color);
+                }
+                run -= span;
+                x += span;
+                if (x == rle->width) {
+                    x = 0;
+                    y += scale;
+                }
+            }
+        }
+    }
+}
+#endif
+
+// 錶盤被覆蓋時不重繪，兩種繪製方式共用（見「省電策略」一節）：回傳 true 表示本次重繪延後，
+// 每個 tick 只計一次省下的重繪
+static bool power_defer_redraw(void) {
+    PowerPolicy *power = &s_app.power;
+    if (!power->obscured) return false;
+    if (!power->tick_deferred) {
+        power->tick_deferred = true;
+        power->frames_saved++;
+    }
+    return true;
+}
+
+#if defined(USE_CANVAS_RENDERER)
+// ==================== 畫布繪製 ====================
+//
+// 單一圖層的 update_proc 依 ALL_DISPLAY_LAYERS 的順序繪製全部格子，取代 12 個 BitmapLayer。
+// 視窗背景設為透明時，韌體在兩次重繪之間保留畫面內容，因此只需重畫有變動的格子：
+// 先以背景色清除這些格子上次畫的範圍，再依疊放順序重畫它們以及與之重疊的格子。
+// 首次繪製與主題變更時整個畫面重畫。
+
+#define CANVAS_ALL_CELLS ((uint16_t)((1u << DISPLAY_LAYER_COUNT) - 1))
+
+static bool canvas_rects_overlap(GRect a, const GRect *b) {
+    grect_clip(&a, b);
+    return !grect_is_empty(&a);
+}
+
+// 錶盤被覆蓋時只累積髒格子，重新取得焦點後再整個重畫（見 power_did_focus）
+static void canvas_request_redraw(void) {
+    if (power_defer_redraw()) return;
+    layer_mark_dirty(s_app.canvas.layer);
+}
+
+static void canvas_mark_cell_dirty(const DisplayLayer *dl) {
+    if (!s_app.canvas.layer) return;
+    s_app.canvas.dirty_cells |= (uint16_t)(1u << dl->cell);
+    canvas_request_redraw();
+}
+
+static void canvas_mark_all_dirty(void) {
+    if (!s_app.canvas.layer) return;
+    s_app.canvas.full_redraw = true;
+    canvas_request_redraw();
+}
+
+// 與重畫集合中任一格子（舊範圍或新位置）重疊的格子也要重畫，才能維持原本的疊放結果
+static uint16_t canvas_expand_redraw(uint16_t redraw) {
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t j = 0; j < DISPLAY_LAYER_COUNT; j++) {
+            const DisplayLayer *other = ALL_DISPLAY_LAYERS[j];
+            if ((redraw & (1u << j)) || grect_is_empty(&other->drawn)) continue;
+
+            for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+                const DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+                if (!(redraw & (1u << i))) continue;
+                if (canvas_rects_overlap(dl->drawn, &other->drawn) ||
+                    canvas_rects_overlap(display_layer_ink_frame(dl), &other->drawn)) {
+                    redraw |= (uint16_t)(1u << j);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+    return redraw;
+}
+
+#if defined(USE_RLE_GLYPHS)
+// 字形串流沒有點陣圖可交給 graphics_draw_bitmap_in_rect，只能直寫畫面（見 canvas_update_proc）
+#elif defined(USE_GLYPH_SCALING)
+static inline void canvas_draw_glyph(GContext *ctx, const DisplayLayer *dl) {
+    glyph_draw_scaled(ctx, dl->shown, display_layer_ink_frame(dl), glyph_scale(dl->type), s_app.canvas.scratch);
+}
+#else
+static inline void canvas_draw_glyph(GContext *ctx, const DisplayLayer *dl) {
+    graphics_draw_bitmap_in_rect(ctx, dl->shown, display_layer_ink_frame(dl));
+}
+#endif
+
+#if !defined(USE_RLE_GLYPHS)
+// 先以背景色清除 clear 中各格子上次畫的範圍（full 時清除整個畫布），再依疊放順序畫出 redraw 中的格子
+static void canvas_draw_cells(GContext *ctx, GRect bounds, bool full, uint16_t clear, uint16_t redraw) {
+    graphics_context_set_fill_color(ctx, s_app.theme.background);
+    if (full) {
+        graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+    }
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        const DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        if ((clear & (1u << i)) && !grect_is_empty(&dl->drawn)) {
+            graphics_fill_rect(ctx, dl->drawn, 0, GCornerNone);
+        }
+    }
+
+    graphics_context_set_compositing_mode(ctx, GCompOpSet);
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        const DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        if ((redraw & (1u << i)) && layout_cell_visible(dl)) {
+            canvas_draw_glyph(ctx, dl);
+        }
+    }
+}
+#endif
+
+#if defined(USE_FRAMEBUFFER_BLITTER)
+// 與 canvas_draw_cells 相同，但直接寫入畫面；有字形格式不支援或無法擷取畫面時回傳 false，改由前者繪製
+static bool canvas_blit_cells(GContext *ctx, GRect bounds, bool full, uint16_t clear, uint16_t redraw) {
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        const DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        if ((redraw & (1u << i)) && layout_cell_visible(dl) && !blit_supported(dl->shown)) return false;
+    }
+
+    GBitmap *fb = graphics_capture_frame_buffer(ctx);
+    if (!fb) return false;
+    if (gbitmap_get_format(fb) != PBL_IF_COLOR_ELSE(GBitmapFormat8Bit, GBitmapFormat1Bit)) {
+        graphics_release_frame_buffer(ctx, fb);
+        return false;
+    }
+
+    if (full) {
+        blit_fill(fb, bounds, s_app.theme.background);
+    }
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        const DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        if ((clear & (1u << i)) && !grect_is_empty(&dl->drawn)) {
+            blit_fill(fb, dl->drawn, s_app.theme.background);
+        }
+    }
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        const DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        if ((redraw & (1u << i)) && layout_cell_visible(dl)) {
+            blit_glyph(fb, dl->shown, display_layer_ink_frame(dl), dl->type);
+        }
+    }
+
+    graphics_release_frame_buffer(ctx, fb);
+    return true;
+}
+#endif
+
+static void canvas_update_proc(Layer *layer, GContext *ctx) {
+    Canvas *canvas = &s_app.canvas;
+    GRect bounds = layer_get_bounds(layer);
+    bool full = canvas->full_redraw;
+    // 只有其他圖層（秒數指示）需重繪時，不必擷取畫面
+    if (!full && !canvas->dirty_cells) return;
+    // 整個畫布清除後，畫在上層的秒數指示也須整條重畫
+    if (full) s_app.seconds.full_redraw = true;
+    uint16_t clear = full ? 0 : canvas->dirty_cells;
+    uint16_t redraw = full ? CANVAS_ALL_CELLS : canvas_expand_redraw(canvas->dirty_cells);
+
+#if defined(USE_RLE_GLYPHS)
+    // 無法直寫畫面時保留髒格子，下次重繪再試
+    if (!canvas_blit_cells(ctx, bounds, full, clear, redraw)) {
+        APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to stream glyphs to the frame buffer");
+        return;
+    }
+#else
+#if defined(USE_FRAMEBUFFER_BLITTER)
+    if (!canvas_blit_cells(ctx, bounds, full, clear, redraw))
+#endif
+    canvas_draw_cells(ctx, bounds, full, clear, redraw);
+#endif
+
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        if (redraw & (1u << i)) {
+            dl->drawn = layout_cell_visible(dl) ? display_layer_ink_frame(dl) : GRectZero;
+        }
+    }
+
+    canvas->dirty_cells = 0;
+    canvas->full_redraw = false;
+
+    // 換圖動畫進行中，影格的成本算到繪製完成為止（見 anim_batch_update）
+    if (s_app.anim_batch.frames) {
+        s_app.anim_batch.frame_cost_ms = (uint16_t)(clock_now_ms() - s_app.anim_batch.frame_start_ms);
+    }
+}
+
+static void canvas_load(Layer *parent) {
+    Canvas *canvas = &s_app.canvas;
+    canvas->layer = layer_create(layer_get_bounds(parent));
+    if (!canvas->layer) {
+        APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to create canvas layer");
+        return;
+    }
+
+    layer_set_update_proc(canvas->layer, canvas_update_proc);
+    layer_add_child(parent, canvas->layer);
+    canvas->dirty_cells = 0;
+    canvas->full_redraw = true;
+
+#if defined(USE_GLYPH_SCALING) && !defined(USE_RLE_GLYPHS)
+    // 暫存點陣圖與圖集同格式，大小為放大的字形中最大的格子；建立失敗時 canvas_draw_glyph 改畫未放大的字形
+    if (s_app.atlas.bitmap) {
+        GSize size = GLYPH_TIME_SCALE > 1 ? TIME_IMAGE_SIZE : DATE_IMAGE_SIZE;
+        canvas->scratch = gbitmap_create_blank_with_palette(size, gbitmap_get_format(s_app.atlas.bitmap),
+                                                            s_app.atlas.palettes[LAYER_TYPE_DATE], false);
+        if (!canvas->scratch) {
+            APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to create glyph scaling bitmap");
+        }
+    }
+#endif
+}
+
+static void canvas_unload(void) {
+    if (s_app.canvas.layer) {
+        layer_destroy(s_app.canvas.layer);
+        s_app.canvas.layer = NULL;
+    }
+#if defined(USE_GLYPH_SCALING) && !defined(USE_RLE_GLYPHS)
+    if (s_app.canvas.scratch) {
+        gbitmap_destroy(s_app.canvas.scratch);
+        s_app.canvas.scratch = NULL;
+    }
+#endif
+}
+#else
+// ==================== 格子群組 ====================
+//
+// BitmapLayer 模式下，格子與日期列的圖層都是一個全視窗群組圖層的子圖層：群組的 update_proc 以背景色填滿畫面，
+// 視窗本身保持透明，韌體在兩次重繪之間保留畫面內容。韌體每次重繪都走過整棵圖層樹，
+// 群組隱藏時底下的格子一併略過，因此錶盤被覆蓋時格子的變動不重畫，只將群組隱藏並累積變更
+// （與畫布相同，見 power_defer_redraw），重新取得焦點後整個重畫一次。
+// 格子、日期列或秒數指示的位置有任何變動時，以 cell_group_mark_dirty 取消隱藏並標記整個群組重繪。
+// 只有秒數指示需重繪時以 cell_group_hold 同樣隱藏群組，該次重繪只畫進度條。
+
+static void cell_group_update_proc(Layer *layer, GContext *ctx) {
+    graphics_context_set_fill_color(ctx, s_app.theme.background);
+    graphics_fill_rect(ctx, layer_get_bounds(layer), 0, GCornerNone);
+    s_app.cell_group.dirty = false;
+    // 背景覆蓋了進度條所在的位置，進度條須整條重畫
+    s_app.seconds.full_redraw = true;
+}
+
+static void cell_group_mark_dirty(void) {
+    CellGroup *group = &s_app.cell_group;
+    if (!group->layer) return;
+    if (power_defer_redraw()) {
+        layer_set_hidden(group->layer, true);
+        return;
+    }
+    group->dirty = true;
+    layer_set_hidden(group->layer, false);
+    layer_mark_dirty(group->layer);
+}
+
+// 群組沒有待畫的變動時隱藏，下次重繪略過背景與所有格子；之後的 cell_group_mark_dirty 會取消隱藏
+static void cell_group_hold(void) {
+    CellGroup *group = &s_app.cell_group;
+    if (group->layer && !group->dirty) layer_set_hidden(group->layer, true);
+}
+
+// 回傳格子圖層的父圖層；群組建立失敗時格子直接加在 parent 上
+static Layer *cell_group_load(Layer *parent) {
+    CellGroup *group = &s_app.cell_group;
+    group->layer = layer_create(layer_get_bounds(parent));
+    if (!group->layer) {
+        APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to create cell group layer");
+        return parent;
+    }
+    layer_set_update_proc(group->layer, cell_group_update_proc);
+    layer_add_child(parent, group->layer);
+    group->dirty = true;
+    return group->layer;
+}
+
+// 須於格子與日期列的圖層銷毀之後呼叫
+static void cell_group_unload(void) {
+    if (s_app.cell_group.layer) {
+        layer_destroy(s_app.cell_group.layer);
+        s_app.cell_group.layer = NULL;
+    }
+}
+#endif
+
+#if defined(USE_DATE_ROW_COMPOSITOR)
+// ==================== 日期列合成 ====================
+//
+// 月、日、星期與「月」「日」「周」共 8 格一天至多變動一次，卻各自佔用一個 BitmapLayer，
+// 每次重繪（包括每分鐘換字動畫的每個影格）都要逐一走過。改為由單一圖層依序畫出整列：
+// 格子只記錄位置與字形，字形直接取自圖集或點陣圖快取中已有的點陣圖，不另外配置離屏點陣圖。
+// 圖層範圍向下多留 ANIMATION_OFFSET_Y 像素，換日動畫中下滑的格子同樣畫得出來，動畫效果不變。
+// 放大的日期字形（Emery）經一張格子大小的暫存點陣圖繪製。
+
+static bool display_layer_in_date_row(const DisplayLayer *dl) {
+    return dl->type == LAYER_TYPE_DATE || dl->type == LAYER_TYPE_STATIC;
+}
+
+static void date_row_mark_dirty(void) {
+    if (!s_app.date_row.layer) return;
+    cell_group_mark_dirty();
+}
+
+static void date_row_update_proc(Layer *layer, GContext *ctx) {
+    GPoint origin = layer_get_frame(layer).origin;
+    graphics_context_set_compositing_mode(ctx, GCompOpSet);
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        const DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        if (!display_layer_in_date_row(dl) || !layout_cell_visible(dl)) continue;
+
+        GRect frame = display_layer_ink_frame(dl);
+        frame.origin.x -= origin.x;
+        frame.origin.y -= origin.y;
+#if defined(USE_GLYPH_SCALING)
+        glyph_draw_scaled(ctx, dl->shown, frame, glyph_scale(dl->type), s_app.date_row.scratch);
+#else
+        graphics_draw_bitmap_in_rect(ctx, dl->shown, frame);
+#endif
+    }
+}
+
+static void date_row_load(Layer *parent) {
+    DateRow *row = &s_app.date_row;
+    row->layer = layer_create(layout_bottom_frame());
+    if (!row->layer) {
+        APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to create date row");
+        return;
+    }
+    layer_set_update_proc(row->layer, date_row_update_proc);
+    layer_add_child(parent, row->layer);
+
+#if defined(USE_GLYPH_SCALING)
+    // 與圖集同格式、大小為一個日期格子；建立失敗時 glyph_draw_scaled 改畫未放大的字形
+    if (s_app.atlas.bitmap) {
+        row->scratch = gbitmap_create_blank_with_palette(DATE_IMAGE_SIZE, gbitmap_get_format(s_app.atlas.bitmap),
+                                                         s_app.atlas.palettes[LAYER_TYPE_DATE], false);
+        if (!row->scratch) {
+            APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to create glyph scaling bitmap");
+        }
+    }
+#endif
+}
+
+static void date_row_unload(void) {
+    DateRow *row = &s_app.date_row;
+    if (row->layer) {
+        layer_destroy(row->layer);
+        row->layer = NULL;
+    }
+#if defined(USE_GLYPH_SCALING)
+    if (row->scratch) {
+        gbitmap_destroy(row->scratch);
+        row->scratch = NULL;
+    }
+#endif
+}
+#endif
+
+// ==================== 圖層管理系統 ====================
+//
+// 以下函式隱藏兩種繪製方式的差異：畫布模式下格子只是一筆位置與點陣圖的記錄，
+// 由畫布統一繪製；BitmapLayer 模式下則直接操作各自的圖層。
+
+static bool display_layer_is_ready(const DisplayLayer *dl) {
+#if defined(USE_CANVAS_RENDERER)
+    return dl && s_app.canvas.layer;
+#elif defined(USE_DATE_ROW_COMPOSITOR)
+    return dl && (display_layer_in_date_row(dl) ? s_app.date_row.layer != NULL : dl->layer != NULL);
+#else
+    return dl && dl->layer;
+#endif
+}
+
+static void display_layer_set_frame(DisplayLayer *dl, GRect frame) {
+#if defined(USE_CANVAS_RENDERER)
+    if (grect_equal(&dl->frame, &frame)) return;
+    dl->frame = frame;
+    canvas_mark_cell_dirty(dl);
+#else
+    if (grect_equal(&dl->frame, &frame)) return;
+    dl->frame = frame;
+#if defined(USE_DATE_ROW_COMPOSITOR)
+    if (display_layer_in_date_row(dl)) {
+        date_row_mark_dirty();
+        return;
+    }
+#endif
+    layer_set_frame(bitmap_layer_get_layer(dl->layer), display_layer_ink_frame(dl));
+    cell_group_mark_dirty();
+#endif
+}
+
+// 設定格子中顯示的字形，GLYPH_IMAGE_NONE 表示留空；圖集子點陣圖的指標不變但範圍可能已移動，因此一律重畫。
+// glyph 決定墨跡範圍，BitmapLayer 的 frame 隨之縮放到與裁切後的點陣圖相同，置中對齊即不會移動字形
+static void display_layer_show(DisplayLayer *dl, GlyphImage bitmap, GlyphId glyph) {
+    dl->ink = glyph_ink_rect(glyph, dl->type);
+#if defined(USE_CANVAS_RENDERER)
+    dl->shown = bitmap;
+    canvas_mark_cell_dirty(dl);
+#else
+#if defined(USE_DATE_ROW_COMPOSITOR)
+    if (display_layer_in_date_row(dl)) {
+        dl->shown = bitmap;
+        date_row_mark_dirty();
+        return;
+    }
+#endif
+    bitmap_layer_set_bitmap(dl->layer, bitmap);
+    layer_set_frame(bitmap_layer_get_layer(dl->layer), display_layer_ink_frame(dl));
+    cell_group_mark_dirty();
+#endif
+}
+
+// 版面重排時隱藏或重新顯示格子，字形與點陣圖保持不變
+static void display_layer_set_hidden(DisplayLayer *dl, bool hidden) {
+    if (!display_layer_is_ready(dl) || dl->hidden == hidden) return;
+    dl->hidden = hidden;
+#if defined(USE_CANVAS_RENDERER)
+    canvas_mark_cell_dirty(dl);
+#else
+#if defined(USE_DATE_ROW_COMPOSITOR)
+    if (display_layer_in_date_row(dl)) {
+        date_row_mark_dirty();
+        return;
+    }
+#endif
+    layer_set_hidden(bitmap_layer_get_layer(dl->layer), hidden);
+    cell_group_mark_dirty();
+#endif
+}
+
+static void display_layer_init(DisplayLayer *dl, Layer *parent, GRect frame, LayerType type) {
+    if (!dl || !parent) return;
+
+    memset(dl, 0, sizeof(DisplayLayer));
+
+    dl->base_frame = frame;
+    dl->type = type;
+    dl->anim_state = ANIM_STATE_IDLE;
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        if (ALL_DISPLAY_LAYERS[i] == dl) {
+            dl->cell = (uint8_t)i;
+        }
+    }
+
+    dl->frame = frame;
+#if !defined(USE_CANVAS_RENDERER)
+#if defined(USE_DATE_ROW_COMPOSITOR)
+    // 日期列的格子不建立圖層，由日期列圖層繪製
+    if (!display_layer_in_date_row(dl))
+#endif
+    {
+        dl->layer = bitmap_layer_create(frame);
+        if (!dl->layer) {
+            APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to create bitmap layer");
+            return;
+        }
+
+        // GCompOpSet：保留圖片的透明通道，確保多圖層疊加時背景透明正確顯示
+        bitmap_layer_set_background_color(dl->layer, GColorClear);
+        bitmap_layer_set_compositing_mode(dl->layer, GCompOpSet);
+        layer_add_child(parent, bitmap_layer_get_layer(dl->layer));
+    }
+#endif
+
+#if defined(USE_GLYPH_ATLAS)
+    // 子點陣圖常駐至圖層銷毀，並共用所屬 LayerType 的主題調色盤
+    if (s_app.atlas.bitmap) {
+        dl->bitmap = gbitmap_create_as_sub_bitmap(s_app.atlas.bitmap, GRectZero);
+        if (dl->bitmap && s_app.atlas.palette_size > 0) {
+            gbitmap_set_palette(dl->bitmap, s_app.atlas.palettes[type], false);
+        }
+    }
+#endif
+}
+
+static void display_layer_load_glyph(DisplayLayer *dl, GlyphId glyph) {
+    if (!dl) return;
+
+    uint32_t perf_start = perf_load_begin();
+
+#if defined(USE_GLYPH_ATLAS)
+    GBitmap *shown = NULL;
+    if (glyph != GLYPH_NONE && dl->bitmap) {
+        gbitmap_set_bounds(dl->bitmap, GLYPH_ATLAS_RECTS[glyph]);
+        shown = dl->bitmap;
+    }
+#elif defined(USE_RLE_GLYPHS)
+    // 字形於繪製時才自資源解碼，換字只記下編號
+    GlyphImage shown = glyph;
+#else
+    // 先歸還舊圖，讓快取在槽位用盡時可以重用它的槽位來放新圖
+    if (dl->bitmap) {
+        glyph_cache_release(dl->bitmap);
+        dl->bitmap = NULL;
+    }
+
+    if (glyph != GLYPH_NONE) {
+        dl->bitmap = glyph_cache_acquire(glyph, dl->type);
+        if (!dl->bitmap) {
+            APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to load glyph: %d", (int)glyph);
+        }
+    }
+    GBitmap *shown = dl->bitmap;
+#endif
+
+    // 載入失敗時也要清除格子上的舊指標，避免繪製已歸還的點陣圖
+    if (display_layer_is_ready(dl)) {
+        display_layer_show(dl, shown, glyph);
+    }
+    if (glyph != GLYPH_NONE) {
+        perf_load_end(dl->type, perf_start);
+    }
+}
+
+static void display_layer_set_position(DisplayLayer *dl, bool offset_for_animation) {
+    if (!display_layer_is_ready(dl)) return;
+
+    GRect frame = dl->base_frame;
+    if (offset_for_animation) {
+        frame.origin.y += ANIMATION_OFFSET_Y;
+    }
+
+    display_layer_set_frame(dl, frame);
+}
+
+static void display_layer_deinit(DisplayLayer *dl) {
+    if (!dl) return;
+
+#if !defined(USE_RLE_GLYPHS)
+    if (dl->bitmap) {
+#if defined(USE_GLYPH_ATLAS)
+        gbitmap_destroy(dl->bitmap);
+#else
+        glyph_cache_release(dl->bitmap);
+#endif
+        dl->bitmap = NULL;
+    }
+#endif
+
+#if defined(USE_CANVAS_RENDERER)
+    dl->shown = GLYPH_IMAGE_NONE;
+#else
+#if defined(USE_DATE_ROW_COMPOSITOR)
+    dl->shown = NULL;
+#endif
+    if (dl->layer) {
+        bitmap_layer_destroy(dl->layer);
+        dl->layer = NULL;
+    }
+#endif
+
+    dl->current_glyph = GLYPH_NONE;
+    dl->anim_state = ANIM_STATE_IDLE;
+}
+
+// ==================== 圖層遍歷系統 ====================
+
+typedef void (*LayerIteratorCallback)(DisplayLayer *dl, void *context);
+
+static void iterate_all_layers(LayerIteratorCallback callback, void *context) {
+    if (!callback) return;
+
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        callback(ALL_DISPLAY_LAYERS[i], context);
+    }
+}
+
+static void iterate_animated_layers(LayerIteratorCallback callback, void *context) {
+    if (!callback) return;
+
+    DisplayLayer *animated_layers[] = {
+        &s_app.hour_layers[0], &s_app.hour_layers[1],
+        &s_app.minute_layers[0], &s_app.minute_layers[1],
+        &s_app.month_layers[0], &s_app.month_layers[1],
+        &s_app.day_layers[0], &s_app.day_layers[1],
+        &s_app.week_layer
+    };
+
+    for (size_t i = 0; i < ARRAY_LENGTH(animated_layers); i++) {
+        if (animated_layers[i]) {
+            callback(animated_layers[i], context);
+        }
+    }
+}
+
+// ==================== 遍歷回調函數 (Callbacks) ====================
+
+// 釋放圖層的所有資源（動畫、點陣圖、圖層物件）
+static void teardown_layer_cb(DisplayLayer *dl, void *context) {
+    display_layer_deinit(dl);
+}
+
+// 動畫設定變更後將圖層歸位至基準位置（進行中的批次已先收尾）
+static void set_anim_pos_cb(DisplayLayer *dl, void *context) {
+    display_layer_set_position(dl, false);
+}
+
+// ==================== 動畫系統 ====================
+//
+// 換圖動畫：同一次 tick 中所有換字的格子加入同一批次，由單一 Animation 的 update 回呼一起驅動，
+// 不再是每個格子各建立離場、入場兩個 PropertyAnimation：
+//   前半段：格子下滑 ANIMATION_OFFSET_Y 離場（EaseIn）
+//   中點  ：批次內的格子一起換上新字形
+//   後半段：上滑回基準位置（EaseOut）
+// 批次開始播放後若又有換字請求（如分鐘快速連切），先將整批直接收尾至最終狀態再開新批次，
+// 不再逐格串接取消與清理。
+//
+// 批次動畫只在第一次換圖時建立一次。SDK 3 的動畫於 stopped 回呼返回後自動釋放，除非回呼內重新排程，
+// 因此每批收尾後以 ANIMATION_PARK_MS 的延遲、零長度重新排程待命（延遲到期只空跑一次回呼後再次待命）；
+// 下一批換字時取消待命，stopped 回呼見 restarting 即以零延遲重新排程播放。穩定運作時換圖不再配置記憶體。
+//
+// 動畫以線性進度排程，位移由 ANIMATION_EASE_IN 定點緩動表查出，更新回呼不做乘除以外的運算。
+// 韌體的更新回呼約 30 fps，引擎自行決定哪些回呼畫出影格：
+//   位移不變的回呼不重繪；距上一影格不足 ANIMATION_FRAME_INTERVAL_MS 的回呼略過（影格率上限）；
+//   上一影格的更新與畫布繪製超過影格間隔時略過下一影格，讓出 CPU；
+//   中點換字與最後一個影格一律畫出，不受上限與預算影響。
+// 每次換圖畫出與略過的影格數及耗時，結束時計入效能計數器。
+
+// (i / ANIMATION_EASE_STEPS)^2，Q10 定點；前半段即 EaseIn 離場，後半段反向查表即 EaseOut 入場
+static const uint16_t ANIMATION_EASE_IN[ANIMATION_EASE_STEPS + 1] = {
+    0, 4, 16, 36, 64, 100, 144, 196, 256, 324, 400, 484, 576, 676, 784, 900, 1024,
+};
+
+static bool anim_batch_contains(const DisplayLayer *dl) {
+    return (s_app.anim_batch.cells & (1u << dl->cell)) != 0;
+}
+
+// 中點：仍在離場的格子換上目標字形
+static void anim_batch_swap(void) {
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        if (anim_batch_contains(dl) && dl->anim_state == ANIM_STATE_FADE_OUT) {
+            display_layer_load_glyph(dl, dl->current_glyph);
+            dl->anim_state = ANIM_STATE_FADE_IN;
+        }
+    }
+}
+
+static void anim_batch_set_offset(int16_t offset_y) {
+    s_app.anim_batch.offset_y = offset_y;
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        if (anim_batch_contains(dl) && display_layer_is_ready(dl)) {
+            GRect frame = dl->base_frame;
+            frame.origin.y += offset_y;
+            display_layer_set_frame(dl, frame);
+        }
+    }
+}
+
+// 待命的延遲到期時批次為空，不算開始播放
+static void anim_batch_setup(Animation *anim) {
+    s_app.anim_batch.started = s_app.anim_batch.cells != 0;
+}
+
+// 距離兩端的比例 s 查緩動表並於相鄰兩格間線性內插
+static int16_t anim_batch_offset(AnimationProgress progress) {
+    const int32_t half = ANIMATION_NORMALIZED_MAX / 2;
+    int32_t edge = (progress >= half) ? ANIMATION_NORMALIZED_MAX - progress : progress;
+    int32_t scaled = edge * ANIMATION_EASE_STEPS;
+    int32_t index = scaled / half;
+    if (index >= ANIMATION_EASE_STEPS) return ANIMATION_OFFSET_Y;
+
+    int32_t lo = ANIMATION_EASE_IN[index];
+    int32_t ease = lo + (ANIMATION_EASE_IN[index + 1] - lo) * (scaled % half) / half;
+    return (int16_t)((ANIMATION_OFFSET_Y * ease) >> ANIMATION_EASE_SHIFT);
+}
+
+static uint16_t anim_batch_elapsed_ms(AnimationProgress progress) {
+    return (uint16_t)((int64_t)progress * ANIMATION_DURATION_MS / ANIMATION_NORMALIZED_MAX);
+}
+
+// 影格率上限：容許半個韌體影格的誤差，回呼時間略早於排定時間的影格仍然畫出
+static bool anim_batch_frame_due(uint16_t elapsed_ms, uint16_t next_frame_ms) {
+    return elapsed_ms + ANIMATION_FRAME_MS / 2 >= next_frame_ms;
+}
+
+static void anim_batch_update(Animation *anim, const AnimationProgress progress) {
+    AnimationBatch *batch = &s_app.anim_batch;
+    if (!batch->started) return;
+    uint16_t elapsed_ms = anim_batch_elapsed_ms(progress);
+    bool swap = !batch->swapped && progress >= ANIMATION_NORMALIZED_MAX / 2;
+    bool last = progress >= ANIMATION_NORMALIZED_MAX;
+    int16_t offset_y = anim_batch_offset(progress);
+
+    if (!swap && offset_y == batch->offset_y) return;
+    if (!swap && !last) {
+        if (!anim_batch_frame_due(elapsed_ms, batch->next_frame_ms)) return;
+        if (batch->frame_cost_ms > ANIMATION_FRAME_INTERVAL_MS) {
+            batch->cost_ms += batch->frame_cost_ms;
+            batch->frame_cost_ms = 0;
+            batch->dropped++;
+            batch->next_frame_ms = elapsed_ms + ANIMATION_FRAME_INTERVAL_MS;
+            return;
+        }
+    }
+
+    // 先只計更新的耗時，畫布繪製完成時再改為到繪製完成為止
+    batch->cost_ms += batch->frame_cost_ms;
+    batch->frame_start_ms = clock_now_ms();
+    if (swap) {
+        anim_batch_swap();
+        batch->swapped = true;
+    }
+    anim_batch_set_offset(offset_y);
+    batch->frame_cost_ms = (uint16_t)(clock_now_ms() - batch->frame_start_ms);
+    batch->frames++;
+    batch->next_frame_ms = elapsed_ms + ANIMATION_FRAME_INTERVAL_MS;
+}
+
+// 以 ANIMATION_FRAME_MS 的回呼間隔走過一次動畫（不計超時略過），計算引擎實際畫出的影格數：
+// 位移為整數像素，多數回呼位置不變也不會重繪，影格率上限再略過過密的影格
+static uint8_t anim_batch_count_redraws(void) {
+    uint8_t redraws = 0;
+    int16_t offset_y = 0;
+    uint16_t next_frame_ms = 0;
+    bool swapped = false;
+    for (int frame = 1; frame <= ANIMATION_FRAMES; frame++) {
+        int64_t elapsed_ms = MIN(frame * ANIMATION_FRAME_MS, ANIMATION_DURATION_MS);
+        AnimationProgress progress = (AnimationProgress)(ANIMATION_NORMALIZED_MAX * elapsed_ms / ANIMATION_DURATION_MS);
+        uint16_t elapsed = anim_batch_elapsed_ms(progress);
+        bool swap = !swapped && progress >= ANIMATION_NORMALIZED_MAX / 2;
+        bool last = progress >= ANIMATION_NORMALIZED_MAX;
+        int16_t next = anim_batch_offset(progress);
+        if (!swap && next == offset_y) continue;
+        if (!swap && !last && !anim_batch_frame_due(elapsed, next_frame_ms)) continue;
+
+        redraws++;
+        swapped |= swap;
+        offset_y = next;
+        next_frame_ms = elapsed + ANIMATION_FRAME_INTERVAL_MS;
+    }
+    return redraws;
+}
+
+// play 為 true 時立即播放一批換圖，否則待命
+static void anim_batch_schedule(Animation *anim, bool play) {
+    animation_set_delay(anim, play ? 0 : ANIMATION_PARK_MS);
+    animation_set_duration(anim, play ? ANIMATION_DURATION_MS : 0);
+    animation_schedule(anim);
+}
+
+// 正常結束或中途取消都收尾至最終狀態：換上目標字形並歸位，再重新排程待命以保留動畫；
+// 卸載時 animation 已清除，不再排程，由系統於回呼後釋放
+static void anim_batch_stopped(Animation *anim, bool finished, void *context) {
+    AnimationBatch *batch = &s_app.anim_batch;
+    if (batch->restarting) {
+        batch->restarting = false;
+        anim_batch_schedule(anim, true);
+        return;
+    }
+
+    if (batch->cells) {
+        anim_batch_swap();
+        anim_batch_set_offset(0);
+        for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+            if (anim_batch_contains(ALL_DISPLAY_LAYERS[i])) {
+                ALL_DISPLAY_LAYERS[i]->anim_state = ANIM_STATE_IDLE;
+            }
+        }
+        // 最後一個影格的畫布繪製在回呼之後才進行，不計入耗時
+        perf_note_animation_frames(batch->frames, batch->dropped, batch->cost_ms + batch->frame_cost_ms);
+    }
+    Animation *animation = batch->animation;
+    memset(batch, 0, sizeof(AnimationBatch));
+    batch->animation = animation;
+    if (animation) anim_batch_schedule(anim, false);
+}
+
+static const AnimationImplementation ANIM_BATCH_IMPLEMENTATION = {
+    .setup = anim_batch_setup,
+    .update = anim_batch_update,
+};
+
+// 立即將進行中的批次收尾（觸發 anim_batch_stopped）
+static void anim_batch_finish(void) {
+    if (s_app.anim_batch.cells) {
+        perf_note_animation_cancelled();
+        animation_unschedule(s_app.anim_batch.animation);
+    }
+}
+
+// 開始新的一批：第一次時建立動畫，之後取消待命改為立即播放
+static bool anim_batch_start(void) {
+    AnimationBatch *batch = &s_app.anim_batch;
+    if (!batch->animation) {
+        batch->animation = animation_create();
+        if (!batch->animation) return false;
+
+        animation_set_curve(batch->animation, AnimationCurveLinear);
+        animation_set_implementation(batch->animation, &ANIM_BATCH_IMPLEMENTATION);
+        animation_set_handlers(batch->animation, (AnimationHandlers){.stopped = anim_batch_stopped}, NULL);
+        anim_batch_schedule(batch->animation, true);
+    } else {
+        batch->restarting = true;
+        animation_unschedule(batch->animation);
+    }
+    perf_note_animation_created();
+    return true;
+}
+
+// 卸載時收尾並停止待命；stopped 回呼見 animation 已清除便不再排程，動畫由系統釋放
+static void anim_batch_unload(void) {
+    anim_batch_finish();
+    Animation *animation = s_app.anim_batch.animation;
+    s_app.anim_batch.animation = NULL;
+    if (animation) animation_unschedule(animation);
+}
+
+// 將格子加入本次 tick 的批次，必要時開始新的一批；失敗時回傳 false
+static bool anim_batch_add(DisplayLayer *dl) {
+    AnimationBatch *batch = &s_app.anim_batch;
+    if (!batch->cells && !anim_batch_start()) return false;
+
+    batch->cells |= (uint16_t)(1u << dl->cell);
+    dl->anim_state = ANIM_STATE_FADE_OUT;
+    return true;
+}
+
+static void display_layer_update_animated(DisplayLayer *dl, GlyphId glyph) {
+    if (!display_layer_is_ready(dl)) return;
+
+    if (s_app.anim_batch.started) {
+        anim_batch_finish();
+    }
+
+    if (dl->current_glyph == GLYPH_NONE) {
+        // 圖層尚無內容，動畫期間完全不可見，直接載入並定位即可
+        display_layer_load_glyph(dl, glyph);
+        dl->current_glyph = glyph;
+        display_layer_set_position(dl, false);
         return;
     }
 
-    // GCompOpSet：保留圖片的透明通道，確保多圖層疊加時背景透明正確顯示
-    bitmap_layer_set_background_color(dl->layer, GColorClear);
-    bitmap_layer_set_compositing_mode(dl->layer, GCompOpSet);
-    layer_add_child(parent, bitmap_layer_get_layer(dl->layer));
+    // 已在本批次中等待換字時只更新目標，中點時換上的是最新的目標
+    dl->current_glyph = glyph;
+    if (anim_batch_contains(dl)) return;
+
+    if (!anim_batch_add(dl)) {
+        // 動畫建立失敗時直接靜態更新，
+        // 避免 current_glyph 已更新但 bitmap 未載入導致圖層卡死
+        APP_LOG(APP_LOG_LEVEL_WARNING, "Failed to create batch animation, falling back to static update");
+        display_layer_load_glyph(dl, glyph);
+        display_layer_set_position(dl, false);
+    }
 }
 
-static void display_layer_cleanup_animation(DisplayLayer *dl) {
-    if (!dl) return;
+static void display_layer_update_static(DisplayLayer *dl, GlyphId glyph) {
+    if (!display_layer_is_ready(dl)) return;
 
-    if (dl->animation) {
-        animation_unschedule((Animation *)dl->animation);
-        property_animation_destroy(dl->animation);
-        dl->animation = NULL;
+    if (anim_batch_contains(dl)) {
+        anim_batch_finish();
     }
-    dl->anim_state = ANIM_STATE_IDLE;
+    display_layer_set_position(dl, false);
+    display_layer_load_glyph(dl, glyph);
+    dl->current_glyph = glyph;
 }
 
-static void display_layer_load_resource(DisplayLayer *dl, uint32_t resource_id) {
-    if (!dl) return;
-
-    if (dl->bitmap) {
-        gbitmap_destroy(dl->bitmap);
-        dl->bitmap = NULL;
+// ==================== 省電策略 ====================
+//
+// 使用者開啟動畫時，以下情況仍自動改為靜態更新（不寫入 KEY_ANIMATION_ENABLED）：
+//   電量不高於 battery_threshold 且未充電、勿擾模式期間（可於設定關閉）、通知等視窗覆蓋錶盤。
+// 錶盤被覆蓋時畫布（BitmapLayer 模式為格子群組）不重繪，變更累積至重新取得焦點後一次畫出。
+// 每次降級省下一次動畫的影格、每次延後省下一次重繪，累計於 frames_saved 並於結束時寫入儲存。
+
+static bool power_policy_allows_animation(void) {
+    const PowerPolicy *power = &s_app.power;
+    if (power->obscured) return false;
+    if (power->battery_threshold > 0 && !power->battery.is_charging &&
+        power->battery.charge_percent <= power->battery_threshold) {
+        return false;
     }
+#if defined(POWER_HAS_QUIET_TIME)
+    if (power->quiet_time_static && quiet_time_is_active()) return false;
+#endif
+    return true;
+}
 
-    if (resource_id != RESOURCE_ID_NONE) {
-        dl->bitmap = gbitmap_create_with_resource(resource_id);
-        if (!dl->bitmap) {
-            APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to load resource: %lu", resource_id);
-            return;
+// 本次 tick 原本會播放動畫卻改為靜態更新：靜態更新仍需重繪一次，其餘為省下的影格
+static void power_policy_note_downgrade(void) {
+    PowerPolicy *power = &s_app.power;
+    if (!power->tick_downgraded) {
+        power->tick_downgraded = true;
+        if (power->animation_redraws > 1) {
+            power->frames_saved += power->animation_redraws - 1;
         }
-        theme_apply_to_bitmap(&s_app.theme, dl->bitmap, dl->type);
     }
+}
 
-    if (dl->layer) {
-        bitmap_layer_set_bitmap(dl->layer, dl->bitmap);
+static void power_policy_begin_tick(void) {
+    s_app.power.tick_downgraded = false;
+    s_app.power.tick_deferred = false;
+}
+
+static void power_battery_handler(BatteryChargeState charge) {
+    s_app.power.battery = charge;
+}
+
+// 即將被覆蓋：進行中的動畫直接收尾，不在看不見的畫面上播放
+static void power_will_focus(bool in_focus) {
+    if (!in_focus) {
+        s_app.power.obscured = true;
+        anim_batch_finish();
     }
 }
 
-static void display_layer_set_position(DisplayLayer *dl, bool offset_for_animation) {
-    if (!dl || !dl->layer) return;
+// 覆蓋視窗可能已蓋寫畫面，無法只補畫累積的格子，重新取得焦點時整個重畫一次
+static void power_did_focus(bool in_focus) {
+    if (!in_focus) return;
 
-    GRect frame = dl->base_frame;
-    if (offset_for_animation) {
-        frame.origin.y += ANIMATION_OFFSET_Y;
+    s_app.power.obscured = false;
+#if defined(USE_CANVAS_RENDERER)
+    canvas_mark_all_dirty();
+#else
+    cell_group_mark_dirty();
+#endif
+}
+
+static void power_policy_load(void) {
+    // 門檻與勿擾設定由 settings_load() 讀入
+    PowerPolicy *power = &s_app.power;
+    power->frames_saved = (uint32_t)persist_read_int(KEY_POWER_FRAMES_SAVED);
+    power->frames_saved_stored = power->frames_saved;
+    power->animation_redraws = anim_batch_count_redraws();
+    power->battery = battery_state_service_peek();
+
+    battery_state_service_subscribe(power_battery_handler);
+    app_focus_service_subscribe_handlers((AppFocusHandlers){
+        .will_focus = power_will_focus,
+        .did_focus = power_did_focus,
+    });
+}
+
+static void power_policy_unload(void) {
+    battery_state_service_unsubscribe();
+    app_focus_service_unsubscribe();
+    if (s_app.power.frames_saved != s_app.power.frames_saved_stored) {
+        persist_write_int(KEY_POWER_FRAMES_SAVED, (int32_t)s_app.power.frames_saved);
     }
+}
 
-    layer_set_frame(bitmap_layer_get_layer(dl->layer), frame);
+static void display_layer_update(DisplayLayer *dl, GlyphId glyph) {
+    if (!dl || dl->current_glyph == glyph) return;
+
+    if (s_app.animation_enabled && power_policy_allows_animation()) {
+        display_layer_update_animated(dl, glyph);
+    } else {
+        if (s_app.animation_enabled) power_policy_note_downgrade();
+        display_layer_update_static(dl, glyph);
+    }
 }
 
-static void display_layer_deinit(DisplayLayer *dl) {
-    if (!dl) return;
+// ==================== 秒數指示 ====================
+//
+// 選用的秒數顯示：日期列下方一條 SECONDS_BAR_HEIGHT 高的進度條，隨秒數由左而右填滿。
+// 顯示期間以 SECOND_UNIT 訂閱 tick，每秒只標記這個專用圖層需重繪，不觸碰 12 個格子；
+// 畫面內容於兩次重繪間保留（畫布模式下畫布跳過重繪，BitmapLayer 模式下以 cell_group_hold 隱藏格子群組），
+// 每秒只補畫新增的欄位，換分鐘時清除整條，重畫面積不超過進度條本身。
+// 開始顯示後 timeout_s 秒、偵測到手腕放下，或省電策略不允許動畫（低電量、勿擾、被覆蓋）時自動關閉，
+// 改回 MINUTE_UNIT；韌體沒有手腕放下的事件，顯示期間以最低取樣率訂閱加速度計資料服務（不接收批次取樣），
+// 每秒一次 accel_service_peek 的重力方向判斷；無法取樣時只靠逾時關閉。
+// 甩動手腕（輕敲事件）再次開始。圖層只在設定開啟時建立，關閉時不佔用任何堆積。
+
+// 定義於「Tick 處理」一節；開始與結束顯示時以它重新訂閱 tick
+static void tick_handler(struct tm *tick_time, TimeUnits units_changed);
+
+// 進度條位於日期列下方，上緣已讓出換圖動畫的位移，不與任何格子的繪製範圍重疊
+static GRect seconds_bar_frame(void) {
+    GRect row = layout_bottom_frame();
+    return GRect(row.origin.x, row.origin.y + row.size.h, row.size.w, SECONDS_BAR_HEIGHT);
+}
 
-    display_layer_cleanup_animation(dl);
+static int16_t seconds_progress_width(int16_t bar_w) {
+    const SecondsIndicator *seconds = &s_app.seconds;
+    return seconds->active ? (int16_t)(bar_w * seconds->second / 60) : 0;
+}
 
-    if (dl->bitmap) {
-        gbitmap_destroy(dl->bitmap);
-        dl->bitmap = NULL;
+static void seconds_update_proc(Layer *layer, GContext *ctx) {
+    SecondsIndicator *seconds = &s_app.seconds;
+    uint32_t perf_start = perf_seconds_draw_begin();
+    GRect bounds = layer_get_bounds(layer);
+    int16_t width = seconds_progress_width(bounds.size.w);
+    int16_t drawn = seconds->drawn_width;
+    uint32_t pixels = 0;
+
+    // 畫面內容保留：只補畫或清除與上次的差異
+    if (seconds->full_redraw) {
+        graphics_context_set_fill_color(ctx, s_app.theme.background);
+        graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+        pixels += bounds.size.w * bounds.size.h;
+        drawn = 0;
     }
-    
-    if (dl->layer) {
-        bitmap_layer_destroy(dl->layer);
-        dl->layer = NULL;
+    if (width != drawn) {
+        int16_t x0 = MIN(width, drawn);
+        int16_t x1 = MAX(width, drawn);
+        graphics_context_set_fill_color(ctx, width > drawn ? s_app.theme.minute_accent : s_app.theme.background);
+        graphics_fill_rect(ctx, GRect(x0, 0, x1 - x0, bounds.size.h), 0, GCornerNone);
+        pixels += (x1 - x0) * bounds.size.h;
     }
 
-    dl->current_resource_id = RESOURCE_ID_NONE;
-    dl->anim_state = ANIM_STATE_IDLE;
+    seconds->drawn_width = width;
+    seconds->full_redraw = false;
+    perf_seconds_draw_end(perf_start, pixels);
 }
 
-// ==================== 圖層遍歷系統 ====================
+// 只重畫進度條；同一次重繪中有格子變動時，格子群組會照常整個重畫
+static void seconds_mark_dirty(void) {
+#if !defined(USE_CANVAS_RENDERER)
+    cell_group_hold();
+#endif
+    layer_mark_dirty(s_app.seconds.layer);
+}
 
-typedef void (*LayerIteratorCallback)(DisplayLayer *dl, void *context);
+static void seconds_show(int second) {
+    SecondsIndicator *seconds = &s_app.seconds;
+    if (seconds->second == second) return;
+    seconds->second = (uint8_t)second;
+    seconds_mark_dirty();
+}
 
-static void iterate_all_layers(LayerIteratorCallback callback, void *context) {
-    if (!callback) return;
+static void seconds_start(void) {
+    SecondsIndicator *seconds = &s_app.seconds;
+    if (!seconds->layer || !power_policy_allows_animation()) return;
+
+    seconds->active_s = 0;
+    seconds->wrist_down_s = 0;
+    if (!seconds->active) {
+        seconds->active = true;
+        tick_timer_service_subscribe(SECOND_UNIT, tick_handler);
+        // 只以 accel_service_peek 查詢，不接收批次取樣
+        accel_data_service_subscribe(0, NULL);
+        accel_service_set_sampling_rate(ACCEL_SAMPLING_10HZ);
+        seconds_mark_dirty();
+    }
+    time_t now = time(NULL);
+    seconds_show(localtime(&now)->tm_sec);
+}
 
-    DisplayLayer *all_layers[] = {
-        &s_app.hour_layers[0], &s_app.hour_layers[1],
-        &s_app.minute_layers[0], &s_app.minute_layers[1],
-        &s_app.month_layers[0], &s_app.month_layers[1],
-        &s_app.day_layers[0], &s_app.day_layers[1],
-        &s_app.week_layer, &s_app.yue_layer, &s_app.ri_layer, &s_app.zhou_layer
-    };
+// 進度條清除一次後不再重繪
+static void seconds_stop(void) {
+    SecondsIndicator *seconds = &s_app.seconds;
+    if (!seconds->active) return;
 
-    for (size_t i = 0; i < ARRAY_LENGTH(all_layers); i++) {
-        if (all_layers[i]) {
-            callback(all_layers[i], context);
-        }
-    }
+    seconds->active = false;
+    tick_timer_service_subscribe(MINUTE_UNIT, tick_handler);
+    accel_data_service_unsubscribe();
+    seconds_mark_dirty();
 }
 
-static void iterate_animated_layers(LayerIteratorCallback callback, void *context) {
-    if (!callback) return;
+// 錶面朝上的重力分量不足（手臂垂下或錶面朝下）連續 SECONDS_WRIST_DOWN_S 秒；震動期間的取樣不採計。
+// 取樣失敗時不判斷為放下，由 timeout_s 關閉
+static bool seconds_wrist_is_down(void) {
+    SecondsIndicator *seconds = &s_app.seconds;
+    AccelData accel;
+    if (accel_service_peek(&accel) < 0 || accel.did_vibrate || accel.z <= SECONDS_WRIST_DOWN_Z) {
+        seconds->wrist_down_s = 0;
+        return false;
+    }
+    return ++seconds->wrist_down_s >= SECONDS_WRIST_DOWN_S;
+}
 
-    DisplayLayer *animated_layers[] = {
-        &s_app.hour_layers[0], &s_app.hour_layers[1],
-        &s_app.minute_layers[0], &s_app.minute_layers[1],
-        &s_app.month_layers[0], &s_app.month_layers[1],
-        &s_app.day_layers[0], &s_app.day_layers[1],
-        &s_app.week_layer
-    };
+// 由 tick_handler 每秒呼叫（未顯示時只在分鐘改變時呼叫）
+static void seconds_tick(struct tm *tick_time) {
+    SecondsIndicator *seconds = &s_app.seconds;
+    if (!seconds->active) return;
 
-    for (size_t i = 0; i < ARRAY_LENGTH(animated_layers); i++) {
-        if (animated_layers[i]) {
-            callback(animated_layers[i], context);
-        }
+    if (!power_policy_allows_animation() || ++seconds->active_s >= seconds->timeout_s || seconds_wrist_is_down()) {
+        seconds_stop();
+        return;
     }
+    seconds_show(tick_time->tm_sec);
 }
 
-// ==================== 遍歷回調函數 (Callbacks) ====================
+static void seconds_tap_handler(AccelAxisType axis, int32_t direction) {
+    seconds_start();
+}
 
-// 釋放圖層的所有資源（動畫、點陣圖、圖層物件）
-static void teardown_layer_cb(DisplayLayer *dl, void *context) {
-    display_layer_deinit(dl);
+#if defined(USE_UNOBSTRUCTED_AREA)
+// 版面重排移動或隱藏日期列時一併移動進度條；舊位置的內容須由畫布或格子群組整個重畫清除
+static void seconds_layout_changed(void) {
+    SecondsIndicator *seconds = &s_app.seconds;
+    if (!seconds->layer) return;
+
+    GRect frame = seconds_bar_frame();
+    GRect current = layer_get_frame(seconds->layer);
+    bool hidden = s_app.layout.bottom_hidden;
+    if (grect_equal(&frame, &current) && hidden == layer_get_hidden(seconds->layer)) return;
+
+    layer_set_frame(seconds->layer, frame);
+    layer_set_hidden(seconds->layer, hidden);
+#if defined(USE_CANVAS_RENDERER)
+    canvas_mark_all_dirty();
+#else
+    cell_group_mark_dirty();
+#endif
 }
+#endif
 
-// 重新套用主題色至點陣圖調色盤，並標記圖層需重繪
-static void refresh_theme_cb(DisplayLayer *dl, void *context) {
-    if (dl->bitmap) {
-        theme_apply_to_bitmap(&s_app.theme, dl->bitmap, dl->type);
-        if (dl->layer) {
-            layer_mark_dirty(bitmap_layer_get_layer(dl->layer));
-        }
+// 須在格子之後、效能計數器覆蓋層之前呼叫；設定關閉時不建立圖層
+static void seconds_load(void) {
+    SecondsIndicator *seconds = &s_app.seconds;
+    if (!seconds->enabled || seconds->layer) return;
+
+    seconds->layer = layer_create(seconds_bar_frame());
+    if (!seconds->layer) {
+        APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to create seconds layer");
+        return;
     }
+    layer_set_update_proc(seconds->layer, seconds_update_proc);
+    layer_set_hidden(seconds->layer, s_app.layout.bottom_hidden);
+    layer_add_child(window_get_root_layer(s_app.main_window), seconds->layer);
+    seconds->drawn_width = 0;
+    seconds->second = 0;
+    seconds->full_redraw = true;
+
+    accel_tap_service_subscribe(seconds_tap_handler);
+    seconds_start();
 }
 
-// 依當前動畫設定調整圖層起始位置（啟用時下偏 ANIMATION_OFFSET_Y，關閉時歸位至基準位置）
-static void set_anim_pos_cb(DisplayLayer *dl, void *context) {
-    display_layer_cleanup_animation(dl);
-    display_layer_set_position(dl, false);
+static void seconds_unload(void) {
+    SecondsIndicator *seconds = &s_app.seconds;
+    if (!seconds->layer) return;
+
+    seconds_stop();
+    accel_tap_service_unsubscribe();
+    layer_destroy(seconds->layer);
+    seconds->layer = NULL;
 }
 
-// ==================== 動畫系統 ====================
+// 設定變更：開啟時立即開始顯示；關閉時移除圖層，留在畫面上的進度條由畫布或格子群組整個重畫清除
+static void seconds_set_enabled(bool enabled) {
+    s_app.seconds.enabled = enabled;
+    if (enabled) {
+        seconds_load();
+        return;
+    }
+    seconds_unload();
+#if defined(USE_CANVAS_RENDERER)
+    canvas_mark_all_dirty();
+#else
+    cell_group_mark_dirty();
+#endif
+}
+
+#if defined(USE_UNOBSTRUCTED_AREA)
+// ==================== 版面重排 ====================
 //
-// 換圖動畫採兩段式設計：
-//   第一段（fade-out）：圖層下滑離場
-//   第二段（fade-in） ：載入新圖後上滑入場，由 anim_fade_out_stopped 串接觸發
-// 兩段動畫各佔 ANIMATION_DURATION_MS 的一半，分別使用 EaseIn 與 EaseOut 曲線。
+// Timeline Quick View 等由下方遮蔽錶盤時，貼齊下方的格子（日期列）隨可見區域底部上移；
+// 上移後會與上方的時間格子重疊時改為隱藏，留在原位被遮住。遮蔽物進出由系統動畫驅動，
+// change 回呼每影格一次移動所有格子，不另建立動畫。重排只改變格子的位置與隱藏狀態，
+// 不釋放也不重新載入任何點陣圖；進行中的換圖動畫照常播放，位移疊加在新的基準位置上。
 
-static void anim_fade_in_stopped(Animation *anim, bool finished, void *context) {
-    DisplayLayer *dl = (DisplayLayer *)context;
-    if (!dl || !dl->layer) return;
+static Layer *layout_root(void) {
+    return window_get_root_layer(s_app.main_window);
+}
 
-    if (!finished) {
-        // 若入場動畫被中斷（如分鐘快速連切），強制歸位至基準位置，避免圖層殘留偏移
-        display_layer_set_position(dl, false);
+// 可見區域高度為 visible_h 時貼齊下方的格子需上移的像素數；會與上方格子重疊時回傳 -1
+static int16_t layout_bottom_shift(int16_t visible_h) {
+    int16_t full_h = layer_get_bounds(layout_root()).size.h;
+    int16_t shift = MAX(0, full_h - visible_h);
+    int16_t top_bottom = 0;
+    int16_t bottom_top = full_h;
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        const CellLayout *cell = &CELL_LAYOUT[i];
+        if (cell->anchor == LAYOUT_ANCHOR_TOP) {
+            top_bottom = MAX(top_bottom, cell->origin.y + layout_cell_size(cell->type).h);
+        } else {
+            bottom_top = MIN(bottom_top, cell->origin.y);
+        }
     }
-
-    display_layer_cleanup_animation(dl);
+    return bottom_top - shift < top_bottom ? -1 : shift;
 }
 
-static void anim_fade_out_stopped(Animation *anim, bool finished, void *context) {
-    DisplayLayer *dl = (DisplayLayer *)context;
-    if (!dl || !dl->layer) {
-        if (dl) display_layer_cleanup_animation(dl);
-        return;
+static void layout_apply(int16_t bottom_shift, bool bottom_hidden) {
+    s_app.layout.bottom_shift = bottom_shift;
+    s_app.layout.bottom_hidden = bottom_hidden;
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        GRect base = layout_cell_frame(i);
+        bool hidden = bottom_hidden && CELL_LAYOUT[i].anchor == LAYOUT_ANCHOR_BOTTOM;
+        if (grect_equal(&base, &dl->base_frame) && hidden == dl->hidden) continue;
+
+        dl->base_frame = base;
+        if (!display_layer_is_ready(dl)) continue;
+        GRect frame = base;
+        if (anim_batch_contains(dl)) {
+            frame.origin.y += s_app.anim_batch.offset_y;
+        }
+        display_layer_set_frame(dl, frame);
+        display_layer_set_hidden(dl, hidden);
     }
-
-    if (!finished) {
-        // 若離場動畫被中斷，強制載入目標資源並歸位，避免顯示殘留的舊內容
-        display_layer_load_resource(dl, dl->current_resource_id);
-        display_layer_set_position(dl, false);
-        display_layer_cleanup_animation(dl);
-        return;
+#if defined(USE_DATE_ROW_COMPOSITOR)
+    if (s_app.date_row.layer) {
+        GRect frame = layout_bottom_frame();
+        GRect current = layer_get_frame(s_app.date_row.layer);
+        if (!grect_equal(&frame, &current)) {
+            layer_set_frame(s_app.date_row.layer, frame);
+            cell_group_mark_dirty();
+        }
     }
+#endif
+    seconds_layout_changed();
+}
 
-    Layer *layer = bitmap_layer_get_layer(dl->layer);
-    if (!layer) {
-        display_layer_cleanup_animation(dl);
-        return;
+// 依目前的可見區域重排
+static void layout_update(void) {
+    int16_t shift = layout_bottom_shift(layer_get_unobstructed_bounds(layout_root()).size.h);
+    if (shift < 0 || s_app.layout.hide_until_done) {
+        layout_apply(0, true);
+    } else {
+        layout_apply(shift, false);
     }
+}
 
-    // 第二段：載入新資源後，從當前（已下滑）位置上滑回基準位置
-    display_layer_load_resource(dl, dl->current_resource_id);
+// 遮蔽後放不下的格子立即隱藏，不隨遮蔽物上移；放得下時位置隨 change 逐影格移動
+static void layout_will_change(GRect final_unobstructed_screen_area, void *context) {
+    s_app.layout.hide_until_done = layout_bottom_shift(final_unobstructed_screen_area.size.h) < 0;
+    layout_update();
+}
 
-    GRect from = layer_get_frame(layer);
-    GRect to = dl->base_frame;
+static void layout_change(AnimationProgress progress, void *context) {
+    layout_update();
+}
 
-    dl->animation = property_animation_create_layer_frame(layer, &from, &to);
-    if (!dl->animation) {
-        APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to create fade-in animation, falling back to static update");
-        display_layer_set_position(dl, false);
-        display_layer_cleanup_animation(dl);
-        return;
-    }
+static void layout_did_change(void *context) {
+    s_app.layout.hide_until_done = false;
+    layout_update();
+}
 
-    dl->anim_state = ANIM_STATE_FADE_IN;
-    animation_set_duration((Animation *)dl->animation, ANIMATION_DURATION_MS / 2);
-    animation_set_curve((Animation *)dl->animation, AnimationCurveEaseOut);
-    animation_set_handlers((Animation *)dl->animation,
-                           (AnimationHandlers){.stopped = anim_fade_in_stopped}, dl);
-    animation_schedule((Animation *)dl->animation);
+// 須在建立格子之前呼叫：啟動時可能已有遮蔽，格子直接建立在重排後的位置
+static void layout_load(void) {
+    int16_t shift = layout_bottom_shift(layer_get_unobstructed_bounds(layout_root()).size.h);
+    s_app.layout = (Layout){.bottom_shift = MAX(0, shift), .bottom_hidden = shift < 0};
+    unobstructed_area_service_subscribe((UnobstructedAreaHandlers){
+        .will_change = layout_will_change,
+        .change = layout_change,
+        .did_change = layout_did_change,
+    }, NULL);
 }
 
-static void display_layer_update_animated(DisplayLayer *dl, uint32_t resource_id) {
-    if (!dl || !dl->layer) return;
+static void layout_unload(void) {
+    unobstructed_area_service_unsubscribe();
+}
+#else
+static inline void layout_load(void) {}
+static inline void layout_unload(void) {}
+#endif
 
-    display_layer_cleanup_animation(dl);
+// ==================== 農曆 ====================
+//
+// lunar_table.auto.h（tools/build_lunar.py 產生）為 1900–2100 每個農曆年存 3 bytes：
+// 各月大小、閏月與正月初一的公曆日序。以公曆年直接索引該年（正月初一之前屬前一個農曆年），
+// 再從正月起逐月扣除天數，至多 13 次即得月、日，全程只用整數運算。
 
-    if (dl->current_resource_id == RESOURCE_ID_NONE) {
-        // 圖層尚無內容，動畫期間完全不可見，直接載入並定位即可
-        display_layer_load_resource(dl, resource_id);
-        dl->current_resource_id = resource_id;
-        display_layer_set_position(dl, false);
-        return;
-    }
+typedef struct {
+    uint8_t month;            // 1–12
+    uint8_t day;              // 1–30
+    bool leap;                // 閏月
+} LunarDate;
+
+static uint32_t lunar_year_info(int year) {
+    const uint8_t *entry = &LUNAR_YEAR_INFO[(year - LUNAR_FIRST_YEAR) * 3];
+    return (uint32_t)entry[0] << 16 | (uint32_t)entry[1] << 8 | entry[2];
+}
 
-    Layer *layer = bitmap_layer_get_layer(dl->layer);
-    GRect from = layer_get_frame(layer);
-    dl->current_resource_id = resource_id;
+static int gregorian_year_days(int year) {
+    return (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)) ? 366 : 365;
+}
 
-    // 第一段：從當前位置下滑離場，結束後由 anim_fade_out_stopped 串接觸發入場動畫
-    GRect to = from;
-    to.origin.y += ANIMATION_OFFSET_Y;
-    
-    dl->animation = property_animation_create_layer_frame(layer, &from, &to);
-    if (dl->animation) {
-        dl->anim_state = ANIM_STATE_FADE_OUT;
-        animation_set_duration((Animation *)dl->animation, ANIMATION_DURATION_MS / 2);
-        animation_set_curve((Animation *)dl->animation, AnimationCurveEaseIn);
-        animation_set_handlers((Animation *)dl->animation,
-                              (AnimationHandlers){.stopped = anim_fade_out_stopped}, dl);
-        animation_schedule((Animation *)dl->animation);
-    } else {
-        // 動畫建立失敗時直接靜態更新，
-        // 避免 current_resource_id 已更新但 bitmap 未載入導致圖層卡死
-        APP_LOG(APP_LOG_LEVEL_WARNING, "Failed to create fade-out animation, falling back to static update");
-        display_layer_load_resource(dl, resource_id);
-        display_layer_set_position(dl, false);
+// year 為公曆年，yday 為 tm_yday；超出查表範圍時回傳 false
+static bool lunar_from_gregorian(int year, int yday, LunarDate *out) {
+    if (year < LUNAR_FIRST_YEAR || year > LUNAR_LAST_YEAR) return false;
+
+    uint32_t info = lunar_year_info(year);
+    int offset = yday - (int)LUNAR_INFO_NEW_YEAR_YDAY(info);
+    if (offset < 0) {
+        if (year == LUNAR_FIRST_YEAR) return false;
+        info = lunar_year_info(year - 1);
+        offset = gregorian_year_days(year - 1) + yday - (int)LUNAR_INFO_NEW_YEAR_YDAY(info);
+    }
+
+    int leap_month = (int)LUNAR_INFO_LEAP_MONTH(info);
+    int months = leap_month ? 13 : 12;
+    for (int i = 0; i < months; i++) {
+        int length = LUNAR_INFO_BIG_MONTH(info, i) ? 30 : 29;
+        if (offset < length) {
+            // 閏月緊接在同名月份之後：第 leap_month 個月（0 起算）即為閏月，其後月份序號減一
+            bool leap = leap_month && i == leap_month;
+            out->month = (uint8_t)((leap_month && i >= leap_month) ? i : i + 1);
+            out->day = (uint8_t)(offset + 1);
+            out->leap = leap;
+            return true;
+        }
+        offset -= length;
     }
+    return false;
 }
 
-static void display_layer_update_static(DisplayLayer *dl, uint32_t resource_id) {
-    if (!dl || !dl->layer) return;
+// ==================== 時間更新邏輯 ====================
 
-    display_layer_cleanup_animation(dl);
-    display_layer_set_position(dl, false);
-    display_layer_load_resource(dl, resource_id);
-    dl->current_resource_id = resource_id;
-}
+// 中文數字的讀法規則（點整、點半、十 / 廿 / 卅、0 點與 10 點等）由 tools/build_numerals.py
+// 展開成 numeral_tables.auto.h 中的完整查表，每個欄位只需一次索引
 
-static void display_layer_update(DisplayLayer *dl, uint32_t resource_id) {
-    if (!dl || dl->current_resource_id == resource_id) return;
+// 時間四格與日期五格，順序與 time_glyphs_at / date_glyphs_at 填入的字形相同
+static DisplayLayer *const TIME_CELLS[] = {
+    &s_app.hour_layers[0], &s_app.hour_layers[1], &s_app.minute_layers[0], &s_app.minute_layers[1],
+};
+static DisplayLayer *const DATE_CELLS[] = {
+    &s_app.month_layers[0], &s_app.month_layers[1], &s_app.day_layers[0], &s_app.day_layers[1],
+    &s_app.week_layer,
+};
+
+static void time_glyphs_at(const struct tm *t, GlyphId glyphs[ARRAY_LENGTH(TIME_CELLS)]) {
+    const uint8_t *hour = clock_is_24h_style() ? HOUR_GLYPHS_24H[t->tm_hour] : HOUR_GLYPHS_12H[t->tm_hour];
+    const uint8_t *minute = MINUTE_GLYPHS[t->tm_min];
+    glyphs[0] = hour[0];
+    glyphs[1] = hour[1];
+    glyphs[2] = minute[0];
+    glyphs[3] = minute[1];
+}
 
-    if (s_app.animation_enabled) {
-        display_layer_update_animated(dl, resource_id);
+// 回傳是否顯示農曆；農曆模式下超出查表範圍的日期改顯示公曆
+static bool date_glyphs_at(const struct tm *t, GlyphId glyphs[ARRAY_LENGTH(DATE_CELLS)]) {
+    LunarDate lunar;
+    bool show_lunar = s_app.lunar_date && lunar_from_gregorian(t->tm_year + 1900, t->tm_yday, &lunar);
+    if (show_lunar) {
+        glyphs[0] = lunar.leap ? GLYPH_RUN : GLYPH_NONE;
+        glyphs[1] = LUNAR_MONTH_GLYPHS[lunar.month];
+        glyphs[2] = LUNAR_DAY_GLYPHS[lunar.day][0];
+        glyphs[3] = LUNAR_DAY_GLYPHS[lunar.day][1];
     } else {
-        display_layer_update_static(dl, resource_id);
+        const uint8_t *month = MONTH_GLYPHS[t->tm_mon + 1];
+        const uint8_t *day = DAY_GLYPHS[t->tm_mday];
+        glyphs[0] = month[0];
+        glyphs[1] = month[1];
+        glyphs[2] = day[0];
+        glyphs[3] = day[1];
     }
+    glyphs[4] = WEEKDAY_GLYPHS[t->tm_wday];
+    return show_lunar;
 }
 
-// ==================== 時間更新邏輯 ====================
-
 static void update_time_display(struct tm *tick_time) {
     if (!tick_time) return;
 
-    int hour = tick_time->tm_hour;
-    if (!clock_is_24h_style()) {
-        hour = hour % 12;
-        if (hour == 0) hour = 12;
-    }
-
-    uint32_t hour_tens = (hour == 10) ? 
-    RESOURCE_ID_NONE : 
-    TIME_UPPERCASE_TENS_RESOURCES[hour / 10];
-    uint32_t hour_ones = (hour == 0) ? 
-    RESOURCE_ID_IMG_U0 : 
-    TIME_UPPERCASE_ONES_RESOURCES[hour % 10];
-
-    display_layer_update(&s_app.hour_layers[0], hour_tens);
-    display_layer_update(&s_app.hour_layers[1], hour_ones);
-
-    int minute = tick_time->tm_min;
-    uint32_t minute_tens = RESOURCE_ID_NONE;
-    uint32_t minute_ones = RESOURCE_ID_NONE;
-
-    // 中文時間慣用語的特殊對應：
-    //   :00 → 「點整」（如「三點整」），:30 → 「點半」（如「三點半」）
-    //   :10 → 使用 L1 + L0 組合，因為「10分」在中文口語中通常念「十分」
-    // 其餘分鐘：個位為 0 時（如 :20）十位圖本身即含「十」字，個位圖留空
-    if (minute == 0) {
-        minute_tens = RESOURCE_ID_IMG_DIAN;
-        minute_ones = RESOURCE_ID_IMG_ZHENG;
-    } else if (minute == 30) {
-        minute_tens = RESOURCE_ID_IMG_DIAN;
-        minute_ones = RESOURCE_ID_IMG_BAN;
-    } else if (minute == 10) {
-        minute_tens = RESOURCE_ID_IMG_L1;
-        minute_ones = RESOURCE_ID_IMG_L0;
-    } else {
-        int m1 = minute / 10;
-        int m2 = minute % 10;
-        minute_tens = (m2 == 0) ? TIME_LOWERCASE_ONES_RESOURCES[m1] :
-                      TIME_LOWERCASE_TENS_RESOURCES[m1];
-        minute_ones = TIME_LOWERCASE_ONES_RESOURCES[m2];
+    GlyphId glyphs[ARRAY_LENGTH(TIME_CELLS)];
+    time_glyphs_at(tick_time, glyphs);
+    for (size_t i = 0; i < ARRAY_LENGTH(TIME_CELLS); i++) {
+        display_layer_update(TIME_CELLS[i], glyphs[i]);
     }
-
-    display_layer_update(&s_app.minute_layers[0], minute_tens);
-    display_layer_update(&s_app.minute_layers[1], minute_ones);
 }
 
 static void update_date_display(struct tm *tick_time) {
     if (!tick_time) return;
 
-    int month = tick_time->tm_mon + 1;
-    int day = tick_time->tm_mday;
-    int week = tick_time->tm_wday;
-
-    uint32_t month_tens = (month > 10) ? RESOURCE_ID_IMG_SU10 : RESOURCE_ID_NONE;
-    uint32_t month_ones = DATE_UPPERCASE_ONES_RESOURCES[month % 10];
+    GlyphId glyphs[ARRAY_LENGTH(DATE_CELLS)];
+    bool show_lunar = date_glyphs_at(tick_time, glyphs);
+    for (size_t i = 0; i < ARRAY_LENGTH(DATE_CELLS); i++) {
+        display_layer_update(DATE_CELLS[i], glyphs[i]);
+    }
 
-    int d1 = day / 10;
-    int d2 = day % 10;
-    uint32_t day_tens = RESOURCE_ID_NONE;
-    uint32_t day_ones = RESOURCE_ID_NONE;
+    // 農曆的「初一」之後不接「日」，該靜態格子隨模式顯示或隱藏，位置固定不播放動畫
+    GlyphId ri = show_lunar ? GLYPH_NONE : GLYPH_RI;
+    if (s_app.ri_layer.current_glyph != ri) {
+        display_layer_update_static(&s_app.ri_layer, ri);
+    }
+}
 
-    day_ones = DATE_LOWERCASE_ONES_RESOURCES[d2];
+#if defined(USE_GLYPH_CACHE)
+// ==================== 字形預取 ====================
+//
+// 逐張載入字形時，換字的 flash 讀取與解碼原本落在分鐘交界：靜態更新時在 tick_handler 內，
+// 動畫時在批次動畫的中點影格。每次 tick 後將預取計時器對準下一個交界前 GLYPH_PREFETCH_LEAD_S 秒，
+// 依數字查表預測下一分鐘（23:59 時連同隔日的日期）會換上的字形並先載入快取，
+// 交界時 display_layer_load_glyph 便只是命中快取、換上指標。
+// 預取的項目不被借用，只能放進未被借用的槽位（見 GLYPH_CACHE_SLOTS 的備用槽）；
+// 沒有空位或預測不到的變動（設定變更、時區調整）照常於交界載入。
+//
+// 計時器只註冊一次：回呼內以 app_timer_reschedule 重新排定自己，韌體便不釋放，
+// 之後每次 tick 也只以 app_timer_reschedule 校正觸發時間，穩定運作時不再配置記憶體。
 
-    if (day > 10) {
-        if (d2 == 0) {
-            day_tens = DATE_LOWERCASE_ONES_RESOURCES[d1];
-        } else {
-            day_tens = DATE_LOWERCASE_TENS_RESOURCES[d1];
+static void prefetch_cells(DisplayLayer *const *cells, const GlyphId *glyphs, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (glyphs[i] != GLYPH_NONE && glyphs[i] != cells[i]->current_glyph) {
+            glyph_cache_prefetch(glyphs[i], cells[i]->type);
         }
     }
+}
+
+static void glyph_prefetch_timer_cb(void *context) {
+    // 先排到下一分鐘的同一時點，tick 時再校正
+    if (!app_timer_reschedule(s_app.prefetch_timer, SECONDS_PER_MINUTE * 1000)) {
+        s_app.prefetch_timer = NULL;
+    }
+
+    time_t now = time(NULL);
+    time_t boundary = (now / SECONDS_PER_MINUTE + 1) * SECONDS_PER_MINUTE;
+    struct tm current = *localtime(&now);
+    struct tm next = *localtime(&boundary);
+
+    GlyphId time_glyphs[ARRAY_LENGTH(TIME_CELLS)];
+    time_glyphs_at(&next, time_glyphs);
+    prefetch_cells(TIME_CELLS, time_glyphs, ARRAY_LENGTH(TIME_CELLS));
+
+    if (next.tm_mday != current.tm_mday) {
+        GlyphId date_glyphs[ARRAY_LENGTH(DATE_CELLS)];
+        date_glyphs_at(&next, date_glyphs);
+        prefetch_cells(DATE_CELLS, date_glyphs, ARRAY_LENGTH(DATE_CELLS));
+    }
+}
+
+// 將預取計時器對準本分鐘的預取時點；距下一個交界已不足 GLYPH_PREFETCH_LEAD_S 秒時改對準下一分鐘
+static void glyph_prefetch_schedule(void) {
+    time_t now;
+    uint16_t ms = time_ms(&now, NULL);
+    int32_t delay_ms = (int32_t)(SECONDS_PER_MINUTE - now % SECONDS_PER_MINUTE - GLYPH_PREFETCH_LEAD_S) * 1000 - ms;
+    if (delay_ms <= 0) {
+        // 略過本分鐘：改對準下一分鐘的預取時點，避免在交界前幾秒內觸發
+        delay_ms += SECONDS_PER_MINUTE * 1000;
+    }
 
-    uint32_t week_res = (week == 0) ? RESOURCE_ID_IMG_RI :
-                        DATE_LOWERCASE_ONES_RESOURCES[week];
+    if (!s_app.prefetch_timer || !app_timer_reschedule(s_app.prefetch_timer, (uint32_t)delay_ms)) {
+        s_app.prefetch_timer = app_timer_register((uint32_t)delay_ms, glyph_prefetch_timer_cb, NULL);
+    }
+}
 
-    display_layer_update(&s_app.month_layers[0], month_tens);
-    display_layer_update(&s_app.month_layers[1], month_ones);
-    display_layer_update(&s_app.day_layers[0], day_tens);
-    display_layer_update(&s_app.day_layers[1], day_ones);
-    display_layer_update(&s_app.week_layer, week_res);
+static void glyph_prefetch_cancel(void) {
+    if (s_app.prefetch_timer) {
+        app_timer_cancel(s_app.prefetch_timer);
+        s_app.prefetch_timer = NULL;
+    }
 }
+#else
+// 圖集與字形串流換字時不需載入資源，沒有可預取的內容
+static inline void glyph_prefetch_schedule(void) {}
+static inline void glyph_prefetch_cancel(void) {}
+#endif
+
+// ==================== Tick 處理 ====================
 
+// 秒數指示顯示期間每秒呼叫一次，分鐘改變時才更新格子
 static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
+    seconds_tick(tick_time);
+    if (!(units_changed & MINUTE_UNIT)) return;
+
+    uint32_t perf_start = perf_tick_begin();
+    power_policy_begin_tick();
     update_time_display(tick_time);
     if (units_changed & DAY_UNIT) {
         update_date_display(tick_time);
     }
+    glyph_prefetch_schedule();
+    perf_tick_end(perf_start, units_changed);
 }
 
-// ==================== UI 構建 ====================
+// ==================== 畫面保存與還原 ====================
+//
+// 離開時保存各格子顯示的字形；下次啟動先在原位、不播放動畫地畫出上次的畫面，
+// 再照常呼叫 update_time_display / update_date_display，只有離開期間變動的格子會播放換圖動畫。
+
+// 主題的代號：解析後的四種顏色已涵蓋深色主題與黑白時針強調色兩個開關
+static uint32_t theme_generation(void) {
+    const ThemeConfig *theme = &s_app.theme;
+    return (uint32_t)theme->background.argb << 24 | (uint32_t)theme->text.argb << 16 |
+           (uint32_t)theme->hour_accent.argb << 8 | theme->minute_accent.argb;
+}
 
-static void setup_all_layers(Layer *parent) {
-    DisplayLayer *layers[] = {
-        &s_app.hour_layers[0], &s_app.hour_layers[1],
-        &s_app.minute_layers[0], &s_app.minute_layers[1],
-        &s_app.month_layers[0], &s_app.month_layers[1],
-        &s_app.day_layers[0], &s_app.day_layers[1],
-        &s_app.week_layer, &s_app.yue_layer, &s_app.ri_layer, &s_app.zhou_layer
-    };
+static void glyph_snapshot_capture(GlyphSnapshot *snapshot) {
+    // 先清除結構尾端的填充位元組，保存時才能以 memcmp 比較
+    memset(snapshot, 0, sizeof(GlyphSnapshot));
+    snapshot->theme_generation = theme_generation();
+    snapshot->version = GLYPH_SNAPSHOT_VERSION;
+    snapshot->glyph_count = GLYPH_COUNT;
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        snapshot->glyphs[i] = (uint8_t)ALL_DISPLAY_LAYERS[i]->current_glyph;
+    }
+}
 
-    GRect frames[] = {
-        GRect(TIME_COL1_X, TIME_ROW1_Y, TIME_IMAGE_SIZE.w, TIME_IMAGE_SIZE.h),
-        GRect(TIME_COL2_X, TIME_ROW1_Y, TIME_IMAGE_SIZE.w, TIME_IMAGE_SIZE.h),
-        GRect(TIME_COL1_X, TIME_ROW2_Y, TIME_IMAGE_SIZE.w, TIME_IMAGE_SIZE.h),
-        GRect(TIME_COL2_X, TIME_ROW2_Y, TIME_IMAGE_SIZE.w, TIME_IMAGE_SIZE.h),
-        GRect(DATE_MONTH1_X, DATE_ROW_Y, DATE_IMAGE_SIZE.w, DATE_IMAGE_SIZE.h),
-        GRect(DATE_MONTH2_X, DATE_ROW_Y, DATE_IMAGE_SIZE.w, DATE_IMAGE_SIZE.h),
-        GRect(DATE_DAY1_X, DATE_ROW_Y, DATE_IMAGE_SIZE.w, DATE_IMAGE_SIZE.h),
-        GRect(DATE_DAY2_X, DATE_ROW_Y, DATE_IMAGE_SIZE.w, DATE_IMAGE_SIZE.h),
-        GRect(DATE_WEEK_X, DATE_ROW_Y, DATE_IMAGE_SIZE.w, DATE_IMAGE_SIZE.h),
-        GRect(DATE_YUE_X, DATE_ROW_Y, DATE_IMAGE_SIZE.w, DATE_IMAGE_SIZE.h),
-        GRect(DATE_RI_X, DATE_ROW_Y, DATE_IMAGE_SIZE.w, DATE_IMAGE_SIZE.h),
-        GRect(DATE_ZHOU_X, DATE_ROW_Y, DATE_IMAGE_SIZE.w, DATE_IMAGE_SIZE.h),
-    };
+// 須在 setup_all_layers 之後呼叫；已有字形的靜態格子維持不變
+static void glyph_snapshot_restore(void) {
+    GlyphSnapshot *snapshot = &s_app.glyph_snapshot;
+    int size = persist_read_data(KEY_GLYPH_SNAPSHOT, snapshot, sizeof(GlyphSnapshot));
+    if (size != (int)sizeof(GlyphSnapshot) || snapshot->version != GLYPH_SNAPSHOT_VERSION ||
+        snapshot->glyph_count != GLYPH_COUNT || snapshot->theme_generation != theme_generation()) {
+        memset(snapshot, 0, sizeof(GlyphSnapshot));
+        return;
+    }
 
-    LayerType types[] = {
-        LAYER_TYPE_HOUR, LAYER_TYPE_HOUR,
-        LAYER_TYPE_MINUTE_NORMAL, LAYER_TYPE_MINUTE_ACCENT,
-        LAYER_TYPE_DATE, LAYER_TYPE_DATE, LAYER_TYPE_DATE, LAYER_TYPE_DATE,
-        LAYER_TYPE_DATE, LAYER_TYPE_STATIC, LAYER_TYPE_STATIC, LAYER_TYPE_STATIC
-    };
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        GlyphId glyph = snapshot->glyphs[i];
+        if (glyph == GLYPH_NONE || glyph >= GLYPH_COUNT || dl->current_glyph != GLYPH_NONE) continue;
+
+        display_layer_load_glyph(dl, glyph);
+        dl->current_glyph = glyph;
+    }
+}
+
+// 進行中的動畫以目標字形保存；與 flash 中的內容相同時不寫入
+static void glyph_snapshot_save(void) {
+    GlyphSnapshot current;
+    glyph_snapshot_capture(&current);
+    if (memcmp(&current, &s_app.glyph_snapshot, sizeof(GlyphSnapshot)) == 0) return;
+
+    if (persist_write_data(KEY_GLYPH_SNAPSHOT, &current, sizeof(GlyphSnapshot)) != (int)sizeof(GlyphSnapshot)) {
+        APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to save glyph snapshot");
+        return;
+    }
+    s_app.glyph_snapshot = current;
+}
+
+// ==================== UI 構建 ====================
 
-    // 靜態資源（月、日、周）在初始化時一次性載入，不隨時間更新；
-    // 動態圖層（時、分、日期數字）初始為 NONE，由 update_time_display / update_date_display 填入
-    uint32_t static_resources[] = {
-        RESOURCE_ID_NONE, RESOURCE_ID_NONE, RESOURCE_ID_NONE, RESOURCE_ID_NONE,
-        RESOURCE_ID_NONE, RESOURCE_ID_NONE, RESOURCE_ID_NONE, RESOURCE_ID_NONE,
-        RESOURCE_ID_NONE, RESOURCE_ID_IMG_YUE, RESOURCE_ID_IMG_RI, RESOURCE_ID_IMG_ZHOU
+static void setup_all_layers(Layer *parent) {
+#if defined(USE_CANVAS_RENDERER)
+    canvas_load(parent);
+#else
+    parent = cell_group_load(parent);
+#endif
+#if defined(USE_DATE_ROW_COMPOSITOR)
+    // 日期列圖層須先於格子建立，靜態字形載入時才能標記重繪
+    date_row_load(parent);
+#endif
+
+    // 靜態字形（月、日、周）在初始化時一次性載入，不隨時間更新（農曆模式不顯示「日」）；
+    // 動態圖層（時、分、日期數字）初始為 NONE，由 glyph_snapshot_restore 與
+    // update_time_display / update_date_display 填入。所有格子一開始就在基準位置
+    GlyphId static_glyphs[] = {
+        GLYPH_NONE, GLYPH_NONE, GLYPH_NONE, GLYPH_NONE,
+        GLYPH_NONE, GLYPH_NONE, GLYPH_NONE, GLYPH_NONE,
+        GLYPH_NONE, GLYPH_YUE, s_app.lunar_date ? GLYPH_NONE : GLYPH_RI, GLYPH_ZHOU
     };
 
-    for (size_t i = 0; i < ARRAY_LENGTH(layers); i++) {
-        display_layer_init(layers[i], parent, frames[i], types[i]);
-        display_layer_set_position(layers[i], s_app.animation_enabled && types[i] != LAYER_TYPE_STATIC);
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        display_layer_init(dl, parent, layout_cell_frame(i), CELL_LAYOUT[i].type);
+        display_layer_set_hidden(dl, s_app.layout.bottom_hidden && CELL_LAYOUT[i].anchor == LAYOUT_ANCHOR_BOTTOM);
 
-        if (static_resources[i] != RESOURCE_ID_NONE) {
-            display_layer_load_resource(layers[i], static_resources[i]);
-            layers[i]->current_resource_id = static_resources[i];
+        if (static_glyphs[i] != GLYPH_NONE) {
+            display_layer_load_glyph(dl, static_glyphs[i]);
+            dl->current_glyph = static_glyphs[i];
         }
     }
 }
 
 static void teardown_all_layers(void) {
+    anim_batch_unload();
     iterate_all_layers(teardown_layer_cb, NULL);
-}
-
-static void refresh_all_layer_themes(void) {
-    iterate_all_layers(refresh_theme_cb, NULL);
+#if defined(USE_CANVAS_RENDERER)
+    canvas_unload();
+#endif
+#if defined(USE_DATE_ROW_COMPOSITOR)
+    date_row_unload();
+#endif
+#if !defined(USE_CANVAS_RENDERER)
+    cell_group_unload();
+#endif
 }
 
 static void apply_theme_to_window(void) {
-    window_set_background_color(s_app.main_window, s_app.theme.background);
-    refresh_all_layer_themes();
+    // 點陣圖共用各 LayerType 的調色盤，改寫調色盤後整個視窗重繪一次即可
+#if defined(USE_GLYPH_ATLAS)
+    glyph_atlas_apply_theme();
+#elif defined(USE_RLE_GLYPHS)
+    glyph_stream_apply_theme();
+#else
+    glyph_cache_apply_theme();
+#endif
+    layer_mark_dirty(window_get_root_layer(s_app.main_window));
+
+    // 背景色可能已改變，整個畫布或格子群組重畫
+#if defined(USE_CANVAS_RENDERER)
+    canvas_mark_all_dirty();
+#else
+    cell_group_mark_dirty();
+#endif
 }
 
 static void main_window_load(Window *window) {
     Layer *window_layer = window_get_root_layer(window);
+    // 圖集 / 快取槽位須先於圖層載入，各圖層的點陣圖皆來自它們
+#if defined(USE_GLYPH_ATLAS)
+    glyph_atlas_load();
+#elif defined(USE_RLE_GLYPHS)
+    glyph_stream_load();
+#else
+    glyph_cache_init();
+#endif
+    layout_load();
     setup_all_layers(window_layer);
+    seconds_load();
+    perf_overlay_load(window_layer);
+    glyph_snapshot_restore();
 
     time_t now = time(NULL);
     struct tm *current_time = localtime(&now);
     update_time_display(current_time);
     update_date_display(current_time);
+    glyph_prefetch_schedule();
 }
 
 static void main_window_unload(Window *window) {
+    layout_unload();
+    seconds_unload();
+    glyph_prefetch_cancel();
+    glyph_snapshot_save();
+    perf_overlay_unload();
     teardown_all_layers();
+#if defined(USE_GLYPH_ATLAS)
+    glyph_atlas_unload();
+#elif defined(USE_RLE_GLYPHS)
+    glyph_stream_unload();
+#else
+    glyph_cache_deinit();
+#endif
 }
 
 // ==================== AppMessage 處理 ====================
 
+// 手機送出的差異以 KEY_SETTINGS_BASE 標明所依據的版本，與錶盤持有的版本相同才接受新版本；
+// 不同時鍵值照常套用，但回覆舊版本，手機隨後改送完整設定。沒有 KEY_SETTINGS_BASE 的完整設定一律接受
+static void settings_sync_acknowledge(DictionaryIterator *iter) {
+    Tuple *version = dict_find(iter, KEY_SETTINGS_VERSION);
+    if (!version) return;
+
+    Tuple *base = dict_find(iter, KEY_SETTINGS_BASE);
+    if (!base || (uint32_t)base->value->int32 == s_app.sync_version) {
+        s_app.sync_version = (uint32_t)version->value->int32;
+    }
+
+    DictionaryIterator *reply;
+    if (app_message_outbox_begin(&reply) != APP_MSG_OK) {
+        // 手機收不到回覆時下次儲存會送出完整設定
+        APP_LOG(APP_LOG_LEVEL_WARNING, "Settings ack not sent");
+        return;
+    }
+    dict_write_int32(reply, KEY_SETTINGS_VERSION, (int32_t)s_app.sync_version);
+    app_message_outbox_send();
+}
+
 static void handle_settings_update(DictionaryIterator *iter) {
     if (!iter) return;
     
-    bool theme_changed = false;
+    // 完整設定與差異都可能送達，以套用前後的內容判斷哪些子系統需要更新
+    const ThemeConfig previous_theme = s_app.theme;
+    const bool previous_animation = s_app.animation_enabled;
+    const bool previous_lunar_date = s_app.lunar_date;
+    const bool previous_seconds = s_app.seconds.enabled;
 
     // 步驟一：讀取並套用各項設定
 #if defined(PBL_COLOR)
     Tuple *bg = dict_find(iter, KEY_BACKGROUND_COLOR);
     if (bg) {
         s_app.theme.background = GColorFromHEX(bg->value->int32);
-        persist_write_int(KEY_BACKGROUND_COLOR, bg->value->int32);
-        theme_changed = true;
     }
 
     Tuple *text = dict_find(iter, KEY_TEXT_COLOR);
     if (text) {
         s_app.theme.text = GColorFromHEX(text->value->int32);
-        persist_write_int(KEY_TEXT_COLOR, text->value->int32);
-        theme_changed = true;
     }
 #else
     Tuple *dark = dict_find(iter, KEY_THEME_IS_DARK);
     if (dark) {
         s_app.theme.is_dark = dark->value->int32 == 1;
-        persist_write_bool(KEY_THEME_IS_DARK, s_app.theme.is_dark);
-        theme_changed = true;
     }
 
     Tuple *hour_bg = dict_find(iter, KEY_BW_HOUR_ACCENT);
     if (hour_bg) {
         s_app.theme.bw_hour_accent = hour_bg->value->int32 == 1;
-        persist_write_bool(KEY_BW_HOUR_ACCENT, s_app.theme.bw_hour_accent);
-        theme_changed = true;
     }
 #endif
 
     Tuple *minute_color = dict_find(iter, KEY_MINUTE_COLOR);
     if (minute_color) {
 #if defined(PBL_COLOR)
-        // 黑白平台的強調色由 theme_resolve_colors() 強制計算，無需寫入 flash
+        // 黑白平台的強調色由 theme_resolve_colors() 強制計算
         s_app.theme.minute_accent = GColorFromHEX(minute_color->value->int32);
-        persist_write_int(KEY_MINUTE_COLOR, minute_color->value->int32);
 #endif
-        theme_changed = true;
     }
 
     Tuple *hour_color = dict_find(iter, KEY_HOUR_COLOR);
     if (hour_color) {
 #if defined(PBL_COLOR)
         s_app.theme.hour_accent = GColorFromHEX(hour_color->value->int32);
-        persist_write_int(KEY_HOUR_COLOR, hour_color->value->int32);
 #endif
-        theme_changed = true;
     }
 
     // 步驟二：重新計算衍生色，確保黑白平台的色彩約束覆蓋原始輸入
     theme_resolve_colors(&s_app.theme);
 
     // 步驟三：套用主題至視窗背景與所有圖層
-    if (theme_changed) {
+    if (memcmp(&previous_theme, &s_app.theme, sizeof(ThemeConfig)) != 0) {
         apply_theme_to_window();
     }
 
@@ -775,10 +3331,48 @@ static void handle_settings_update(DictionaryIterator *iter) {
     Tuple *anim = dict_find(iter, KEY_ANIMATION_ENABLED);
     if (anim) {
         s_app.animation_enabled = anim->value->int32 == 1;
-        persist_write_bool(KEY_ANIMATION_ENABLED, s_app.animation_enabled);
-
+    }
+    if (s_app.animation_enabled != previous_animation) {
+        anim_batch_finish();
         iterate_animated_layers(set_anim_pos_cb, NULL);
     }
+
+    // 步驟五：省電策略設定
+    Tuple *battery = dict_find(iter, KEY_POWER_SAVE_BATTERY);
+    if (battery) {
+        s_app.power.battery_threshold = (uint8_t)battery->value->int32;
+    }
+
+    Tuple *quiet_time = dict_find(iter, KEY_POWER_SAVE_QUIET_TIME);
+    if (quiet_time) {
+        s_app.power.quiet_time_static = quiet_time->value->int32 == 1;
+    }
+
+    // 步驟六：日期列改為農曆或公曆時立即重畫日期
+    Tuple *lunar_date = dict_find(iter, KEY_LUNAR_DATE);
+    if (lunar_date) {
+        s_app.lunar_date = lunar_date->value->int32 == 1;
+    }
+    if (s_app.lunar_date != previous_lunar_date) {
+        time_t now = time(NULL);
+        update_date_display(localtime(&now));
+    }
+
+    // 步驟七：秒數指示；開啟時立即開始顯示，關閉時移除圖層
+    Tuple *seconds = dict_find(iter, KEY_SECONDS_INDICATOR);
+    Tuple *seconds_timeout = dict_find(iter, KEY_SECONDS_TIMEOUT);
+    if (seconds_timeout) {
+        s_app.seconds.timeout_s = (uint8_t)MIN(MAX(seconds_timeout->value->int32, 1), UINT8_MAX);
+    }
+    if (seconds && (seconds->value->int32 == 1) != previous_seconds) {
+        seconds_set_enabled(seconds->value->int32 == 1);
+    }
+
+    // 步驟八：記下版本並回覆手機
+    settings_sync_acknowledge(iter);
+
+    // 步驟九：與上次寫入的設定不同時才寫入 flash
+    settings_save();
 }
 
 static void inbox_received_handler(DictionaryIterator *iter, void *context) {
@@ -798,13 +3392,8 @@ static void outbox_failed_handler(DictionaryIterator *iter, AppMessageResult rea
 static void app_init(void) {
     memset(&s_app, 0, sizeof(AppState));
     
-    theme_load_from_storage(&s_app.theme);
-    
-    if (persist_exists(KEY_ANIMATION_ENABLED)) {
-        s_app.animation_enabled = persist_read_bool(KEY_ANIMATION_ENABLED);
-    } else {
-        s_app.animation_enabled = true;
-    }
+    settings_load();
+    power_policy_load();
 
     s_app.main_window = window_create();
     if (!s_app.main_window) {
@@ -812,22 +3401,28 @@ static void app_init(void) {
         return;
     }
     
-    window_set_background_color(s_app.main_window, s_app.theme.background);
+    // 畫布或格子群組自行填滿背景色；視窗保持透明，韌體才不會在每次重繪前清除畫面
+    window_set_background_color(s_app.main_window, GColorClear);
     window_set_window_handlers(s_app.main_window, (WindowHandlers) {
         .load = main_window_load,
         .unload = main_window_unload,
     });
 
-    window_stack_push(s_app.main_window, true);
-
+    // 秒數指示於視窗載入時可能改為 SECOND_UNIT，須先訂閱
     tick_timer_service_subscribe(MINUTE_UNIT, tick_handler);
+    window_stack_push(s_app.main_window, true);
 
     app_message_register_inbox_received(inbox_received_handler);
     app_message_register_inbox_dropped(inbox_dropped_handler);
     app_message_register_outbox_failed(outbox_failed_handler);
     
-    // inbox/outbox 各 128 bytes，足以容納所有設定鍵值
+    // inbox/outbox 各 128 bytes：完整設定最多 10 個設定鍵加 KEY_SETTINGS_VERSION（122 bytes），
+    // 設定頁依平台隱藏的鍵不會送出；效能計數器匯出需較大的 outbox
+#if defined(PERF_COUNTERS)
+    AppMessageResult result = app_message_open(128, 256);
+#else
     AppMessageResult result = app_message_open(128, 128);
+#endif
     if (result != APP_MSG_OK) {
         APP_LOG(APP_LOG_LEVEL_ERROR, "AppMessage open failed: %d", (int)result);
     }
@@ -835,6 +3430,7 @@ static void app_init(void) {
 
 static void app_deinit(void) {
     tick_timer_service_unsubscribe();
+    power_policy_unload();
     app_message_deregister_callbacks();
     
     if (s_app.main_window) {
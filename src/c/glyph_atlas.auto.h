@@ -0,0 +1,588 @@
+// 由 tools/build_atlas.py 產生，請勿手動修改
+#pragma once
+
+// 字形編號：時間與日期圖層顯示的每一張字形圖片
+typedef enum {
+    GLYPH_NONE = 0,
+    GLYPH_U0,
+    GLYPH_U1,
+    GLYPH_U2,
+    GLYPH_U3,
+    GLYPH_U4,
+    GLYPH_U5,
+    GLYPH_U6,
+    GLYPH_U7,
+    GLYPH_U8,
+    GLYPH_U9,
+    GLYPH_U10,
+    GLYPH_DIAN,
+    GLYPH_ZHENG,
+    GLYPH_BAN,
+    GLYPH_L0,
+    GLYPH_L1,
+    GLYPH_L2,
+    GLYPH_L3,
+    GLYPH_L4,
+    GLYPH_L5,
+    GLYPH_L6,
+    GLYPH_L7,
+    GLYPH_L8,
+    GLYPH_L9,
+    GLYPH_L10,
+    GLYPH_L20,
+    GLYPH_L30,
+    GLYPH_SU1,
+    GLYPH_SU2,
+    GLYPH_SU3,
+    GLYPH_SU4,
+    GLYPH_SU5,
+    GLYPH_SU6,
+    GLYPH_SU7,
+    GLYPH_SU8,
+    GLYPH_SU9,
+    GLYPH_SU10,
+    GLYPH_SL1,
+    GLYPH_SL2,
+    GLYPH_SL3,
+    GLYPH_SL4,
+    GLYPH_SL5,
+    GLYPH_SL6,
+    GLYPH_SL7,
+    GLYPH_SL8,
+    GLYPH_SL9,
+    GLYPH_SL10,
+    GLYPH_SL20,
+    GLYPH_SL30,
+    GLYPH_YUE,
+    GLYPH_RI,
+    GLYPH_ZHOU,
+    GLYPH_CHU,
+    GLYPH_RUN,
+    GLYPH_SZHENG,
+    GLYPH_DONG,
+    GLYPH_LA,
+    GLYPH_COUNT,
+} GlyphId;
+
+// 字形於畫面上的放大倍數：圖集存放底稿，錶盤繪製時以最近鄰整數倍放大
+#if defined(PBL_PLATFORM_EMERY)
+#define GLYPH_TIME_SCALE 1
+#define GLYPH_DATE_SCALE 2
+#else
+#define GLYPH_TIME_SCALE 1
+#define GLYPH_DATE_SCALE 1
+#endif
+
+// 各字形的墨跡範圍於原本方形字形中的位置（底稿座標）：字形資源只存此範圍，
+// 錶盤將字形畫在格子左上角加上 origin 乘以放大倍數之處
+static const GRect GLYPH_INK_RECTS[GLYPH_COUNT] = {
+#if defined(PBL_PLATFORM_APLITE) || defined(PBL_PLATFORM_BASALT) || defined(PBL_PLATFORM_DIORITE)
+    [GLYPH_U0] = {{0, 0}, {66, 66}},
+    [GLYPH_U1] = {{0, 0}, {66, 66}},
+    [GLYPH_U2] = {{0, 0}, {66, 66}},
+    [GLYPH_U3] = {{0, 0}, {66, 66}},
+    [GLYPH_U4] = {{0, 0}, {66, 66}},
+    [GLYPH_U5] = {{0, 0}, {66, 66}},
+    [GLYPH_U6] = {{0, 0}, {66, 66}},
+    [GLYPH_U7] = {{0, 0}, {66, 66}},
+    [GLYPH_U8] = {{0, 0}, {66, 66}},
+    [GLYPH_U9] = {{0, 0}, {66, 66}},
+    [GLYPH_U10] = {{0, 0}, {66, 66}},
+    [GLYPH_DIAN] = {{0, 0}, {66, 66}},
+    [GLYPH_ZHENG] = {{0, 0}, {66, 66}},
+    [GLYPH_BAN] = {{0, 0}, {66, 66}},
+    [GLYPH_L0] = {{0, 0}, {66, 66}},
+    [GLYPH_L1] = {{0, 30}, {66, 6}},
+    [GLYPH_L2] = {{0, 6}, {66, 54}},
+    [GLYPH_L3] = {{0, 0}, {66, 66}},
+    [GLYPH_L4] = {{0, 0}, {66, 66}},
+    [GLYPH_L5] = {{0, 0}, {66, 66}},
+    [GLYPH_L6] = {{0, 0}, {66, 66}},
+    [GLYPH_L7] = {{0, 0}, {66, 66}},
+    [GLYPH_L8] = {{0, 0}, {66, 66}},
+    [GLYPH_L9] = {{0, 0}, {66, 66}},
+    [GLYPH_L10] = {{0, 0}, {66, 66}},
+    [GLYPH_L20] = {{0, 0}, {66, 66}},
+    [GLYPH_L30] = {{0, 0}, {66, 66}},
+    [GLYPH_SU1] = {{0, 0}, {11, 11}},
+    [GLYPH_SU2] = {{0, 0}, {11, 11}},
+    [GLYPH_SU3] = {{0, 0}, {11, 11}},
+    [GLYPH_SU4] = {{0, 0}, {11, 11}},
+    [GLYPH_SU5] = {{0, 0}, {11, 11}},
+    [GLYPH_SU6] = {{0, 0}, {11, 11}},
+    [GLYPH_SU7] = {{0, 0}, {11, 11}},
+    [GLYPH_SU8] = {{0, 0}, {11, 11}},
+    [GLYPH_SU9] = {{0, 0}, {11, 11}},
+    [GLYPH_SU10] = {{0, 0}, {11, 11}},
+    [GLYPH_SL1] = {{0, 5}, {11, 1}},
+    [GLYPH_SL2] = {{0, 1}, {11, 9}},
+    [GLYPH_SL3] = {{0, 0}, {11, 11}},
+    [GLYPH_SL4] = {{0, 0}, {11, 11}},
+    [GLYPH_SL5] = {{0, 0}, {11, 11}},
+    [GLYPH_SL6] = {{0, 0}, {11, 11}},
+    [GLYPH_SL7] = {{0, 0}, {11, 11}},
+    [GLYPH_SL8] = {{0, 0}, {11, 11}},
+    [GLYPH_SL9] = {{0, 0}, {11, 11}},
+    [GLYPH_SL10] = {{0, 0}, {11, 11}},
+    [GLYPH_SL20] = {{0, 0}, {11, 11}},
+    [GLYPH_SL30] = {{0, 0}, {11, 11}},
+    [GLYPH_YUE] = {{0, 0}, {10, 11}},
+    [GLYPH_RI] = {{1, 0}, {9, 11}},
+    [GLYPH_ZHOU] = {{0, 0}, {11, 11}},
+    [GLYPH_CHU] = {{0, 0}, {11, 11}},
+    [GLYPH_RUN] = {{0, 0}, {11, 11}},
+    [GLYPH_SZHENG] = {{0, 0}, {11, 11}},
+    [GLYPH_DONG] = {{0, 0}, {11, 11}},
+    [GLYPH_LA] = {{0, 0}, {11, 11}},
+#else
+    [GLYPH_U0] = {{0, 0}, {88, 88}},
+    [GLYPH_U1] = {{0, 0}, {88, 88}},
+    [GLYPH_U2] = {{0, 0}, {88, 88}},
+    [GLYPH_U3] = {{0, 0}, {88, 88}},
+    [GLYPH_U4] = {{0, 0}, {88, 88}},
+    [GLYPH_U5] = {{0, 0}, {88, 88}},
+    [GLYPH_U6] = {{0, 0}, {88, 88}},
+    [GLYPH_U7] = {{0, 0}, {88, 88}},
+    [GLYPH_U8] = {{0, 0}, {88, 88}},
+    [GLYPH_U9] = {{0, 0}, {88, 88}},
+    [GLYPH_U10] = {{0, 0}, {88, 88}},
+    [GLYPH_DIAN] = {{0, 0}, {88, 88}},
+    [GLYPH_ZHENG] = {{0, 0}, {88, 88}},
+    [GLYPH_BAN] = {{0, 0}, {88, 88}},
+    [GLYPH_L0] = {{0, 0}, {88, 88}},
+    [GLYPH_L1] = {{0, 40}, {88, 8}},
+    [GLYPH_L2] = {{0, 8}, {88, 72}},
+    [GLYPH_L3] = {{0, 0}, {88, 88}},
+    [GLYPH_L4] = {{0, 0}, {88, 88}},
+    [GLYPH_L5] = {{0, 0}, {88, 88}},
+    [GLYPH_L6] = {{0, 0}, {88, 88}},
+    [GLYPH_L7] = {{0, 0}, {88, 88}},
+    [GLYPH_L8] = {{0, 0}, {88, 88}},
+    [GLYPH_L9] = {{0, 0}, {88, 88}},
+    [GLYPH_L10] = {{0, 0}, {88, 88}},
+    [GLYPH_L20] = {{0, 0}, {88, 88}},
+    [GLYPH_L30] = {{0, 0}, {88, 88}},
+    [GLYPH_SU1] = {{0, 0}, {11, 11}},
+    [GLYPH_SU2] = {{0, 0}, {11, 11}},
+    [GLYPH_SU3] = {{0, 0}, {11, 11}},
+    [GLYPH_SU4] = {{0, 0}, {11, 11}},
+    [GLYPH_SU5] = {{0, 0}, {11, 11}},
+    [GLYPH_SU6] = {{0, 0}, {11, 11}},
+    [GLYPH_SU7] = {{0, 0}, {11, 11}},
+    [GLYPH_SU8] = {{0, 0}, {11, 11}},
+    [GLYPH_SU9] = {{0, 0}, {11, 11}},
+    [GLYPH_SU10] = {{0, 0}, {11, 11}},
+    [GLYPH_SL1] = {{0, 5}, {11, 1}},
+    [GLYPH_SL2] = {{0, 1}, {11, 9}},
+    [GLYPH_SL3] = {{0, 0}, {11, 11}},
+    [GLYPH_SL4] = {{0, 0}, {11, 11}},
+    [GLYPH_SL5] = {{0, 0}, {11, 11}},
+    [GLYPH_SL6] = {{0, 0}, {11, 11}},
+    [GLYPH_SL7] = {{0, 0}, {11, 11}},
+    [GLYPH_SL8] = {{0, 0}, {11, 11}},
+    [GLYPH_SL9] = {{0, 0}, {11, 11}},
+    [GLYPH_SL10] = {{0, 0}, {11, 11}},
+    [GLYPH_SL20] = {{0, 0}, {11, 11}},
+    [GLYPH_SL30] = {{0, 0}, {11, 11}},
+    [GLYPH_YUE] = {{0, 0}, {10, 11}},
+    [GLYPH_RI] = {{1, 0}, {9, 11}},
+    [GLYPH_ZHOU] = {{0, 0}, {11, 11}},
+    [GLYPH_CHU] = {{0, 0}, {11, 11}},
+    [GLYPH_RUN] = {{0, 0}, {11, 11}},
+    [GLYPH_SZHENG] = {{0, 0}, {11, 11}},
+    [GLYPH_DONG] = {{0, 0}, {11, 11}},
+    [GLYPH_LA] = {{0, 0}, {11, 11}},
+#endif
+};
+
+#if defined(USE_RLE_GLYPHS)
+
+// 字形串流的每個位元組為一段同色像素：高位元為語意色插槽，低 GLYPH_RLE_SLOT_SHIFT 位元為長度減一
+#define GLYPH_RLE_SLOT_SHIFT 6
+#define GLYPH_RLE_LENGTH_MASK 0x3F
+
+// 字形串流：各字形於 GLYPH_RLE 資源中的位置、位元組數與底稿尺寸
+typedef struct {
+    uint16_t offset;
+    uint16_t size;
+    uint8_t width;
+    uint8_t height;
+} GlyphRle;
+
+static const GlyphRle GLYPH_RLE_INDEX[GLYPH_COUNT] = {
+#if defined(PBL_PLATFORM_APLITE) || defined(PBL_PLATFORM_DIORITE)
+    [GLYPH_U0] = {0, 229, 66, 66},
+    [GLYPH_U1] = {229, 160, 66, 66},
+    [GLYPH_U2] = {389, 264, 66, 66},
+    [GLYPH_U3] = {653, 317, 66, 66},
+    [GLYPH_U4] = {970, 332, 66, 66},
+    [GLYPH_U5] = {1302, 512, 66, 66},
+    [GLYPH_U6] = {1814, 417, 66, 66},
+    [GLYPH_U7] = {2231, 325, 66, 66},
+    [GLYPH_U8] = {2556, 584, 66, 66},
+    [GLYPH_U9] = {3140, 364, 66, 66},
+    [GLYPH_U10] = {3504, 381, 66, 66},
+    [GLYPH_DIAN] = {3885, 323, 66, 66},
+    [GLYPH_ZHENG] = {4208, 276, 66, 66},
+    [GLYPH_BAN] = {4484, 177, 66, 66},
+    [GLYPH_L0] = {4661, 207, 66, 66},
+    [GLYPH_L1] = {4868, 7, 66, 6},
+    [GLYPH_L2] = {4875, 63, 66, 54},
+    [GLYPH_L3] = {4938, 82, 66, 66},
+    [GLYPH_L4] = {5020, 253, 66, 66},
+    [GLYPH_L5] = {5273, 188, 66, 66},
+    [GLYPH_L6] = {5461, 159, 66, 66},
+    [GLYPH_L7] = {5620, 157, 66, 66},
+    [GLYPH_L8] = {5777, 194, 66, 66},
+    [GLYPH_L9] = {5971, 240, 66, 66},
+    [GLYPH_L10] = {6211, 129, 66, 66},
+    [GLYPH_L20] = {6340, 237, 66, 66},
+    [GLYPH_L30] = {6577, 369, 66, 66},
+    [GLYPH_SU1] = {6946, 28, 11, 11},
+    [GLYPH_SU2] = {6974, 42, 11, 11},
+    [GLYPH_SU3] = {7016, 47, 11, 11},
+    [GLYPH_SU4] = {7063, 49, 11, 11},
+    [GLYPH_SU5] = {7112, 54, 11, 11},
+    [GLYPH_SU6] = {7166, 57, 11, 11},
+    [GLYPH_SU7] = {7223, 45, 11, 11},
+    [GLYPH_SU8] = {7268, 82, 11, 11},
+    [GLYPH_SU9] = {7350, 48, 11, 11},
+    [GLYPH_SU10] = {7398, 55, 11, 11},
+    [GLYPH_SL1] = {7453, 1, 11, 1},
+    [GLYPH_SL2] = {7454, 5, 11, 9},
+    [GLYPH_SL3] = {7459, 6, 11, 11},
+    [GLYPH_SL4] = {7465, 41, 11, 11},
+    [GLYPH_SL5] = {7506, 32, 11, 11},
+    [GLYPH_SL6] = {7538, 24, 11, 11},
+    [GLYPH_SL7] = {7562, 27, 11, 11},
+    [GLYPH_SL8] = {7589, 34, 11, 11},
+    [GLYPH_SL9] = {7623, 40, 11, 11},
+    [GLYPH_SL10] = {7663, 23, 11, 11},
+    [GLYPH_SL20] = {7686, 41, 11, 11},
+    [GLYPH_SL30] = {7727, 63, 11, 11},
+    [GLYPH_YUE] = {7790, 36, 10, 11},
+    [GLYPH_RI] = {7826, 17, 9, 11},
+    [GLYPH_ZHOU] = {7843, 63, 11, 11},
+    [GLYPH_CHU] = {7906, 59, 11, 11},
+    [GLYPH_RUN] = {7965, 37, 11, 11},
+    [GLYPH_SZHENG] = {8002, 34, 11, 11},
+    [GLYPH_DONG] = {8036, 37, 11, 11},
+    [GLYPH_LA] = {8073, 81, 11, 11},
+#elif defined(PBL_PLATFORM_BASALT)
+    [GLYPH_U0] = {0, 221, 66, 66},
+    [GLYPH_U1] = {221, 157, 66, 66},
+    [GLYPH_U2] = {378, 254, 66, 66},
+    [GLYPH_U3] = {632, 269, 66, 66},
+    [GLYPH_U4] = {901, 300, 66, 66},
+    [GLYPH_U5] = {1201, 324, 66, 66},
+    [GLYPH_U6] = {1525, 349, 66, 66},
+    [GLYPH_U7] = {1874, 262, 66, 66},
+    [GLYPH_U8] = {2136, 504, 66, 66},
+    [GLYPH_U9] = {2640, 288, 66, 66},
+    [GLYPH_U10] = {2928, 325, 66, 66},
+    [GLYPH_DIAN] = {3253, 323, 66, 66},
+    [GLYPH_ZHENG] = {3576, 276, 66, 66},
+    [GLYPH_BAN] = {3852, 177, 66, 66},
+    [GLYPH_L0] = {4029, 207, 66, 66},
+    [GLYPH_L1] = {4236, 7, 66, 6},
+    [GLYPH_L2] = {4243, 63, 66, 54},
+    [GLYPH_L3] = {4306, 82, 66, 66},
+    [GLYPH_L4] = {4388, 253, 66, 66},
+    [GLYPH_L5] = {4641, 188, 66, 66},
+    [GLYPH_L6] = {4829, 159, 66, 66},
+    [GLYPH_L7] = {4988, 157, 66, 66},
+    [GLYPH_L8] = {5145, 194, 66, 66},
+    [GLYPH_L9] = {5339, 240, 66, 66},
+    [GLYPH_L10] = {5579, 129, 66, 66},
+    [GLYPH_L20] = {5708, 237, 66, 66},
+    [GLYPH_L30] = {5945, 369, 66, 66},
+    [GLYPH_SU1] = {6314, 28, 11, 11},
+    [GLYPH_SU2] = {6342, 42, 11, 11},
+    [GLYPH_SU3] = {6384, 47, 11, 11},
+    [GLYPH_SU4] = {6431, 49, 11, 11},
+    [GLYPH_SU5] = {6480, 54, 11, 11},
+    [GLYPH_SU6] = {6534, 57, 11, 11},
+    [GLYPH_SU7] = {6591, 45, 11, 11},
+    [GLYPH_SU8] = {6636, 82, 11, 11},
+    [GLYPH_SU9] = {6718, 48, 11, 11},
+    [GLYPH_SU10] = {6766, 55, 11, 11},
+    [GLYPH_SL1] = {6821, 1, 11, 1},
+    [GLYPH_SL2] = {6822, 5, 11, 9},
+    [GLYPH_SL3] = {6827, 6, 11, 11},
+    [GLYPH_SL4] = {6833, 41, 11, 11},
+    [GLYPH_SL5] = {6874, 32, 11, 11},
+    [GLYPH_SL6] = {6906, 24, 11, 11},
+    [GLYPH_SL7] = {6930, 27, 11, 11},
+    [GLYPH_SL8] = {6957, 34, 11, 11},
+    [GLYPH_SL9] = {6991, 40, 11, 11},
+    [GLYPH_SL10] = {7031, 23, 11, 11},
+    [GLYPH_SL20] = {7054, 41, 11, 11},
+    [GLYPH_SL30] = {7095, 63, 11, 11},
+    [GLYPH_YUE] = {7158, 36, 10, 11},
+    [GLYPH_RI] = {7194, 17, 9, 11},
+    [GLYPH_ZHOU] = {7211, 63, 11, 11},
+    [GLYPH_CHU] = {7274, 59, 11, 11},
+    [GLYPH_RUN] = {7333, 37, 11, 11},
+    [GLYPH_SZHENG] = {7370, 34, 11, 11},
+    [GLYPH_DONG] = {7404, 37, 11, 11},
+    [GLYPH_LA] = {7441, 81, 11, 11},
+#else
+    [GLYPH_U0] = {0, 321, 88, 88},
+    [GLYPH_U1] = {321, 251, 88, 88},
+    [GLYPH_U2] = {572, 355, 88, 88},
+    [GLYPH_U3] = {927, 371, 88, 88},
+    [GLYPH_U4] = {1298, 407, 88, 88},
+    [GLYPH_U5] = {1705, 432, 88, 88},
+    [GLYPH_U6] = {2137, 481, 88, 88},
+    [GLYPH_U7] = {2618, 357, 88, 88},
+    [GLYPH_U8] = {2975, 672, 88, 88},
+    [GLYPH_U9] = {3647, 391, 88, 88},
+    [GLYPH_U10] = {4038, 441, 88, 88},
+    [GLYPH_DIAN] = {4479, 433, 88, 88},
+    [GLYPH_ZHENG] = {4912, 390, 88, 88},
+    [GLYPH_BAN] = {5302, 297, 88, 88},
+    [GLYPH_L0] = {5599, 299, 88, 88},
+    [GLYPH_L1] = {5898, 11, 88, 8},
+    [GLYPH_L2] = {5909, 113, 88, 72},
+    [GLYPH_L3] = {6022, 140, 88, 88},
+    [GLYPH_L4] = {6162, 367, 88, 88},
+    [GLYPH_L5] = {6529, 283, 88, 88},
+    [GLYPH_L6] = {6812, 244, 88, 88},
+    [GLYPH_L7] = {7056, 258, 88, 88},
+    [GLYPH_L8] = {7314, 298, 88, 88},
+    [GLYPH_L9] = {7612, 335, 88, 88},
+    [GLYPH_L10] = {7947, 251, 88, 88},
+    [GLYPH_L20] = {8198, 317, 88, 88},
+    [GLYPH_L30] = {8515, 493, 88, 88},
+    [GLYPH_SU1] = {9008, 28, 11, 11},
+    [GLYPH_SU2] = {9036, 42, 11, 11},
+    [GLYPH_SU3] = {9078, 47, 11, 11},
+    [GLYPH_SU4] = {9125, 49, 11, 11},
+    [GLYPH_SU5] = {9174, 54, 11, 11},
+    [GLYPH_SU6] = {9228, 57, 11, 11},
+    [GLYPH_SU7] = {9285, 45, 11, 11},
+    [GLYPH_SU8] = {9330, 82, 11, 11},
+    [GLYPH_SU9] = {9412, 48, 11, 11},
+    [GLYPH_SU10] = {9460, 55, 11, 11},
+    [GLYPH_SL1] = {9515, 1, 11, 1},
+    [GLYPH_SL2] = {9516, 5, 11, 9},
+    [GLYPH_SL3] = {9521, 6, 11, 11},
+    [GLYPH_SL4] = {9527, 41, 11, 11},
+    [GLYPH_SL5] = {9568, 32, 11, 11},
+    [GLYPH_SL6] = {9600, 24, 11, 11},
+    [GLYPH_SL7] = {9624, 27, 11, 11},
+    [GLYPH_SL8] = {9651, 34, 11, 11},
+    [GLYPH_SL9] = {9685, 40, 11, 11},
+    [GLYPH_SL10] = {9725, 23, 11, 11},
+    [GLYPH_SL20] = {9748, 41, 11, 11},
+    [GLYPH_SL30] = {9789, 63, 11, 11},
+    [GLYPH_YUE] = {9852, 36, 10, 11},
+    [GLYPH_RI] = {9888, 17, 9, 11},
+    [GLYPH_ZHOU] = {9905, 63, 11, 11},
+    [GLYPH_CHU] = {9968, 59, 11, 11},
+    [GLYPH_RUN] = {10027, 37, 11, 11},
+    [GLYPH_SZHENG] = {10064, 34, 11, 11},
+    [GLYPH_DONG] = {10098, 37, 11, 11},
+    [GLYPH_LA] = {10135, 81, 11, 11},
+#endif
+};
+
+#elif defined(PBL_PLATFORM_APLITE)
+
+// 逐張資源載入時，字形編號對應的資源 ID
+static const uint32_t GLYPH_RESOURCE_IDS[GLYPH_COUNT] = {
+    [GLYPH_U0] = RESOURCE_ID_IMG_U0,
+    [GLYPH_U1] = RESOURCE_ID_IMG_U1,
+    [GLYPH_U2] = RESOURCE_ID_IMG_U2,
+    [GLYPH_U3] = RESOURCE_ID_IMG_U3,
+    [GLYPH_U4] = RESOURCE_ID_IMG_U4,
+    [GLYPH_U5] = RESOURCE_ID_IMG_U5,
+    [GLYPH_U6] = RESOURCE_ID_IMG_U6,
+    [GLYPH_U7] = RESOURCE_ID_IMG_U7,
+    [GLYPH_U8] = RESOURCE_ID_IMG_U8,
+    [GLYPH_U9] = RESOURCE_ID_IMG_U9,
+    [GLYPH_U10] = RESOURCE_ID_IMG_U10,
+    [GLYPH_DIAN] = RESOURCE_ID_IMG_DIAN,
+    [GLYPH_ZHENG] = RESOURCE_ID_IMG_ZHENG,
+    [GLYPH_BAN] = RESOURCE_ID_IMG_BAN,
+    [GLYPH_L0] = RESOURCE_ID_IMG_L0,
+    [GLYPH_L1] = RESOURCE_ID_IMG_L1,
+    [GLYPH_L2] = RESOURCE_ID_IMG_L2,
+    [GLYPH_L3] = RESOURCE_ID_IMG_L3,
+    [GLYPH_L4] = RESOURCE_ID_IMG_L4,
+    [GLYPH_L5] = RESOURCE_ID_IMG_L5,
+    [GLYPH_L6] = RESOURCE_ID_IMG_L6,
+    [GLYPH_L7] = RESOURCE_ID_IMG_L7,
+    [GLYPH_L8] = RESOURCE_ID_IMG_L8,
+    [GLYPH_L9] = RESOURCE_ID_IMG_L9,
+    [GLYPH_L10] = RESOURCE_ID_IMG_L10,
+    [GLYPH_L20] = RESOURCE_ID_IMG_L20,
+    [GLYPH_L30] = RESOURCE_ID_IMG_L30,
+    [GLYPH_SU1] = RESOURCE_ID_IMG_SU1,
+    [GLYPH_SU2] = RESOURCE_ID_IMG_SU2,
+    [GLYPH_SU3] = RESOURCE_ID_IMG_SU3,
+    [GLYPH_SU4] = RESOURCE_ID_IMG_SU4,
+    [GLYPH_SU5] = RESOURCE_ID_IMG_SU5,
+    [GLYPH_SU6] = RESOURCE_ID_IMG_SU6,
+    [GLYPH_SU7] = RESOURCE_ID_IMG_SU7,
+    [GLYPH_SU8] = RESOURCE_ID_IMG_SU8,
+    [GLYPH_SU9] = RESOURCE_ID_IMG_SU9,
+    [GLYPH_SU10] = RESOURCE_ID_IMG_SU10,
+    [GLYPH_SL1] = RESOURCE_ID_IMG_SL1,
+    [GLYPH_SL2] = RESOURCE_ID_IMG_SL2,
+    [GLYPH_SL3] = RESOURCE_ID_IMG_SL3,
+    [GLYPH_SL4] = RESOURCE_ID_IMG_SL4,
+    [GLYPH_SL5] = RESOURCE_ID_IMG_SL5,
+    [GLYPH_SL6] = RESOURCE_ID_IMG_SL6,
+    [GLYPH_SL7] = RESOURCE_ID_IMG_SL7,
+    [GLYPH_SL8] = RESOURCE_ID_IMG_SL8,
+    [GLYPH_SL9] = RESOURCE_ID_IMG_SL9,
+    [GLYPH_SL10] = RESOURCE_ID_IMG_SL10,
+    [GLYPH_SL20] = RESOURCE_ID_IMG_SL20,
+    [GLYPH_SL30] = RESOURCE_ID_IMG_SL30,
+    [GLYPH_YUE] = RESOURCE_ID_IMG_YUE,
+    [GLYPH_RI] = RESOURCE_ID_IMG_RI,
+    [GLYPH_ZHOU] = RESOURCE_ID_IMG_ZHOU,
+    [GLYPH_CHU] = RESOURCE_ID_IMG_CHU,
+    [GLYPH_RUN] = RESOURCE_ID_IMG_RUN,
+    [GLYPH_SZHENG] = RESOURCE_ID_IMG_SZHENG,
+    [GLYPH_DONG] = RESOURCE_ID_IMG_DONG,
+    [GLYPH_LA] = RESOURCE_ID_IMG_LA,
+};
+
+// 逐張字形為裁切後的原始像素資料（尺寸見 GLYPH_INK_RECTS，每列 (寬 * 位元數 + 7) / 8 bytes，
+// 像素值依序為透明、Black、White 插槽）；時、分、日期字形各有固定的位元深度，尺寸為該類的最大值
+#define GLYPH_RAW_HOUR_WIDTH 66
+#define GLYPH_RAW_HOUR_HEIGHT 66
+#define GLYPH_RAW_HOUR_BITS 2
+#define GLYPH_RAW_MINUTE_WIDTH 66
+#define GLYPH_RAW_MINUTE_HEIGHT 66
+#define GLYPH_RAW_MINUTE_BITS 1
+#define GLYPH_RAW_DATE_WIDTH 11
+#define GLYPH_RAW_DATE_HEIGHT 11
+#define GLYPH_RAW_DATE_BITS 1
+
+#else
+
+// 各字形於圖集中的位置
+static const GRect GLYPH_ATLAS_RECTS[GLYPH_COUNT] = {
+#if defined(PBL_PLATFORM_BASALT) || defined(PBL_PLATFORM_DIORITE)
+    [GLYPH_U0] = {{0, 0}, {66, 66}},
+    [GLYPH_U1] = {{66, 0}, {66, 66}},
+    [GLYPH_U2] = {{0, 66}, {66, 66}},
+    [GLYPH_U3] = {{66, 66}, {66, 66}},
+    [GLYPH_U4] = {{0, 132}, {66, 66}},
+    [GLYPH_U5] = {{66, 132}, {66, 66}},
+    [GLYPH_U6] = {{0, 198}, {66, 66}},
+    [GLYPH_U7] = {{66, 198}, {66, 66}},
+    [GLYPH_U8] = {{0, 264}, {66, 66}},
+    [GLYPH_U9] = {{66, 264}, {66, 66}},
+    [GLYPH_U10] = {{0, 330}, {66, 66}},
+    [GLYPH_DIAN] = {{66, 330}, {66, 66}},
+    [GLYPH_ZHENG] = {{0, 396}, {66, 66}},
+    [GLYPH_BAN] = {{66, 396}, {66, 66}},
+    [GLYPH_L0] = {{0, 462}, {66, 66}},
+    [GLYPH_L1] = {{52, 880}, {66, 6}},
+    [GLYPH_L2] = {{66, 792}, {66, 54}},
+    [GLYPH_L3] = {{66, 462}, {66, 66}},
+    [GLYPH_L4] = {{0, 528}, {66, 66}},
+    [GLYPH_L5] = {{66, 528}, {66, 66}},
+    [GLYPH_L6] = {{0, 594}, {66, 66}},
+    [GLYPH_L7] = {{66, 594}, {66, 66}},
+    [GLYPH_L8] = {{0, 660}, {66, 66}},
+    [GLYPH_L9] = {{66, 660}, {66, 66}},
+    [GLYPH_L10] = {{0, 726}, {66, 66}},
+    [GLYPH_L20] = {{66, 726}, {66, 66}},
+    [GLYPH_L30] = {{0, 792}, {66, 66}},
+    [GLYPH_SU1] = {{0, 858}, {11, 11}},
+    [GLYPH_SU2] = {{11, 858}, {11, 11}},
+    [GLYPH_SU3] = {{22, 858}, {11, 11}},
+    [GLYPH_SU4] = {{33, 858}, {11, 11}},
+    [GLYPH_SU5] = {{44, 858}, {11, 11}},
+    [GLYPH_SU6] = {{55, 858}, {11, 11}},
+    [GLYPH_SU7] = {{66, 858}, {11, 11}},
+    [GLYPH_SU8] = {{77, 858}, {11, 11}},
+    [GLYPH_SU9] = {{88, 858}, {11, 11}},
+    [GLYPH_SU10] = {{99, 858}, {11, 11}},
+    [GLYPH_SL1] = {{118, 880}, {11, 1}},
+    [GLYPH_SL2] = {{41, 880}, {11, 9}},
+    [GLYPH_SL3] = {{110, 858}, {11, 11}},
+    [GLYPH_SL4] = {{121, 858}, {11, 11}},
+    [GLYPH_SL5] = {{0, 869}, {11, 11}},
+    [GLYPH_SL6] = {{11, 869}, {11, 11}},
+    [GLYPH_SL7] = {{22, 869}, {11, 11}},
+    [GLYPH_SL8] = {{33, 869}, {11, 11}},
+    [GLYPH_SL9] = {{44, 869}, {11, 11}},
+    [GLYPH_SL10] = {{55, 869}, {11, 11}},
+    [GLYPH_SL20] = {{66, 869}, {11, 11}},
+    [GLYPH_SL30] = {{77, 869}, {11, 11}},
+    [GLYPH_YUE] = {{22, 880}, {10, 11}},
+    [GLYPH_RI] = {{32, 880}, {9, 11}},
+    [GLYPH_ZHOU] = {{88, 869}, {11, 11}},
+    [GLYPH_CHU] = {{99, 869}, {11, 11}},
+    [GLYPH_RUN] = {{110, 869}, {11, 11}},
+    [GLYPH_SZHENG] = {{121, 869}, {11, 11}},
+    [GLYPH_DONG] = {{0, 880}, {11, 11}},
+    [GLYPH_LA] = {{11, 880}, {11, 11}},
+#else
+    [GLYPH_U0] = {{0, 0}, {88, 88}},
+    [GLYPH_U1] = {{0, 88}, {88, 88}},
+    [GLYPH_U2] = {{0, 176}, {88, 88}},
+    [GLYPH_U3] = {{0, 264}, {88, 88}},
+    [GLYPH_U4] = {{0, 352}, {88, 88}},
+    [GLYPH_U5] = {{0, 440}, {88, 88}},
+    [GLYPH_U6] = {{0, 528}, {88, 88}},
+    [GLYPH_U7] = {{0, 616}, {88, 88}},
+    [GLYPH_U8] = {{0, 704}, {88, 88}},
+    [GLYPH_U9] = {{0, 792}, {88, 88}},
+    [GLYPH_U10] = {{0, 880}, {88, 88}},
+    [GLYPH_DIAN] = {{0, 968}, {88, 88}},
+    [GLYPH_ZHENG] = {{0, 1056}, {88, 88}},
+    [GLYPH_BAN] = {{0, 1144}, {88, 88}},
+    [GLYPH_L0] = {{0, 1232}, {88, 88}},
+    [GLYPH_L1] = {{0, 2316}, {88, 8}},
+    [GLYPH_L2] = {{0, 2200}, {88, 72}},
+    [GLYPH_L3] = {{0, 1320}, {88, 88}},
+    [GLYPH_L4] = {{0, 1408}, {88, 88}},
+    [GLYPH_L5] = {{0, 1496}, {88, 88}},
+    [GLYPH_L6] = {{0, 1584}, {88, 88}},
+    [GLYPH_L7] = {{0, 1672}, {88, 88}},
+    [GLYPH_L8] = {{0, 1760}, {88, 88}},
+    [GLYPH_L9] = {{0, 1848}, {88, 88}},
+    [GLYPH_L10] = {{0, 1936}, {88, 88}},
+    [GLYPH_L20] = {{0, 2024}, {88, 88}},
+    [GLYPH_L30] = {{0, 2112}, {88, 88}},
+    [GLYPH_SU1] = {{0, 2272}, {11, 11}},
+    [GLYPH_SU2] = {{11, 2272}, {11, 11}},
+    [GLYPH_SU3] = {{22, 2272}, {11, 11}},
+    [GLYPH_SU4] = {{33, 2272}, {11, 11}},
+    [GLYPH_SU5] = {{44, 2272}, {11, 11}},
+    [GLYPH_SU6] = {{55, 2272}, {11, 11}},
+    [GLYPH_SU7] = {{66, 2272}, {11, 11}},
+    [GLYPH_SU8] = {{77, 2272}, {11, 11}},
+    [GLYPH_SU9] = {{0, 2283}, {11, 11}},
+    [GLYPH_SU10] = {{11, 2283}, {11, 11}},
+    [GLYPH_SL1] = {{0, 2324}, {11, 1}},
+    [GLYPH_SL2] = {{41, 2305}, {11, 9}},
+    [GLYPH_SL3] = {{22, 2283}, {11, 11}},
+    [GLYPH_SL4] = {{33, 2283}, {11, 11}},
+    [GLYPH_SL5] = {{44, 2283}, {11, 11}},
+    [GLYPH_SL6] = {{55, 2283}, {11, 11}},
+    [GLYPH_SL7] = {{66, 2283}, {11, 11}},
+    [GLYPH_SL8] = {{77, 2283}, {11, 11}},
+    [GLYPH_SL9] = {{0, 2294}, {11, 11}},
+    [GLYPH_SL10] = {{11, 2294}, {11, 11}},
+    [GLYPH_SL20] = {{22, 2294}, {11, 11}},
+    [GLYPH_SL30] = {{33, 2294}, {11, 11}},
+    [GLYPH_YUE] = {{22, 2305}, {10, 11}},
+    [GLYPH_RI] = {{32, 2305}, {9, 11}},
+    [GLYPH_ZHOU] = {{44, 2294}, {11, 11}},
+    [GLYPH_CHU] = {{55, 2294}, {11, 11}},
+    [GLYPH_RUN] = {{66, 2294}, {11, 11}},
+    [GLYPH_SZHENG] = {{77, 2294}, {11, 11}},
+    [GLYPH_DONG] = {{0, 2305}, {11, 11}},
+    [GLYPH_LA] = {{11, 2305}, {11, 11}},
+#endif
+};
+
+#endif
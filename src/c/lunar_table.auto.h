@@ -0,0 +1,215 @@
+// 由 tools/build_lunar.py 產生，請勿手動修改
+#pragma once
+
+#define LUNAR_FIRST_YEAR 1900
+#define LUNAR_LAST_YEAR 2100
+
+// 每年 3 bytes（高位在前）解開後的欄位，見 build_lunar.py
+#define LUNAR_INFO_BIG_MONTH(info, index) (((info) >> (23 - (index))) & 1)
+#define LUNAR_INFO_LEAP_MONTH(info) (((info) >> 7) & 0xF)
+#define LUNAR_INFO_NEW_YEAR_YDAY(info) ((info) & 0x3F)
+
+// 以 (農曆年 - LUNAR_FIRST_YEAR) * 3 為索引
+static const uint8_t LUNAR_YEAR_INFO[603] = {
+    0x4B, 0x6C, 0x1E,  // 1900
+    0x4A, 0xE0, 0x31,  // 1901
+    0xA5, 0x70, 0x26,  // 1902
+    0x52, 0x6A, 0x9C,  // 1903
+    0xD2, 0x60, 0x2E,  // 1904
+    0xD9, 0x50, 0x22,  // 1905
+    0x6A, 0xAA, 0x18,  // 1906
+    0x56, 0xA0, 0x2B,  // 1907
+    0x9A, 0xD0, 0x20,  // 1908
+    0x4A, 0xE9, 0x15,  // 1909
+    0x4A, 0xE0, 0x28,  // 1910
+    0xA4, 0xDB, 0x1D,  // 1911
+    0xA4, 0xD0, 0x30,  // 1912
+    0xD2, 0x50, 0x24,  // 1913
+    0xD5, 0x2A, 0x99,  // 1914
+    0xB5, 0x40, 0x2C,  // 1915
+    0xD6, 0xA0, 0x21,  // 1916
+    0x96, 0xD1, 0x96,  // 1917
+    0x95, 0xB0, 0x29,  // 1918
+    0x49, 0xBB, 0x9F,  // 1919
+    0x49, 0x70, 0x32,  // 1920
+    0xA4, 0xB0, 0x26,  // 1921
+    0xB2, 0x5B, 0x1B,  // 1922
+    0x6A, 0x50, 0x2E,  // 1923
+    0x6D, 0x40, 0x23,  // 1924
+    0xAD, 0xAA, 0x17,  // 1925
+    0x2B, 0x60, 0x2B,  // 1926
+    0x95, 0x70, 0x20,  // 1927
+    0x49, 0x79, 0x16,  // 1928
+    0x49, 0x70, 0x28,  // 1929
+    0x64, 0xB3, 0x1D,  // 1930
+    0xD4, 0xA0, 0x2F,  // 1931
+    0xEA, 0x50, 0x24,  // 1932
+    0x6D, 0x4A, 0x99,  // 1933
+    0x5A, 0xD0, 0x2C,  // 1934
+    0x2B, 0x60, 0x22,  // 1935
+    0x93, 0x71, 0x97,  // 1936
+    0x92, 0xE0, 0x29,  // 1937
+    0xC9, 0x6B, 0x9E,  // 1938
+    0xC9, 0x50, 0x31,  // 1939
+    0xD4, 0xA0, 0x26,  // 1940
+    0xDA, 0x53, 0x1A,  // 1941
+    0xB5, 0x50, 0x2D,  // 1942
+    0x56, 0xA0, 0x23,  // 1943
+    0xAA, 0xDA, 0x18,  // 1944
+    0x25, 0xD0, 0x2B,  // 1945
+    0x92, 0xD0, 0x20,  // 1946
+    0xC9, 0x59, 0x15,  // 1947
+    0xA9, 0x50, 0x28,  // 1948
+    0xB4, 0xAB, 0x9C,  // 1949
+    0x6C, 0xA0, 0x2F,  // 1950
+    0xB5, 0x50, 0x24,  // 1951
+    0x55, 0xAA, 0x9A,  // 1952
+    0x4D, 0xB0, 0x2C,  // 1953
+    0x25, 0xB0, 0x22,  // 1954
+    0x92, 0xB9, 0x97,  // 1955
+    0x52, 0xB0, 0x2A,  // 1956
+    0xA9, 0x54, 0x1E,  // 1957
+    0xE9, 0x50, 0x30,  // 1958
+    0x6A, 0xA0, 0x26,  // 1959
+    0xAD, 0x53, 0x1B,  // 1960
+    0xAB, 0x50, 0x2D,  // 1961
+    0x4B, 0x60, 0x23,  // 1962
+    0xA5, 0x72, 0x18,  // 1963
+    0xA5, 0x70, 0x2B,  // 1964
+    0x52, 0x60, 0x20,  // 1965
+    0xE9, 0x31, 0x94,  // 1966
+    0xD9, 0x50, 0x27,  // 1967
+    0x5A, 0xAB, 0x9D,  // 1968
+    0x56, 0xA0, 0x2F,  // 1969
+    0x96, 0xD0, 0x24,  // 1970
+    0x4A, 0xEA, 0x9A,  // 1971
+    0x4A, 0xD0, 0x2D,  // 1972
+    0xA4, 0xD0, 0x21,  // 1973
+    0xD2, 0x6A, 0x16,  // 1974
+    0xD2, 0x50, 0x29,  // 1975
+    0xD5, 0x2C, 0x1E,  // 1976
+    0xB5, 0x40, 0x30,  // 1977
+    0xB6, 0xA0, 0x25,  // 1978
+    0x96, 0xD3, 0x1B,  // 1979
+    0x95, 0xB0, 0x2E,  // 1980
+    0x49, 0xB0, 0x23,  // 1981
+    0xA4, 0xBA, 0x18,  // 1982
+    0xA4, 0xB0, 0x2B,  // 1983
+    0xB2, 0x5D, 0x20,  // 1984
+    0x6A, 0x50, 0x32,  // 1985
+    0x6D, 0x40, 0x27,  // 1986
+    0xAD, 0xA3, 0x9C,  // 1987
+    0xAB, 0x60, 0x2F,  // 1988
+    0x95, 0x70, 0x24,  // 1989
+    0x49, 0x7A, 0x9A,  // 1990
+    0x49, 0x70, 0x2D,  // 1991
+    0x64, 0xB0, 0x22,  // 1992
+    0x6A, 0x51, 0x96,  // 1993
+    0xEA, 0x50, 0x28,  // 1994
+    0x6B, 0x2C, 0x1E,  // 1995
+    0x5A, 0xC0, 0x31,  // 1996
+    0xAB, 0x60, 0x25,  // 1997
+    0x93, 0x72, 0x9B,  // 1998
+    0x92, 0xE0, 0x2E,  // 1999
+    0xC9, 0x60, 0x23,  // 2000
+    0xD4, 0xAA, 0x17,  // 2001
+    0xD4, 0xA0, 0x2A,  // 2002
+    0xDA, 0x50, 0x1F,  // 2003
+    0x5A, 0xA9, 0x15,  // 2004
+    0x56, 0xA0, 0x27,  // 2005
+    0xAA, 0xDB, 0x9C,  // 2006
+    0x25, 0xD0, 0x30,  // 2007
+    0x92, 0xD0, 0x25,  // 2008
+    0xC9, 0x5A, 0x99,  // 2009
+    0xA9, 0x50, 0x2C,  // 2010
+    0xB4, 0xA0, 0x21,  // 2011
+    0xB6, 0x52, 0x16,  // 2012
+    0xAD, 0x50, 0x28,  // 2013
+    0x55, 0xAC, 0x9E,  // 2014
+    0x4B, 0xA0, 0x31,  // 2015
+    0xA5, 0xB0, 0x26,  // 2016
+    0x52, 0xBB, 0x1B,  // 2017
+    0x52, 0x70, 0x2E,  // 2018
+    0xA9, 0x30, 0x23,  // 2019
+    0x74, 0xAA, 0x18,  // 2020
+    0x6A, 0xA0, 0x2A,  // 2021
+    0xAD, 0x50, 0x1F,  // 2022
+    0x4D, 0xA9, 0x15,  // 2023
+    0x4B, 0x60, 0x28,  // 2024
+    0xA5, 0x73, 0x1C,  // 2025
+    0xA4, 0xF0, 0x2F,  // 2026
+    0x52, 0x60, 0x25,  // 2027
+    0xE9, 0x32, 0x99,  // 2028
+    0xD5, 0x20, 0x2B,  // 2029
+    0xDA, 0xA0, 0x20,  // 2030
+    0x6B, 0x51, 0x96,  // 2031
+    0x96, 0xD0, 0x29,  // 2032
+    0x4A, 0xED, 0x9E,  // 2033
+    0x4A, 0xD0, 0x31,  // 2034
+    0xA4, 0xD0, 0x26,  // 2035
+    0xD2, 0x5B, 0x1B,  // 2036
+    0xD2, 0x50, 0x2D,  // 2037
+    0xD5, 0x20, 0x22,  // 2038
+    0xDA, 0xA2, 0x97,  // 2039
+    0xB5, 0xA0, 0x2A,  // 2040
+    0x56, 0xD0, 0x1F,  // 2041
+    0x4A, 0xD9, 0x15,  // 2042
+    0x49, 0xB0, 0x28,  // 2043
+    0xA4, 0xBB, 0x9D,  // 2044
+    0xA4, 0xB0, 0x2F,  // 2045
+    0xAA, 0x50, 0x24,  // 2046
+    0xB5, 0x2A, 0x99,  // 2047
+    0x6D, 0x20, 0x2C,  // 2048
+    0xAD, 0xA0, 0x20,  // 2049
+    0x55, 0xB1, 0x96,  // 2050
+    0x93, 0x70, 0x29,  // 2051
+    0x49, 0x7C, 0x1F,  // 2052
+    0x49, 0x70, 0x31,  // 2053
+    0x64, 0xB0, 0x26,  // 2054
+    0x6A, 0x53, 0x1B,  // 2055
+    0xEA, 0x50, 0x2D,  // 2056
+    0x6B, 0x20, 0x22,  // 2057
+    0xAB, 0x62, 0x17,  // 2058
+    0xAA, 0xE0, 0x2A,  // 2059
+    0x92, 0xE0, 0x20,  // 2060
+    0xC9, 0x71, 0x94,  // 2061
+    0xC9, 0x60, 0x27,  // 2062
+    0xD4, 0xAB, 0x9C,  // 2063
+    0xD4, 0xA0, 0x2F,  // 2064
+    0xDA, 0x50, 0x23,  // 2065
+    0x5A, 0xAA, 0x99,  // 2066
+    0x56, 0xA0, 0x2C,  // 2067
+    0xA6, 0xD0, 0x21,  // 2068
+    0x52, 0xEA, 0x16,  // 2069
+    0x92, 0xD0, 0x29,  // 2070
+    0xA9, 0x5C, 0x1E,  // 2071
+    0xA9, 0x50, 0x31,  // 2072
+    0xB4, 0xA0, 0x25,  // 2073
+    0xB5, 0x53, 0x1A,  // 2074
+    0xAD, 0x50, 0x2D,  // 2075
+    0x55, 0xA0, 0x23,  // 2076
+    0xA5, 0xD2, 0x17,  // 2077
+    0xA5, 0xB0, 0x2A,  // 2078
+    0x52, 0xB0, 0x20,  // 2079
+    0xA9, 0x39, 0x95,  // 2080
+    0x69, 0x30, 0x27,  // 2081
+    0x72, 0x9B, 0x9C,  // 2082
+    0x6A, 0xA0, 0x2F,  // 2083
+    0xAD, 0x50, 0x24,  // 2084
+    0x4D, 0xAA, 0x99,  // 2085
+    0x4B, 0x60, 0x2C,  // 2086
+    0xA5, 0x70, 0x21,  // 2087
+    0x52, 0x72, 0x17,  // 2088
+    0xD1, 0x60, 0x28,  // 2089
+    0xE9, 0x34, 0x1D,  // 2090
+    0xD5, 0x20, 0x30,  // 2091
+    0xDA, 0xA0, 0x25,  // 2092
+    0x6B, 0x53, 0x1A,  // 2093
+    0x56, 0xD0, 0x2D,  // 2094
+    0x4A, 0xE0, 0x23,  // 2095
+    0xA4, 0xEA, 0x18,  // 2096
+    0xA2, 0xD0, 0x2A,  // 2097
+    0xD1, 0x50, 0x1F,  // 2098
+    0xD9, 0x29, 0x14,  // 2099
+    0xD5, 0x20, 0x27,  // 2100
+};
@@ -0,0 +1,236 @@
+// 由 tools/build_numerals.py 產生，請勿手動修改
+#pragma once
+
+#include "glyph_atlas.auto.h"
+
+// 12 小時制，以 tm_hour 為索引
+static const uint8_t HOUR_GLYPHS_12H[24][2] = {
+    [0] = {GLYPH_U10, GLYPH_U2},
+    [1] = {GLYPH_NONE, GLYPH_U1},
+    [2] = {GLYPH_NONE, GLYPH_U2},
+    [3] = {GLYPH_NONE, GLYPH_U3},
+    [4] = {GLYPH_NONE, GLYPH_U4},
+    [5] = {GLYPH_NONE, GLYPH_U5},
+    [6] = {GLYPH_NONE, GLYPH_U6},
+    [7] = {GLYPH_NONE, GLYPH_U7},
+    [8] = {GLYPH_NONE, GLYPH_U8},
+    [9] = {GLYPH_NONE, GLYPH_U9},
+    [10] = {GLYPH_NONE, GLYPH_U10},
+    [11] = {GLYPH_U10, GLYPH_U1},
+    [12] = {GLYPH_U10, GLYPH_U2},
+    [13] = {GLYPH_NONE, GLYPH_U1},
+    [14] = {GLYPH_NONE, GLYPH_U2},
+    [15] = {GLYPH_NONE, GLYPH_U3},
+    [16] = {GLYPH_NONE, GLYPH_U4},
+    [17] = {GLYPH_NONE, GLYPH_U5},
+    [18] = {GLYPH_NONE, GLYPH_U6},
+    [19] = {GLYPH_NONE, GLYPH_U7},
+    [20] = {GLYPH_NONE, GLYPH_U8},
+    [21] = {GLYPH_NONE, GLYPH_U9},
+    [22] = {GLYPH_NONE, GLYPH_U10},
+    [23] = {GLYPH_U10, GLYPH_U1},
+};
+
+// 24 小時制，以 tm_hour 為索引
+static const uint8_t HOUR_GLYPHS_24H[24][2] = {
+    [0] = {GLYPH_NONE, GLYPH_U0},
+    [1] = {GLYPH_NONE, GLYPH_U1},
+    [2] = {GLYPH_NONE, GLYPH_U2},
+    [3] = {GLYPH_NONE, GLYPH_U3},
+    [4] = {GLYPH_NONE, GLYPH_U4},
+    [5] = {GLYPH_NONE, GLYPH_U5},
+    [6] = {GLYPH_NONE, GLYPH_U6},
+    [7] = {GLYPH_NONE, GLYPH_U7},
+    [8] = {GLYPH_NONE, GLYPH_U8},
+    [9] = {GLYPH_NONE, GLYPH_U9},
+    [10] = {GLYPH_NONE, GLYPH_U10},
+    [11] = {GLYPH_U10, GLYPH_U1},
+    [12] = {GLYPH_U10, GLYPH_U2},
+    [13] = {GLYPH_U10, GLYPH_U3},
+    [14] = {GLYPH_U10, GLYPH_U4},
+    [15] = {GLYPH_U10, GLYPH_U5},
+    [16] = {GLYPH_U10, GLYPH_U6},
+    [17] = {GLYPH_U10, GLYPH_U7},
+    [18] = {GLYPH_U10, GLYPH_U8},
+    [19] = {GLYPH_U10, GLYPH_U9},
+    [20] = {GLYPH_U2, GLYPH_U10},
+    [21] = {GLYPH_U2, GLYPH_U1},
+    [22] = {GLYPH_U2, GLYPH_U2},
+    [23] = {GLYPH_U2, GLYPH_U3},
+};
+
+// 以 tm_min 為索引
+static const uint8_t MINUTE_GLYPHS[60][2] = {
+    [0] = {GLYPH_DIAN, GLYPH_ZHENG},
+    [1] = {GLYPH_L0, GLYPH_L1},
+    [2] = {GLYPH_L0, GLYPH_L2},
+    [3] = {GLYPH_L0, GLYPH_L3},
+    [4] = {GLYPH_L0, GLYPH_L4},
+    [5] = {GLYPH_L0, GLYPH_L5},
+    [6] = {GLYPH_L0, GLYPH_L6},
+    [7] = {GLYPH_L0, GLYPH_L7},
+    [8] = {GLYPH_L0, GLYPH_L8},
+    [9] = {GLYPH_L0, GLYPH_L9},
+    [10] = {GLYPH_L1, GLYPH_L0},
+    [11] = {GLYPH_L10, GLYPH_L1},
+    [12] = {GLYPH_L10, GLYPH_L2},
+    [13] = {GLYPH_L10, GLYPH_L3},
+    [14] = {GLYPH_L10, GLYPH_L4},
+    [15] = {GLYPH_L10, GLYPH_L5},
+    [16] = {GLYPH_L10, GLYPH_L6},
+    [17] = {GLYPH_L10, GLYPH_L7},
+    [18] = {GLYPH_L10, GLYPH_L8},
+    [19] = {GLYPH_L10, GLYPH_L9},
+    [20] = {GLYPH_L2, GLYPH_L10},
+    [21] = {GLYPH_L20, GLYPH_L1},
+    [22] = {GLYPH_L20, GLYPH_L2},
+    [23] = {GLYPH_L20, GLYPH_L3},
+    [24] = {GLYPH_L20, GLYPH_L4},
+    [25] = {GLYPH_L20, GLYPH_L5},
+    [26] = {GLYPH_L20, GLYPH_L6},
+    [27] = {GLYPH_L20, GLYPH_L7},
+    [28] = {GLYPH_L20, GLYPH_L8},
+    [29] = {GLYPH_L20, GLYPH_L9},
+    [30] = {GLYPH_DIAN, GLYPH_BAN},
+    [31] = {GLYPH_L30, GLYPH_L1},
+    [32] = {GLYPH_L30, GLYPH_L2},
+    [33] = {GLYPH_L30, GLYPH_L3},
+    [34] = {GLYPH_L30, GLYPH_L4},
+    [35] = {GLYPH_L30, GLYPH_L5},
+    [36] = {GLYPH_L30, GLYPH_L6},
+    [37] = {GLYPH_L30, GLYPH_L7},
+    [38] = {GLYPH_L30, GLYPH_L8},
+    [39] = {GLYPH_L30, GLYPH_L9},
+    [40] = {GLYPH_L4, GLYPH_L10},
+    [41] = {GLYPH_L4, GLYPH_L1},
+    [42] = {GLYPH_L4, GLYPH_L2},
+    [43] = {GLYPH_L4, GLYPH_L3},
+    [44] = {GLYPH_L4, GLYPH_L4},
+    [45] = {GLYPH_L4, GLYPH_L5},
+    [46] = {GLYPH_L4, GLYPH_L6},
+    [47] = {GLYPH_L4, GLYPH_L7},
+    [48] = {GLYPH_L4, GLYPH_L8},
+    [49] = {GLYPH_L4, GLYPH_L9},
+    [50] = {GLYPH_L5, GLYPH_L10},
+    [51] = {GLYPH_L5, GLYPH_L1},
+    [52] = {GLYPH_L5, GLYPH_L2},
+    [53] = {GLYPH_L5, GLYPH_L3},
+    [54] = {GLYPH_L5, GLYPH_L4},
+    [55] = {GLYPH_L5, GLYPH_L5},
+    [56] = {GLYPH_L5, GLYPH_L6},
+    [57] = {GLYPH_L5, GLYPH_L7},
+    [58] = {GLYPH_L5, GLYPH_L8},
+    [59] = {GLYPH_L5, GLYPH_L9},
+};
+
+// 以月份（tm_mon + 1）為索引，[0] 不使用
+static const uint8_t MONTH_GLYPHS[13][2] = {
+    [1] = {GLYPH_NONE, GLYPH_SU1},
+    [2] = {GLYPH_NONE, GLYPH_SU2},
+    [3] = {GLYPH_NONE, GLYPH_SU3},
+    [4] = {GLYPH_NONE, GLYPH_SU4},
+    [5] = {GLYPH_NONE, GLYPH_SU5},
+    [6] = {GLYPH_NONE, GLYPH_SU6},
+    [7] = {GLYPH_NONE, GLYPH_SU7},
+    [8] = {GLYPH_NONE, GLYPH_SU8},
+    [9] = {GLYPH_NONE, GLYPH_SU9},
+    [10] = {GLYPH_NONE, GLYPH_SU10},
+    [11] = {GLYPH_SU10, GLYPH_SU1},
+    [12] = {GLYPH_SU10, GLYPH_SU2},
+};
+
+// 以 tm_mday 為索引，[0] 不使用
+static const uint8_t DAY_GLYPHS[32][2] = {
+    [1] = {GLYPH_NONE, GLYPH_SL1},
+    [2] = {GLYPH_NONE, GLYPH_SL2},
+    [3] = {GLYPH_NONE, GLYPH_SL3},
+    [4] = {GLYPH_NONE, GLYPH_SL4},
+    [5] = {GLYPH_NONE, GLYPH_SL5},
+    [6] = {GLYPH_NONE, GLYPH_SL6},
+    [7] = {GLYPH_NONE, GLYPH_SL7},
+    [8] = {GLYPH_NONE, GLYPH_SL8},
+    [9] = {GLYPH_NONE, GLYPH_SL9},
+    [10] = {GLYPH_NONE, GLYPH_SL10},
+    [11] = {GLYPH_SL10, GLYPH_SL1},
+    [12] = {GLYPH_SL10, GLYPH_SL2},
+    [13] = {GLYPH_SL10, GLYPH_SL3},
+    [14] = {GLYPH_SL10, GLYPH_SL4},
+    [15] = {GLYPH_SL10, GLYPH_SL5},
+    [16] = {GLYPH_SL10, GLYPH_SL6},
+    [17] = {GLYPH_SL10, GLYPH_SL7},
+    [18] = {GLYPH_SL10, GLYPH_SL8},
+    [19] = {GLYPH_SL10, GLYPH_SL9},
+    [20] = {GLYPH_SL2, GLYPH_SL10},
+    [21] = {GLYPH_SL20, GLYPH_SL1},
+    [22] = {GLYPH_SL20, GLYPH_SL2},
+    [23] = {GLYPH_SL20, GLYPH_SL3},
+    [24] = {GLYPH_SL20, GLYPH_SL4},
+    [25] = {GLYPH_SL20, GLYPH_SL5},
+    [26] = {GLYPH_SL20, GLYPH_SL6},
+    [27] = {GLYPH_SL20, GLYPH_SL7},
+    [28] = {GLYPH_SL20, GLYPH_SL8},
+    [29] = {GLYPH_SL20, GLYPH_SL9},
+    [30] = {GLYPH_SL3, GLYPH_SL10},
+    [31] = {GLYPH_SL30, GLYPH_SL1},
+};
+
+// 以 tm_wday 為索引
+static const uint8_t WEEKDAY_GLYPHS[7] = {
+    [0] = GLYPH_RI,
+    [1] = GLYPH_SL1,
+    [2] = GLYPH_SL2,
+    [3] = GLYPH_SL3,
+    [4] = GLYPH_SL4,
+    [5] = GLYPH_SL5,
+    [6] = GLYPH_SL6,
+};
+
+// 以農曆月份為索引，[0] 不使用
+static const uint8_t LUNAR_MONTH_GLYPHS[13] = {
+    [1] = GLYPH_SZHENG,
+    [2] = GLYPH_SL2,
+    [3] = GLYPH_SL3,
+    [4] = GLYPH_SL4,
+    [5] = GLYPH_SL5,
+    [6] = GLYPH_SL6,
+    [7] = GLYPH_SL7,
+    [8] = GLYPH_SL8,
+    [9] = GLYPH_SL9,
+    [10] = GLYPH_SL10,
+    [11] = GLYPH_DONG,
+    [12] = GLYPH_LA,
+};
+
+// 以農曆日為索引，[0] 不使用
+static const uint8_t LUNAR_DAY_GLYPHS[31][2] = {
+    [1] = {GLYPH_CHU, GLYPH_SL1},
+    [2] = {GLYPH_CHU, GLYPH_SL2},
+    [3] = {GLYPH_CHU, GLYPH_SL3},
+    [4] = {GLYPH_CHU, GLYPH_SL4},
+    [5] = {GLYPH_CHU, GLYPH_SL5},
+    [6] = {GLYPH_CHU, GLYPH_SL6},
+    [7] = {GLYPH_CHU, GLYPH_SL7},
+    [8] = {GLYPH_CHU, GLYPH_SL8},
+    [9] = {GLYPH_CHU, GLYPH_SL9},
+    [10] = {GLYPH_CHU, GLYPH_SL10},
+    [11] = {GLYPH_SL10, GLYPH_SL1},
+    [12] = {GLYPH_SL10, GLYPH_SL2},
+    [13] = {GLYPH_SL10, GLYPH_SL3},
+    [14] = {GLYPH_SL10, GLYPH_SL4},
+    [15] = {GLYPH_SL10, GLYPH_SL5},
+    [16] = {GLYPH_SL10, GLYPH_SL6},
+    [17] = {GLYPH_SL10, GLYPH_SL7},
+    [18] = {GLYPH_SL10, GLYPH_SL8},
+    [19] = {GLYPH_SL10, GLYPH_SL9},
+    [20] = {GLYPH_SL2, GLYPH_SL10},
+    [21] = {GLYPH_SL20, GLYPH_SL1},
+    [22] = {GLYPH_SL20, GLYPH_SL2},
+    [23] = {GLYPH_SL20, GLYPH_SL3},
+    [24] = {GLYPH_SL20, GLYPH_SL4},
+    [25] = {GLYPH_SL20, GLYPH_SL5},
+    [26] = {GLYPH_SL20, GLYPH_SL6},
+    [27] = {GLYPH_SL20, GLYPH_SL7},
+    [28] = {GLYPH_SL20, GLYPH_SL8},
+    [29] = {GLYPH_SL20, GLYPH_SL9},
+    [30] = {GLYPH_SL3, GLYPH_SL10},
+};
@@ -1,3 +1,86 @@
 var Clay = require('pebble-clay');
 var clayConfig = require('./config.json');
-var clay = new Clay(clayConfig);
+var messageKeys = require('message_keys');
+var SettingsSync = require('./settings_sync');
+
+// 設定頁關閉後由 SettingsSync 只送出與錶盤上次確認的設定不同的鍵值，取代 Clay 每次送出全部鍵值
+var clay = new Clay(clayConfig, null, { autoHandleEvents: false });
+var settingsSync = new SettingsSync(Pebble, localStorage, {
+  version: messageKeys.KEY_SETTINGS_VERSION,
+  base: messageKeys.KEY_SETTINGS_BASE
+});
+
+Pebble.addEventListener('showConfiguration', function () {
+  Pebble.openURL(clay.generateUrl());
+});
+
+Pebble.addEventListener('webviewclosed', function (e) {
+  if (!e || !e.response) return;
+  settingsSync.send(clay.getSettings(e.response));
+});
+
+// 效能計數器：以 PERF_COUNTERS 建置的錶盤每小時送出一次區間統計，依平台累計於 localStorage。
+// 最大值欄位取最大、KEY_PERF_HEAP_USED 取最新值，其餘加總
+var PERF_STORAGE_KEY = 'perf-counters';
+var PERF_MAX_FIELDS = ['KEY_PERF_HEAP_PEAK', 'KEY_PERF_TICK_MS_MAX', 'KEY_PERF_LOAD_MS_MAX'];
+var PERF_SUM_FIELDS = [
+  'KEY_PERF_TICKS', 'KEY_PERF_TICK_MS_TOTAL', 'KEY_PERF_ANIM_CREATED', 'KEY_PERF_ANIM_CANCELLED',
+  'KEY_PERF_LOAD_MS_TOTAL', 'KEY_PERF_SECONDS_DRAWS', 'KEY_PERF_SECONDS_PIXELS', 'KEY_PERF_SECONDS_DRAW_MS',
+  'KEY_PERF_ANIM_FRAMES', 'KEY_PERF_ANIM_DROPPED', 'KEY_PERF_ANIM_FRAME_MS',
+  'KEY_PERF_LOADS_HOUR', 'KEY_PERF_LOADS_MINUTE_ACCENT',
+  'KEY_PERF_LOADS_MINUTE_NORMAL', 'KEY_PERF_LOADS_DATE', 'KEY_PERF_LOADS_STATIC'
+];
+
+function watchPlatform() {
+  var info = Pebble.getActiveWatchInfo ? Pebble.getActiveWatchInfo() : null;
+  return info ? info.platform : 'unknown';
+}
+
+function aggregatePerf(payload) {
+  var all = JSON.parse(localStorage.getItem(PERF_STORAGE_KEY) || '{}');
+  var platform = watchPlatform();
+  var totals = all[platform] || { reports: 0 };
+
+  totals.reports++;
+  PERF_SUM_FIELDS.forEach(function (key) {
+    totals[key] = (totals[key] || 0) + (payload[key] || 0);
+  });
+  PERF_MAX_FIELDS.forEach(function (key) {
+    totals[key] = Math.max(totals[key] || 0, payload[key] || 0);
+  });
+  totals.KEY_PERF_HEAP_USED = payload.KEY_PERF_HEAP_USED;
+
+  all[platform] = totals;
+  localStorage.setItem(PERF_STORAGE_KEY, JSON.stringify(all));
+
+  var ticks = totals.KEY_PERF_TICKS || 1;
+  console.log('perf ' + platform + ': ' + totals.reports + ' reports, ' + totals.KEY_PERF_TICKS + ' ticks, ' +
+              'heap ' + totals.KEY_PERF_HEAP_USED + '/' + totals.KEY_PERF_HEAP_PEAK + ' B, ' +
+              'tick ' + (totals.KEY_PERF_TICK_MS_TOTAL / ticks).toFixed(2) + ' ms avg, ' +
+              totals.KEY_PERF_TICK_MS_MAX + ' ms max, ' +
+              'animations +' + (totals.KEY_PERF_ANIM_CREATED / ticks).toFixed(2) +
+              ' -' + (totals.KEY_PERF_ANIM_CANCELLED / ticks).toFixed(2) + ' per tick');
+
+  var transitions = totals.KEY_PERF_ANIM_CREATED;
+  if (transitions) {
+    console.log('perf ' + platform + ': animation ' + (totals.KEY_PERF_ANIM_FRAMES / transitions).toFixed(2) +
+                ' frames and ' + (totals.KEY_PERF_ANIM_DROPPED / transitions).toFixed(2) + ' dropped per transition, ' +
+                (totals.KEY_PERF_ANIM_FRAME_MS / (totals.KEY_PERF_ANIM_FRAMES || 1)).toFixed(2) + ' ms per frame');
+  }
+
+  var seconds = totals.KEY_PERF_SECONDS_DRAWS;
+  if (seconds) {
+    console.log('perf ' + platform + ': seconds indicator ' + seconds + ' draws, ' +
+                (totals.KEY_PERF_SECONDS_PIXELS / seconds).toFixed(1) + ' px and ' +
+                (totals.KEY_PERF_SECONDS_DRAW_MS / seconds).toFixed(3) + ' ms per draw');
+  }
+}
+
+Pebble.addEventListener('appmessage', function (e) {
+  if (e.payload.KEY_SETTINGS_VERSION !== undefined) {
+    settingsSync.acknowledge(e.payload.KEY_SETTINGS_VERSION);
+  }
+  if (e.payload.KEY_PERF_TICKS !== undefined) {
+    aggregatePerf(e.payload);
+  }
+});
@@ -0,0 +1,100 @@
+// 設定差異同步：只送出與錶盤上次確認的設定不同的鍵值
+//
+// localStorage 保存錶盤已確認（acked）的完整設定與其版本，以及送出後尚未確認的一筆（pending）。
+// 每次儲存時版本加一，訊息附上 KEY_SETTINGS_VERSION 與差異所依據的 KEY_SETTINGS_BASE；
+// 沒有已確認的設定、或上一筆尚未確認時送出全部鍵值且不附 KEY_SETTINGS_BASE，錶盤一律接受。
+// 錶盤套用後回傳目前持有的版本：與 pending 相同即確認；介於兩者之間是已被取代的訊息的回覆，忽略；
+// 其餘表示錶盤上的設定與手機的紀錄不一致（重新安裝、清除資料），改送一次完整設定。
+//
+// 不依賴 Pebble 全域物件與 message_keys 模組，可在 node 以替身測試（tools/host/settings_sync_test.js）。
+var STORAGE_KEY = 'settings-sync';
+
+function sameValue(a, b) {
+  return JSON.stringify(a) === JSON.stringify(b);
+}
+
+// settings 中與 base 不同的鍵值；base 為 null 時為全部
+function changedValues(settings, base) {
+  var result = {};
+  for (var key in settings) {
+    if (!settings.hasOwnProperty(key)) continue;
+    if (base && sameValue(base[key], settings[key])) continue;
+    result[key] = settings[key];
+  }
+  return result;
+}
+
+function copy(object) {
+  var result = {};
+  for (var key in object) {
+    if (object.hasOwnProperty(key)) result[key] = object[key];
+  }
+  return result;
+}
+
+// pebble：提供 sendAppMessage(dict, success, failure) 的物件
+// storage：提供 getItem / setItem 的物件（localStorage）
+// keys：{version, base}，KEY_SETTINGS_VERSION 與 KEY_SETTINGS_BASE 的 AppMessage 鍵值
+function SettingsSync(pebble, storage, keys) {
+  this.pebble = pebble;
+  this.storage = storage;
+  this.keys = keys;
+}
+
+SettingsSync.prototype.load = function () {
+  var state = JSON.parse(this.storage.getItem(STORAGE_KEY) || 'null');
+  return state || { version: 0, acked: null, pending: null };
+};
+
+SettingsSync.prototype.save = function (state) {
+  this.storage.setItem(STORAGE_KEY, JSON.stringify(state));
+};
+
+// settings：Clay 的 getSettings() 結果（完整設定，鍵為 AppMessage 鍵值）。回傳送出的訊息，沒有變動時為 null
+SettingsSync.prototype.send = function (settings) {
+  var state = this.load();
+
+  // 上一筆尚未確認（仍在傳送或已失敗）時不知道錶盤持有哪一版，改送全部鍵值
+  var base = state.pending ? null : state.acked;
+  var message = changedValues(settings, base && base.values);
+  if (Object.keys(message).length === 0) return null;
+
+  state.version++;
+  message[this.keys.version] = state.version;
+  if (base) message[this.keys.base] = base.version;
+  state.pending = { version: state.version, values: copy(settings) };
+  this.save(state);
+
+  this.pebble.sendAppMessage(message, function () {}, function (e) {
+    // 未確認的設定留在 pending，下次儲存時送出全部鍵值
+    console.log('Settings sync failed: ' + JSON.stringify(e && e.error));
+  });
+  return message;
+};
+
+// 錶盤回傳的版本。回傳 true 表示已改送完整設定
+SettingsSync.prototype.acknowledge = function (version) {
+  var state = this.load();
+  var pending = state.pending;
+  if (!pending) return false;
+
+  if (version === pending.version) {
+    state.acked = { version: version, values: pending.values };
+    state.pending = null;
+    this.save(state);
+    return false;
+  }
+
+  // 已被取代的訊息的回覆，pending 的回覆隨後才到
+  var floor = state.acked ? state.acked.version : 0;
+  if (version > floor && version < pending.version) return false;
+
+  // 錶盤持有的版本與手機紀錄不一致：捨棄已確認的設定，送出全部鍵值
+  state.acked = null;
+  state.pending = null;
+  this.save(state);
+  this.send(pending.values);
+  return true;
+};
+
+module.exports = SettingsSync;
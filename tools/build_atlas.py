@@ -0,0 +1,595 @@
+#!/usr/bin/env python3
+"""
+字形資源建置步驟。
+
+來源字形（resources/time、resources/date）先量化為調色盤圖片，每個像素對齊到最接近的語意色插槽：
+  透明、Black（文字色）、White（黑白平台的強調色）、Red（彩色平台的強調色，僅 Basalt / Emery）
+量化後每張字形最多 4 色，並裁切到墨跡範圍（不透明像素的外接矩形），四周的透明邊界不存放也不繪製。輸出為：
+  resources/atlas/glyphs_<platform>.png ─ Basalt / Diorite / Emery 的單一字形圖集（1/2-bit 調色盤 PNG）
+  resources/glyphs/aplite/<stem>.bin    ─ Aplite 的逐張字形（堆積放不下圖集，維持逐張載入），
+                                          為 1/2-bit 原始像素資料，索引即語意色插槽，錶盤直接讀入預先配置的點陣圖
+  resources/glyphs/rle/glyphs_<platform>.bin ─ 四個平台的字形串流資源（選用，USE_RLE_GLYPHS）：所有字形的 RLE 資料
+                                          依序相接，錶盤繪製時分段讀取並直接解碼寫入畫面
+並產生 src/c/glyph_atlas.auto.h：
+  GlyphId               ─ 每張字形的編號（GLYPH_NONE = 0）
+  GLYPH_*_SCALE         ─ 時間 / 日期字形於畫面上的放大倍數（圖集存放底稿，錶盤繪製時以最近鄰整數倍放大）
+  GLYPH_INK_RECTS       ─ 各字形的墨跡範圍於原本方形字形中的位置（底稿座標），錶盤將裁切後的字形畫在格子左上角加上此位移
+  GLYPH_ATLAS_RECTS     ─ 各字形於圖集中的位置（Basalt / Diorite / Emery）
+  GLYPH_RESOURCE_IDS    ─ 字形編號對應的逐張資源 ID，以及各類逐張字形的最大尺寸與位元深度（Aplite）
+  GLYPH_RLE_INDEX       ─ 各字形於字形串流資源中的位置與底稿尺寸（定義 USE_RLE_GLYPHS 時取代以上兩者）
+package.json 中的字形資源清單亦由此重新產生（圖集的 memoryFormat 固定為 SmallestPalette，逐張字形與字形串流為 raw；
+三組資源一律列出，錶盤依 USE_RLE_GLYPHS 擇一使用，切換建置方式不會改動 package.json），
+最後檢查每個圖集資源都會以調色盤格式載入；8-bit 點陣圖沒有調色盤，主題換色會失效，因此直接中止建置。
+
+package.json 於 wscript 的 configure() 載入 SDK 之前以 update_package() 改寫（SDK 於 configure 時讀取資源清單），
+其餘檔案於每次建置前以 build() 產生；內容未變時不會改寫檔案。字形串流資源與標頭中的索引一律產生。
+用法：build_atlas.py [repo_root] [--scale-time]
+"""
+
+import json
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import pngio  # noqa: E402
+
+# (字形名稱, 資源目錄, 檔名主幹)；名稱同時對應 package.json 的 IMG_<名稱>
+TIME_GLYPHS = (
+    [('U%d' % n, 'time', 'u%d' % n) for n in range(11)] +
+    [('DIAN', 'time', 'dian'), ('ZHENG', 'time', 'zheng'), ('BAN', 'time', 'ban')] +
+    [('L%d' % n, 'time', 'l%d' % n) for n in range(11)] +
+    [('L20', 'time', 'l20'), ('L30', 'time', 'l30')]
+)
+
+DATE_GLYPHS = (
+    [('SU%d' % n, 'date', 'su%d' % n) for n in range(1, 11)] +
+    [('SL%d' % n, 'date', 'sl%d' % n) for n in range(1, 11)] +
+    [('SL20', 'date', 'sl20'), ('SL30', 'date', 'sl30')] +
+    [('YUE', 'date', 'yue'), ('RI', 'date', 'ri'), ('ZHOU', 'date', 'zhou')] +
+    # 農曆日期列：初、閏、正（與時間的「整」ZHENG 區分）、冬、臘
+    [('CHU', 'date', 'chu'), ('RUN', 'date', 'run'), ('SZHENG', 'date', 'szheng'),
+     ('DONG', 'date', 'dong'), ('LA', 'date', 'la')]
+)
+
+ALL_GLYPHS = TIME_GLYPHS + DATE_GLYPHS
+
+ATLAS_PLATFORMS = ('basalt', 'diorite', 'emery')
+GLYPH_PLATFORMS = ('aplite',)
+RLE_PLATFORMS = ('aplite', 'basalt', 'diorite', 'emery')
+
+# 語意色插槽（依調色盤索引順序）；錶盤以 theme_map_palette 將 Black / White / Red 換成主題色
+CLEAR = (0, 0, 0, 0)
+BLACK = (0, 0, 0, 255)
+WHITE = (255, 255, 255, 255)
+RED = (255, 0, 0, 255)
+COLOR_SLOTS = (CLEAR, BLACK, WHITE, RED)
+BW_SLOTS = (CLEAR, BLACK, WHITE)
+COLOR_PLATFORMS = ('basalt', 'emery')
+
+# 圖集存放底稿、錶盤繪製時放大的字形：(平台, 資源目錄) → 倍數。
+# Emery 的 22x22 日期字形恰為 11x11 版（*D.png）的 2 倍，圖集直接存 11x11 版，不另備 22x22 來源
+ATLAS_SCALES = {('emery', 'date'): 2}
+# 選用（--scale-time / CCWATCHFACE_SCALE_TIME=1）：Emery 的 88x88 時間字形恰為 22x22 底稿的 4 倍，
+# 建置時縮回底稿存入圖集，並確認放大後與原圖逐像素相同
+TIME_SCALES = {('emery', 'time'): 4}
+
+# 字形最多使用的顏色數：超過 4 色便無法以 2-bit 調色盤載入
+GLYPH_MAX_COLORS = 4
+
+# 會被主題換色的資源：必須以調色盤格式載入
+GLYPH_MEMORY_FORMAT = 'SmallestPalette'
+PALETTE_MEMORY_FORMATS = ('SmallestPalette', '1BitPalette', '2BitPalette', '4BitPalette')
+
+# Aplite 逐張字形的類別：同類字形尺寸與位元深度相同，錶盤為每類預先配置固定大小的點陣圖槽位
+RAW_CLASSES = ('HOUR', 'MINUTE', 'DATE')
+
+
+def raw_class(name):
+    if name.startswith('U'):
+        return 'HOUR'
+    return 'MINUTE' if name in {n for n, _, _ in TIME_GLYPHS} else 'DATE'
+
+
+# 每列時間字形數；27 張時間字形恰好排成 3 列
+ATLAS_COLUMNS = 9
+
+# 字形串流：每個位元組為一段連續同色像素，高 2 位元為語意色插槽、低 6 位元為長度減一；
+# 像素依列優先排列，一段可跨越列尾延續到下一列
+RLE_SLOT_SHIFT = 6
+RLE_MAX_RUN = 1 << RLE_SLOT_SHIFT
+# 索引以 uint16_t 記錄位置與長度
+RLE_MAX_BYTES = 0xFFFF
+
+
+def source_file(resources, directory, stem, platform):
+    """依 package.json 原本的規則挑選來源：Emery 用原尺寸圖（日期字形以 *D 放大），Basalt 優先用彩色版（*C），其餘用 *D。"""
+    if platform == 'emery':
+        candidates = [stem + 'D.png'] if (platform, directory) in ATLAS_SCALES else [stem + '.png']
+    elif platform == 'basalt':
+        candidates = [stem + 'C.png', stem + 'D.png']
+    else:
+        candidates = [stem + 'D.png']
+    for name in candidates:
+        path = os.path.join(resources, directory, name)
+        if os.path.exists(path):
+            return path
+    raise FileNotFoundError('%s/%s: no source image for %s' % (directory, stem, platform))
+
+
+# ==================== 量化 ====================
+
+def platform_slots(platform):
+    return COLOR_SLOTS if platform in COLOR_PLATFORMS else BW_SLOTS
+
+
+def nearest_slot(pixel, slots):
+    """半透明以下視為透明，其餘取 RGB 距離最近的不透明插槽。"""
+    r, g, b, a = pixel
+    if a < 128:
+        return CLEAR
+    return min((slot for slot in slots if slot[3] == 255),
+               key=lambda s: (s[0] - r) ** 2 + (s[1] - g) ** 2 + (s[2] - b) ** 2)
+
+
+def quantize(rows, slots):
+    return [[nearest_slot(px, slots) for px in row] for row in rows]
+
+
+def palettize(name, rows, slots):
+    """回傳 (indices, palette)；調色盤只保留用到的插槽並維持插槽順序，使輸出可重現。"""
+    used = {px for row in rows for px in row}
+    palette = [slot for slot in slots if slot in used]
+    if len(palette) > GLYPH_MAX_COLORS:
+        raise ValueError('%s: %d colors do not fit a 2-bit palette' % (name, len(palette)))
+    lookup = {slot: index for index, slot in enumerate(palette)}
+    return [[lookup[px] for px in row] for row in rows], palette
+
+
+def downscale(name, rows, factor):
+    """取每個 factor x factor 方塊的左上像素；方塊內必須同色，放大回去才與原圖逐像素相同。"""
+    height, width = len(rows), len(rows[0])
+    if width % factor or height % factor:
+        raise ValueError('%s: %dx%d is not a multiple of %d' % (name, width, height, factor))
+    for y in range(height):
+        for x in range(width):
+            if rows[y][x] != rows[y - y % factor][x - x % factor]:
+                raise ValueError('%s: not an exact %dx scale at (%d, %d)' % (name, factor, x, y))
+    return [row[::factor] for row in rows[::factor]]
+
+
+def load_glyph(resources, directory, stem, platform, shrink=1):
+    width, height, rows = pngio.read_png(source_file(resources, directory, stem, platform))
+    rows = quantize(rows, platform_slots(platform))
+    if shrink > 1:
+        rows = downscale(stem, rows, shrink)
+    return width // shrink, height // shrink, rows
+
+
+def ink_box(rows):
+    """不透明像素的外接矩形 (x, y, w, h)；整張透明時為 (0, 0, 0, 0)。"""
+    xs = [x for row in rows for x, px in enumerate(row) if px != CLEAR]
+    ys = [y for y, row in enumerate(rows) if any(px != CLEAR for px in row)]
+    if not xs:
+        return 0, 0, 0, 0
+    return min(xs), min(ys), max(xs) - min(xs) + 1, max(ys) - min(ys) + 1
+
+
+def load_trimmed(resources, directory, stem, platform, shrink=1):
+    """回傳 (ink, rows)：ink 為墨跡範圍於方形字形中的位置（底稿座標），rows 為裁切後的像素。"""
+    _, _, rows = load_glyph(resources, directory, stem, platform, shrink)
+    x, y, w, h = ink_box(rows)
+    return (x, y, w, h), [row[x:x + w] for row in rows[y:y + h]]
+
+
+def glyph_shrink(platform, directory, scale_time):
+    return TIME_SCALES.get((platform, directory), 1) if scale_time else 1
+
+
+def platform_scales(platform, scale_time):
+    """回傳 {資源目錄: 放大倍數}。"""
+    scales = {'time': 1, 'date': 1}
+    for (p, directory), factor in ATLAS_SCALES.items():
+        if p == platform:
+            scales[directory] = factor
+    if scale_time:
+        for (p, directory), factor in TIME_SCALES.items():
+            if p == platform:
+                scales[directory] = factor
+    return scales
+
+
+# ==================== 圖集 ====================
+
+def shelf_pack(sizes, width):
+    """依高度由高到低逐列擺放，回傳 (height, rects)；rects 依 sizes 順序排列。"""
+    order = sorted(range(len(sizes)), key=lambda i: (-sizes[i][1], -sizes[i][0], i))
+    rects = [None] * len(sizes)
+    x = y = shelf_h = 0
+    for i in order:
+        w, h = sizes[i]
+        if x + w > width:
+            x, y, shelf_h = 0, y + shelf_h, 0
+        rects[i] = (x, y, w, h)
+        x += w
+        shelf_h = max(shelf_h, h)
+    return y + shelf_h, rects
+
+
+def pack(resources, platform, scale_time):
+    """回傳 (width, height, rows, rects, inks)，rects 與 inks 依 ALL_GLYPHS 順序排列。
+    裁切後的字形尺寸不一，依高度分列擺放；圖集寬度取解碼後點陣圖（2-bit 每列位元組數 x 高）最小者，
+    同大小時取較窄者，結果與輸入順序無關而可重現。"""
+    inks, images = [], []
+    for name, directory, stem in ALL_GLYPHS:
+        ink, rows = load_trimmed(resources, directory, stem, platform, glyph_shrink(platform, directory, scale_time))
+        inks.append(ink)
+        images.append(rows)
+
+    sizes = [(w, h) for _, _, w, h in inks]
+    best = None
+    for width in range(max(w for w, _ in sizes), sum(w for w, _ in sizes) + 1):
+        height, rects = shelf_pack(sizes, width)
+        cost = ((width * 2 + 7) // 8 * height, width)
+        if best is None or cost < best[0]:
+            best = (cost, width, height, rects)
+    _, width, height, rects = best
+
+    rows = [[CLEAR] * width for _ in range(height)]
+    for pixels, (rx, ry, w, h) in zip(images, rects):
+        for py in range(h):
+            rows[ry + py][rx:rx + w] = pixels[py]
+    return width, height, rows, rects, inks
+
+
+def write_if_changed(path, data):
+    if os.path.exists(path):
+        with open(path, 'rb') as f:
+            if f.read() == data:
+                return False
+    with open(path, 'wb') as f:
+        f.write(data)
+    return True
+
+
+def raw_bits(rows, slots):
+    """字形實際用到的插槽只有透明與 Black 時可存為 1-bit，否則為 2-bit。"""
+    used = max(slots.index(px) for row in rows for px in row)
+    if used >= GLYPH_MAX_COLORS:
+        raise ValueError('slot %d does not fit a 2-bit glyph' % used)
+    return 1 if used <= 1 else 2
+
+
+def raw_glyph(width, height, rows, slots, bits):
+    """原始像素資料：每列 (width * bits + 7) // 8 bytes、MSB 在前，像素值為 slots 中的插槽索引。
+    與 GBitmapFormat1BitPalette / 2BitPalette 的記憶體格式相同，錶盤可直接讀入點陣圖並共用依插槽順序排列的主題調色盤。"""
+    row_bytes = (width * bits + 7) // 8
+    per_byte = 8 // bits
+    data = bytearray(row_bytes * height)
+    for y, row in enumerate(rows):
+        for x, px in enumerate(row):
+            data[y * row_bytes + x // per_byte] |= slots.index(px) << (8 - bits - bits * (x % per_byte))
+    return bytes(data)
+
+
+# ==================== 字形串流 ====================
+
+def rle_encode(rows, slots):
+    flat = [slots.index(px) for row in rows for px in row]
+    data = bytearray()
+    start = 0
+    while start < len(flat):
+        end = start + 1
+        while end < len(flat) and end - start < RLE_MAX_RUN and flat[end] == flat[start]:
+            end += 1
+        data.append(flat[start] << RLE_SLOT_SHIFT | (end - start - 1))
+        start = end
+    return bytes(data)
+
+
+def rle_decode(data):
+    flat = []
+    for code in data:
+        flat += [code >> RLE_SLOT_SHIFT] * ((code & (RLE_MAX_RUN - 1)) + 1)
+    return flat
+
+
+def rle_stream(name, width, height, rows, slots):
+    """編碼並確認解碼後與量化後的字形逐像素相同。"""
+    data = rle_encode(rows, slots)
+    if rle_decode(data) != [slots.index(px) for row in rows for px in row]:
+        raise ValueError('%s: RLE stream does not round-trip' % name)
+    return data
+
+
+def build_rle(resources, platform, scale_time):
+    """回傳 (data, index)；index 依 ALL_GLYPHS 順序為 (offset, size, width, height)，尺寸為裁切後的底稿尺寸。"""
+    slots = platform_slots(platform)
+    data = bytearray()
+    index = []
+    for name, directory, stem in ALL_GLYPHS:
+        (_, _, width, height), rows = load_trimmed(resources, directory, stem, platform,
+                                                   glyph_shrink(platform, directory, scale_time))
+        stream = rle_stream(name, width, height, rows, slots)
+        index.append((len(data), len(stream), width, height))
+        data += stream
+    if len(data) > RLE_MAX_BYTES:
+        raise ValueError('%s: %d bytes of RLE glyphs do not fit a 16-bit index' % (platform, len(data)))
+    return bytes(data), index
+
+
+def rle_file(platform):
+    return 'glyphs/rle/glyphs_%s.bin' % platform
+
+
+def write_indexed_if_changed(path, name, width, height, rows, slots):
+    indices, palette = palettize(name, rows, slots)
+    tmp = path + '.tmp'
+    pngio.write_png_indexed(tmp, width, height, indices, palette)
+    with open(tmp, 'rb') as f:
+        data = f.read()
+    os.remove(tmp)
+    return write_if_changed(path, data)
+
+
+# ==================== package.json ====================
+
+def atlas_file(platform):
+    return 'atlas/glyphs_%s.png' % platform
+
+
+def raw_file(platform, stem):
+    return 'glyphs/%s/%s.bin' % (platform, stem)
+
+
+def glyph_media():
+    """字形資源清單：Aplite 的逐張字形在前、各平台圖集其次、各平台的字形串流在後，維持既有的資源編號順序。
+    三組資源一律列出，由 USE_RLE_GLYPHS 於編譯時擇一使用，package.json 不隨建置方式改變。
+    檔名只由字形表決定，不需先產生資源。"""
+    media = []
+    for name, _, stem in ALL_GLYPHS:
+        for platform in GLYPH_PLATFORMS:
+            media.append({
+                'type': 'raw',
+                'name': 'IMG_%s' % name,
+                'file': raw_file(platform, stem),
+                'targetPlatforms': [platform],
+            })
+    for platform in ATLAS_PLATFORMS:
+        media.append({
+            'type': 'bitmap',
+            'name': 'GLYPH_ATLAS',
+            'file': atlas_file(platform),
+            'memoryFormat': GLYPH_MEMORY_FORMAT,
+            'targetPlatforms': [platform],
+        })
+    for platform in RLE_PLATFORMS:
+        media.append({
+            'type': 'raw',
+            'name': 'GLYPH_RLE',
+            'file': rle_file(platform),
+            'targetPlatforms': [platform],
+        })
+    return media
+
+
+def is_glyph_media(media):
+    return media['name'] in ('GLYPH_ATLAS', 'GLYPH_RLE') or media['name'].startswith('IMG_')
+
+
+def replace_glyph_media(media):
+    """以產生的字形資源取代 media 中的字形項目，其餘資源（如選單圖示）保留原順序。"""
+    return [m for m in media if not is_glyph_media(m)] + glyph_media()
+
+
+def update_package(repo_root):
+    """重新產生 package.json 的字形資源清單。SDK 於 configure 時讀取資源清單，
+    因此 wscript 須在 configure() 載入 pebble_sdk 之前呼叫，改動才會在同一次建置生效。"""
+    path = os.path.join(repo_root, 'package.json')
+    with open(path, encoding='utf-8') as f:
+        package = json.load(f)
+    resources = package['pebble']['resources']
+    resources['media'] = replace_glyph_media(resources['media'])
+    text = json.dumps(package, indent=2, ensure_ascii=False) + '\n'
+    write_if_changed(path, text.encode('utf-8'))
+
+
+def read_package(repo_root):
+    with open(os.path.join(repo_root, 'package.json'), encoding='utf-8') as f:
+        return json.load(f)
+
+
+def check_palettized(repo_root, package):
+    """每個圖集資源都必須是 1/2-bit 調色盤 PNG 並以調色盤格式載入，否則主題換色會靜默失效。
+    逐張字形為 raw 資源，像素值本身即插槽索引，不需檢查。"""
+    errors = []
+    for media in package['pebble']['resources']['media']:
+        if not is_glyph_media(media) or media['type'] == 'raw':
+            continue
+        label = '%s (%s)' % (media['name'], media['file'])
+        if media.get('memoryFormat') not in PALETTE_MEMORY_FORMATS:
+            errors.append('%s: memoryFormat %s has no palette' % (label, media.get('memoryFormat')))
+            continue
+        with open(os.path.join(repo_root, 'resources', media['file']), 'rb') as f:
+            header = f.read(26)
+        bit_depth, color_type = header[24], header[25]
+        if color_type != 3 or bit_depth > 2:
+            errors.append('%s: not a 1/2-bit palettized PNG' % label)
+    if errors:
+        raise ValueError('glyph resources would load without a palette:\n  ' + '\n  '.join(errors))
+
+
+def render_scales(out, scales_by_platform):
+    out.append('// 字形於畫面上的放大倍數：圖集存放底稿，錶盤繪製時以最近鄰整數倍放大')
+    scaled = [(p, scales) for p, scales in scales_by_platform.items() if scales != {'time': 1, 'date': 1}]
+    for index, (platform, scales) in enumerate(scaled):
+        out.append('#%s defined(PBL_PLATFORM_%s)' % ('if' if index == 0 else 'elif', platform.upper()))
+        out.append('#define GLYPH_TIME_SCALE %d' % scales['time'])
+        out.append('#define GLYPH_DATE_SCALE %d' % scales['date'])
+    if scaled:
+        out.append('#else')
+    out.append('#define GLYPH_TIME_SCALE 1')
+    out.append('#define GLYPH_DATE_SCALE 1')
+    if scaled:
+        out.append('#endif')
+    out.append('')
+
+
+def platform_groups(platforms, tables):
+    """內容相同的平台共用同一份表：回傳 [(平台清單, 表)]，依 platforms 順序。"""
+    groups = []
+    for platform in platforms:
+        for group in groups:
+            if group[1] == tables[platform]:
+                group[0].append(platform)
+                break
+        else:
+            groups.append(([platform], tables[platform]))
+    return groups
+
+
+def render_platform_tables(out, groups, render_row):
+    for index, (platforms, table) in enumerate(groups):
+        condition = ' || '.join('defined(PBL_PLATFORM_%s)' % p.upper() for p in platforms)
+        if index == 0:
+            out.append('#if %s' % condition)
+        elif index == len(groups) - 1:
+            out.append('#else')
+        else:
+            out.append('#elif %s' % condition)
+        for (name, _, _), entry in zip(ALL_GLYPHS, table):
+            out.append(render_row(name, entry))
+    out.append('#endif')
+
+
+def render_rle_index(out, rle_by_platform):
+    out.append('// 字形串流的每個位元組為一段同色像素：高位元為語意色插槽，低 GLYPH_RLE_SLOT_SHIFT 位元為長度減一')
+    out.append('#define GLYPH_RLE_SLOT_SHIFT %d' % RLE_SLOT_SHIFT)
+    out.append('#define GLYPH_RLE_LENGTH_MASK 0x%02X' % (RLE_MAX_RUN - 1))
+    out.append('')
+    out.append('// 字形串流：各字形於 GLYPH_RLE 資源中的位置、位元組數與底稿尺寸')
+    out.append('typedef struct {')
+    out.append('    uint16_t offset;')
+    out.append('    uint16_t size;')
+    out.append('    uint8_t width;')
+    out.append('    uint8_t height;')
+    out.append('} GlyphRle;')
+    out.append('')
+    out.append('static const GlyphRle GLYPH_RLE_INDEX[GLYPH_COUNT] = {')
+    render_platform_tables(out, platform_groups(RLE_PLATFORMS, rle_by_platform),
+                           lambda name, entry: '    [GLYPH_%s] = {%d, %d, %d, %d},' % ((name,) + entry))
+    out.append('};')
+    out.append('')
+
+
+def render_ink_rects(out, inks_by_platform):
+    out.append('// 各字形的墨跡範圍於原本方形字形中的位置（底稿座標）：字形資源只存此範圍，')
+    out.append('// 錶盤將字形畫在格子左上角加上 origin 乘以放大倍數之處')
+    out.append('static const GRect GLYPH_INK_RECTS[GLYPH_COUNT] = {')
+    render_platform_tables(out, platform_groups(RLE_PLATFORMS, inks_by_platform),
+                           lambda name, rect: '    [GLYPH_%s] = {{%d, %d}, {%d, %d}},' % ((name,) + tuple(rect)))
+    out.append('};')
+    out.append('')
+
+
+def render_header(rects_by_platform, raw_formats, scales_by_platform, rle_by_platform, inks_by_platform):
+    out = []
+    out.append('// 由 tools/build_atlas.py 產生，請勿手動修改')
+    out.append('#pragma once')
+    out.append('')
+    out.append('// 字形編號：時間與日期圖層顯示的每一張字形圖片')
+    out.append('typedef enum {')
+    out.append('    GLYPH_NONE = 0,')
+    for name, _, _ in ALL_GLYPHS:
+        out.append('    GLYPH_%s,' % name)
+    out.append('    GLYPH_COUNT,')
+    out.append('} GlyphId;')
+    out.append('')
+    render_scales(out, scales_by_platform)
+    render_ink_rects(out, inks_by_platform)
+    out.append('#if defined(USE_RLE_GLYPHS)')
+    out.append('')
+    render_rle_index(out, rle_by_platform)
+    out.append('#elif defined(PBL_PLATFORM_APLITE)')
+    out.append('')
+    out.append('// 逐張資源載入時，字形編號對應的資源 ID')
+    out.append('static const uint32_t GLYPH_RESOURCE_IDS[GLYPH_COUNT] = {')
+    for name, _, _ in ALL_GLYPHS:
+        out.append('    [GLYPH_%s] = RESOURCE_ID_IMG_%s,' % (name, name))
+    out.append('};')
+    out.append('')
+    out.append('// 逐張字形為裁切後的原始像素資料（尺寸見 GLYPH_INK_RECTS，每列 (寬 * 位元數 + 7) / 8 bytes，')
+    out.append('// 像素值依序為透明、Black、White 插槽）；時、分、日期字形各有固定的位元深度，尺寸為該類的最大值')
+    for kind in RAW_CLASSES:
+        width, height, bits = raw_formats[kind]
+        out.append('#define GLYPH_RAW_%s_WIDTH %d' % (kind, width))
+        out.append('#define GLYPH_RAW_%s_HEIGHT %d' % (kind, height))
+        out.append('#define GLYPH_RAW_%s_BITS %d' % (kind, bits))
+    out.append('')
+    out.append('#else')
+    out.append('')
+    out.append('// 各字形於圖集中的位置')
+    out.append('static const GRect GLYPH_ATLAS_RECTS[GLYPH_COUNT] = {')
+
+    # 佈局相同的平台共用同一份表
+    render_platform_tables(out, platform_groups(ATLAS_PLATFORMS, rects_by_platform),
+                           lambda name, rect: '    [GLYPH_%s] = {{%d, %d}, {%d, %d}},' % ((name,) + tuple(rect)))
+    out.append('};')
+    out.append('')
+    out.append('#endif')
+    out.append('')
+    return '\n'.join(out).encode('utf-8')
+
+
+def build(repo_root, scale_time=False):
+    resources = os.path.join(repo_root, 'resources')
+    atlas_dir = os.path.join(resources, 'atlas')
+    os.makedirs(atlas_dir, exist_ok=True)
+
+    rects_by_platform = {}
+    scales_by_platform = {}
+    inks_by_platform = {}
+    for platform in ATLAS_PLATFORMS:
+        scales_by_platform[platform] = platform_scales(platform, scale_time)
+        width, height, rows, rects, inks_by_platform[platform] = pack(resources, platform, scale_time)
+        rects_by_platform[platform] = rects
+        write_indexed_if_changed(os.path.join(resources, atlas_file(platform)), atlas_file(platform),
+                                 width, height, rows, platform_slots(platform))
+
+    raw_formats = {}
+    for platform in GLYPH_PLATFORMS:
+        os.makedirs(os.path.join(resources, 'glyphs', platform), exist_ok=True)
+        slots = platform_slots(platform)
+        glyphs = [(name, stem) + load_trimmed(resources, directory, stem, platform)
+                  for name, directory, stem in ALL_GLYPHS]
+        inks_by_platform[platform] = [ink for _, _, ink, _ in glyphs]
+
+        # 快取槽位依類別配置：尺寸取該類裁切後的最大值，位元深度取該類所需的最大值
+        for name, _, (_, _, width, height), rows in glyphs:
+            known = raw_formats.get(raw_class(name), (0, 0, 1))
+            raw_formats[raw_class(name)] = (max(known[0], width), max(known[1], height),
+                                            max(known[2], raw_bits(rows, slots) if rows else 1))
+
+        for name, stem, (_, _, width, height), rows in glyphs:
+            write_if_changed(os.path.join(resources, raw_file(platform, stem)),
+                             raw_glyph(width, height, rows, slots, raw_formats[raw_class(name)][2]))
+
+    rle_dir = os.path.join(resources, 'glyphs', 'rle')
+    os.makedirs(rle_dir, exist_ok=True)
+    rle_by_platform = {}
+    for platform in RLE_PLATFORMS:
+        data, rle_by_platform[platform] = build_rle(resources, platform, scale_time)
+        write_if_changed(os.path.join(resources, rle_file(platform)), data)
+
+    check_palettized(repo_root, read_package(repo_root))
+
+    header = os.path.join(repo_root, 'src', 'c', 'glyph_atlas.auto.h')
+    write_if_changed(header, render_header(rects_by_platform, raw_formats, scales_by_platform, rle_by_platform,
+                                           inks_by_platform))
+
+
+if __name__ == '__main__':
+    flags = ('--scale-time',)
+    args = [arg for arg in sys.argv[1:] if arg not in flags]
+    root = args[0] if args else os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+    update_package(root)
+    build(root, scale_time='--scale-time' in sys.argv[1:])
@@ -0,0 +1,303 @@
+#!/usr/bin/env python3
+"""
+農曆查表產生器。
+
+將下方 LUNAR_YEARS 的每個農曆年壓縮為 3 bytes，寫入 src/c/lunar_table.auto.h：
+  位元 23–11  各月大小（依序第 1 至第 13 個月，1 = 大月 30 日，0 = 小月 29 日；無閏月時只用前 12 位）
+  位元 10–7   閏月（閏幾月，0 = 無閏月）
+  位元 5–0    正月初一在公曆年中的日序（tm_yday，0 起算）
+1900–2100 共 201 年、603 bytes。錶盤以公曆年直接索引，再逐月累加天數（至多 13 次），
+不需浮點運算或天文計算。
+
+LUNAR_YEARS 依 ICU 中國曆（Intl.DateTimeFormat 'zh-TW-u-ca-chinese'）整理；
+tools/host/lunar_test 以同一來源逐日產生的參考資料（tools/host/lunar_reference.h）完整比對。
+
+wscript 於每次建置前呼叫 build()；內容未變時不會改寫檔案。
+用法：build_lunar.py [repo_root]
+"""
+
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import build_atlas  # noqa: E402
+
+# (農曆年, 正月初一的公曆月日, 閏幾月, 各月大小)
+LUNAR_YEARS = (
+    (1900, '01-31',  8, '0100101101101'),
+    (1901, '02-19',  0, '010010101110'),
+    (1902, '02-08',  0, '101001010111'),
+    (1903, '01-29',  5, '0101001001101'),
+    (1904, '02-16',  0, '110100100110'),
+    (1905, '02-04',  0, '110110010101'),
+    (1906, '01-25',  4, '0110101010101'),
+    (1907, '02-13',  0, '010101101010'),
+    (1908, '02-02',  0, '100110101101'),
+    (1909, '01-22',  2, '0100101011101'),
+    (1910, '02-10',  0, '010010101110'),
+    (1911, '01-30',  6, '1010010011011'),
+    (1912, '02-18',  0, '101001001101'),
+    (1913, '02-06',  0, '110100100101'),
+    (1914, '01-26',  5, '1101010100101'),
+    (1915, '02-14',  0, '101101010100'),
+    (1916, '02-03',  0, '110101101010'),
+    (1917, '01-23',  3, '1001011011010'),
+    (1918, '02-11',  0, '100101011011'),
+    (1919, '02-01',  7, '0100100110111'),
+    (1920, '02-20',  0, '010010010111'),
+    (1921, '02-08',  0, '101001001011'),
+    (1922, '01-28',  6, '1011001001011'),
+    (1923, '02-16',  0, '011010100101'),
+    (1924, '02-05',  0, '011011010100'),
+    (1925, '01-24',  4, '1010110110101'),
+    (1926, '02-13',  0, '001010110110'),
+    (1927, '02-02',  0, '100101010111'),
+    (1928, '01-23',  2, '0100100101111'),
+    (1929, '02-10',  0, '010010010111'),
+    (1930, '01-30',  6, '0110010010110'),
+    (1931, '02-17',  0, '110101001010'),
+    (1932, '02-06',  0, '111010100101'),
+    (1933, '01-26',  5, '0110110101001'),
+    (1934, '02-14',  0, '010110101101'),
+    (1935, '02-04',  0, '001010110110'),
+    (1936, '01-24',  3, '1001001101110'),
+    (1937, '02-11',  0, '100100101110'),
+    (1938, '01-31',  7, '1100100101101'),
+    (1939, '02-19',  0, '110010010101'),
+    (1940, '02-08',  0, '110101001010'),
+    (1941, '01-27',  6, '1101101001010'),
+    (1942, '02-15',  0, '101101010101'),
+    (1943, '02-05',  0, '010101101010'),
+    (1944, '01-25',  4, '1010101011011'),
+    (1945, '02-13',  0, '001001011101'),
+    (1946, '02-02',  0, '100100101101'),
+    (1947, '01-22',  2, '1100100101011'),
+    (1948, '02-10',  0, '101010010101'),
+    (1949, '01-29',  7, '1011010010101'),
+    (1950, '02-17',  0, '011011001010'),
+    (1951, '02-06',  0, '101101010101'),
+    (1952, '01-27',  5, '0101010110101'),
+    (1953, '02-14',  0, '010011011011'),
+    (1954, '02-04',  0, '001001011011'),
+    (1955, '01-24',  3, '1001001010111'),
+    (1956, '02-12',  0, '010100101011'),
+    (1957, '01-31',  8, '1010100101010'),
+    (1958, '02-18',  0, '111010010101'),
+    (1959, '02-08',  0, '011010101010'),
+    (1960, '01-28',  6, '1010110101010'),
+    (1961, '02-15',  0, '101010110101'),
+    (1962, '02-05',  0, '010010110110'),
+    (1963, '01-25',  4, '1010010101110'),
+    (1964, '02-13',  0, '101001010111'),
+    (1965, '02-02',  0, '010100100110'),
+    (1966, '01-21',  3, '1110100100110'),
+    (1967, '02-09',  0, '110110010101'),
+    (1968, '01-30',  7, '0101101010101'),
+    (1969, '02-17',  0, '010101101010'),
+    (1970, '02-06',  0, '100101101101'),
+    (1971, '01-27',  5, '0100101011101'),
+    (1972, '02-15',  0, '010010101101'),
+    (1973, '02-03',  0, '101001001101'),
+    (1974, '01-23',  4, '1101001001101'),
+    (1975, '02-11',  0, '110100100101'),
+    (1976, '01-31',  8, '1101010100101'),
+    (1977, '02-18',  0, '101101010100'),
+    (1978, '02-07',  0, '101101101010'),
+    (1979, '01-28',  6, '1001011011010'),
+    (1980, '02-16',  0, '100101011011'),
+    (1981, '02-05',  0, '010010011011'),
+    (1982, '01-25',  4, '1010010010111'),
+    (1983, '02-13',  0, '101001001011'),
+    (1984, '02-02', 10, '1011001001011'),
+    (1985, '02-20',  0, '011010100101'),
+    (1986, '02-09',  0, '011011010100'),
+    (1987, '01-29',  7, '1010110110100'),
+    (1988, '02-17',  0, '101010110110'),
+    (1989, '02-06',  0, '100101010111'),
+    (1990, '01-27',  5, '0100100101111'),
+    (1991, '02-15',  0, '010010010111'),
+    (1992, '02-04',  0, '011001001011'),
+    (1993, '01-23',  3, '0110101001010'),
+    (1994, '02-10',  0, '111010100101'),
+    (1995, '01-31',  8, '0110101100101'),
+    (1996, '02-19',  0, '010110101100'),
+    (1997, '02-07',  0, '101010110110'),
+    (1998, '01-28',  5, '1001001101110'),
+    (1999, '02-16',  0, '100100101110'),
+    (2000, '02-05',  0, '110010010110'),
+    (2001, '01-24',  4, '1101010010101'),
+    (2002, '02-12',  0, '110101001010'),
+    (2003, '02-01',  0, '110110100101'),
+    (2004, '01-22',  2, '0101101010101'),
+    (2005, '02-09',  0, '010101101010'),
+    (2006, '01-29',  7, '1010101011011'),
+    (2007, '02-18',  0, '001001011101'),
+    (2008, '02-07',  0, '100100101101'),
+    (2009, '01-26',  5, '1100100101011'),
+    (2010, '02-14',  0, '101010010101'),
+    (2011, '02-03',  0, '101101001010'),
+    (2012, '01-23',  4, '1011011001010'),
+    (2013, '02-10',  0, '101011010101'),
+    (2014, '01-31',  9, '0101010110101'),
+    (2015, '02-19',  0, '010010111010'),
+    (2016, '02-08',  0, '101001011011'),
+    (2017, '01-28',  6, '0101001010111'),
+    (2018, '02-16',  0, '010100100111'),
+    (2019, '02-05',  0, '101010010011'),
+    (2020, '01-25',  4, '0111010010101'),
+    (2021, '02-12',  0, '011010101010'),
+    (2022, '02-01',  0, '101011010101'),
+    (2023, '01-22',  2, '0100110110101'),
+    (2024, '02-10',  0, '010010110110'),
+    (2025, '01-29',  6, '1010010101110'),
+    (2026, '02-17',  0, '101001001111'),
+    (2027, '02-07',  0, '010100100110'),
+    (2028, '01-26',  5, '1110100100110'),
+    (2029, '02-13',  0, '110101010010'),
+    (2030, '02-02',  0, '110110101010'),
+    (2031, '01-23',  3, '0110101101010'),
+    (2032, '02-11',  0, '100101101101'),
+    (2033, '01-31', 11, '0100101011101'),
+    (2034, '02-19',  0, '010010101101'),
+    (2035, '02-08',  0, '101001001101'),
+    (2036, '01-28',  6, '1101001001011'),
+    (2037, '02-15',  0, '110100100101'),
+    (2038, '02-04',  0, '110101010010'),
+    (2039, '01-24',  5, '1101101010100'),
+    (2040, '02-12',  0, '101101011010'),
+    (2041, '02-01',  0, '010101101101'),
+    (2042, '01-22',  2, '0100101011011'),
+    (2043, '02-10',  0, '010010011011'),
+    (2044, '01-30',  7, '1010010010111'),
+    (2045, '02-17',  0, '101001001011'),
+    (2046, '02-06',  0, '101010100101'),
+    (2047, '01-26',  5, '1011010100101'),
+    (2048, '02-14',  0, '011011010010'),
+    (2049, '02-02',  0, '101011011010'),
+    (2050, '01-23',  3, '0101010110110'),
+    (2051, '02-11',  0, '100100110111'),
+    (2052, '02-01',  8, '0100100101111'),
+    (2053, '02-19',  0, '010010010111'),
+    (2054, '02-08',  0, '011001001011'),
+    (2055, '01-28',  6, '0110101001010'),
+    (2056, '02-15',  0, '111010100101'),
+    (2057, '02-04',  0, '011010110010'),
+    (2058, '01-24',  4, '1010101101100'),
+    (2059, '02-12',  0, '101010101110'),
+    (2060, '02-02',  0, '100100101110'),
+    (2061, '01-21',  3, '1100100101110'),
+    (2062, '02-09',  0, '110010010110'),
+    (2063, '01-29',  7, '1101010010101'),
+    (2064, '02-17',  0, '110101001010'),
+    (2065, '02-05',  0, '110110100101'),
+    (2066, '01-26',  5, '0101101010101'),
+    (2067, '02-14',  0, '010101101010'),
+    (2068, '02-03',  0, '101001101101'),
+    (2069, '01-23',  4, '0101001011101'),
+    (2070, '02-11',  0, '100100101101'),
+    (2071, '01-31',  8, '1010100101011'),
+    (2072, '02-19',  0, '101010010101'),
+    (2073, '02-07',  0, '101101001010'),
+    (2074, '01-27',  6, '1011010101010'),
+    (2075, '02-15',  0, '101011010101'),
+    (2076, '02-05',  0, '010101011010'),
+    (2077, '01-24',  4, '1010010111010'),
+    (2078, '02-12',  0, '101001011011'),
+    (2079, '02-02',  0, '010100101011'),
+    (2080, '01-22',  3, '1010100100111'),
+    (2081, '02-09',  0, '011010010011'),
+    (2082, '01-29',  7, '0111001010011'),
+    (2083, '02-17',  0, '011010101010'),
+    (2084, '02-06',  0, '101011010101'),
+    (2085, '01-26',  5, '0100110110101'),
+    (2086, '02-14',  0, '010010110110'),
+    (2087, '02-03',  0, '101001010111'),
+    (2088, '01-24',  4, '0101001001110'),
+    (2089, '02-10',  0, '110100010110'),
+    (2090, '01-30',  8, '1110100100110'),
+    (2091, '02-18',  0, '110101010010'),
+    (2092, '02-07',  0, '110110101010'),
+    (2093, '01-27',  6, '0110101101010'),
+    (2094, '02-15',  0, '010101101101'),
+    (2095, '02-05',  0, '010010101110'),
+    (2096, '01-25',  4, '1010010011101'),
+    (2097, '02-12',  0, '101000101101'),
+    (2098, '02-01',  0, '110100010101'),
+    (2099, '01-21',  2, '1101100100101'),
+    (2100, '02-09',  0, '110101010010'),
+)
+
+MONTH_BITS = 13
+LEAP_SHIFT = 7
+YDAY_BITS = 6
+
+
+# ==================== 壓縮 ====================
+
+def new_year_yday(date):
+    month, day = (int(part) for part in date.split('-'))
+    # 正月初一只落在 1 月 21 日至 2 月 20 日，不受閏年影響
+    return (0 if month == 1 else 31) + day - 1
+
+
+def pack_year(year, date, leap, months):
+    if len(months) != (13 if leap else 12):
+        raise ValueError('%d: %d months with leap month %d' % (year, len(months), leap))
+    if any(bit not in '01' for bit in months):
+        raise ValueError('%d: bad month lengths %r' % (year, months))
+    yday = new_year_yday(date)
+    if not 0 <= yday < (1 << YDAY_BITS) or not 0 <= leap <= 12:
+        raise ValueError('%d: new year %s / leap %d out of range' % (year, date, leap))
+
+    info = 0
+    for index, big in enumerate(months):
+        if big == '1':
+            info |= 1 << (23 - index)
+    return info | leap << LEAP_SHIFT | yday
+
+
+def check_continuity():
+    """相鄰兩年：前一年的總天數必須恰好接上下一年的正月初一。"""
+    for (year, date, leap, months), (next_year, next_date, _, _) in zip(LUNAR_YEARS, LUNAR_YEARS[1:]):
+        if next_year != year + 1:
+            raise ValueError('%d: years must be consecutive' % next_year)
+        days = sum(30 if big == '1' else 29 for big in months)
+        year_days = 366 if year % 4 == 0 and (year % 100 != 0 or year % 400 == 0) else 365
+        if new_year_yday(date) + days != year_days + new_year_yday(next_date):
+            raise ValueError('%d: months do not reach the next new year' % year)
+
+
+# ==================== 輸出 ====================
+
+def render_header():
+    first, last = LUNAR_YEARS[0][0], LUNAR_YEARS[-1][0]
+    out = []
+    out.append('// 由 tools/build_lunar.py 產生，請勿手動修改')
+    out.append('#pragma once')
+    out.append('')
+    out.append('#define LUNAR_FIRST_YEAR %d' % first)
+    out.append('#define LUNAR_LAST_YEAR %d' % last)
+    out.append('')
+    out.append('// 每年 3 bytes（高位在前）解開後的欄位，見 build_lunar.py')
+    out.append('#define LUNAR_INFO_BIG_MONTH(info, index) (((info) >> (23 - (index))) & 1)')
+    out.append('#define LUNAR_INFO_LEAP_MONTH(info) (((info) >> %d) & 0xF)' % LEAP_SHIFT)
+    out.append('#define LUNAR_INFO_NEW_YEAR_YDAY(info) ((info) & 0x%X)' % ((1 << YDAY_BITS) - 1))
+    out.append('')
+    out.append('// 以 (農曆年 - LUNAR_FIRST_YEAR) * 3 為索引')
+    out.append('static const uint8_t LUNAR_YEAR_INFO[%d] = {' % (len(LUNAR_YEARS) * 3))
+    for year, date, leap, months in LUNAR_YEARS:
+        info = pack_year(year, date, leap, months)
+        out.append('    0x%02X, 0x%02X, 0x%02X,  // %d' % (info >> 16, (info >> 8) & 0xFF, info & 0xFF, year))
+    out.append('};')
+    out.append('')
+    return '\n'.join(out).encode('utf-8')
+
+
+def build(repo_root):
+    check_continuity()
+    build_atlas.write_if_changed(os.path.join(repo_root, 'src', 'c', 'lunar_table.auto.h'), render_header())
+
+
+if __name__ == '__main__':
+    build(sys.argv[1] if len(sys.argv) > 1 else
+          os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+"""
+中文數字查表產生器。
+
+依下列規則為每個顯示欄位產生完整的字形查表，寫入 src/c/numeral_tables.auto.h，
+錶盤於 tick 時只需以 tm 欄位為索引各讀一次：
+  HOUR_GLYPHS_12H / HOUR_GLYPHS_24H  ─ 以 tm_hour（0–23）為索引
+  MINUTE_GLYPHS                      ─ 以 tm_min（0–59）為索引
+  MONTH_GLYPHS                       ─ 以月份（1–12）為索引
+  DAY_GLYPHS                         ─ 以 tm_mday（1–31）為索引
+  WEEKDAY_GLYPHS                     ─ 以 tm_wday（0–6）為索引
+  LUNAR_MONTH_GLYPHS                 ─ 以農曆月份（1–12）為索引，只有個位格（十位格為「閏」或留空）
+  LUNAR_DAY_GLYPHS                   ─ 以農曆日（1–30）為索引
+每筆為 [十位格, 個位格]（星期只有一格），NONE 表示該格留空。
+
+以完整的 1440 分鐘 × 4 格建表約需 11 KB，Aplite 的應用程式記憶體放不下；
+時、分、月、日各自獨立，分欄建表合計約 300 bytes 即可涵蓋全部組合。
+
+wscript 於每次建置前呼叫 build()；內容未變時不會改寫檔案。
+用法：build_numerals.py [repo_root]
+"""
+
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import build_atlas  # noqa: E402
+
+NONE = 'NONE'
+
+
+# ==================== 數字規則 ====================
+#
+# 字形前綴：U = 大號大寫（時）、L = 大號小寫（分）、SU / SL = 縮小版（月 / 日、星期）。
+# 各字形的數字 n 代表「n」，10 代表「十」，20 代表「廿」，30 代表「卅」，0 代表零。
+
+def hour_glyphs(hour):
+    """時：十位為 0 時留空，整十以「十」作個位（十、二十），0 點顯示「零」。"""
+    if hour == 0:
+        return (NONE, 'U0')
+    if hour == 10:
+        return (NONE, 'U10')
+    tens, ones = divmod(hour, 10)
+    return ({0: NONE, 1: 'U10', 2: 'U2'}[tens], 'U10' if ones == 0 else 'U%d' % ones)
+
+
+def minute_glyphs(minute):
+    """分：
+      :00 → 「點整」，:30 → 「點半」
+      :10 → L1 + L0
+      個位為 0 的其餘整十（:20、:40、:50）→ 「二十」「四十」「五十」
+      其餘 → 十位取 零 / 十 / 廿 / 卅 / 四 / 五，個位取「一」至「九」
+    """
+    if minute == 0:
+        return ('DIAN', 'ZHENG')
+    if minute == 30:
+        return ('DIAN', 'BAN')
+    if minute == 10:
+        return ('L1', 'L0')
+    tens, ones = divmod(minute, 10)
+    if ones == 0:
+        return ('L%d' % tens, 'L10')
+    return ({0: 'L0', 1: 'L10', 2: 'L20', 3: 'L30', 4: 'L4', 5: 'L5'}[tens], 'L%d' % ones)
+
+
+def month_glyphs(month):
+    """月：十月為「十」，十一、十二月為「十一」「十二」。"""
+    if month == 10:
+        return (NONE, 'SU10')
+    tens, ones = divmod(month, 10)
+    return ('SU10' if tens else NONE, 'SU%d' % ones)
+
+
+def day_glyphs(day):
+    """日：整十為「十」「二十」「三十」，其餘十位取「十 / 廿 / 卅」。"""
+    tens, ones = divmod(day, 10)
+    if tens == 0:
+        return (NONE, 'SL%d' % ones)
+    if ones == 0:
+        return (NONE, 'SL10') if tens == 1 else ('SL%d' % tens, 'SL10')
+    return ('SL%d' % (tens * 10), 'SL%d' % ones)
+
+
+def weekday_glyph(wday):
+    """星期：週日為「日」，其餘為「一」至「六」。"""
+    return 'RI' if wday == 0 else 'SL%d' % wday
+
+
+def lunar_month_glyph(month):
+    """農曆月：正月、二月至十月、冬月、臘月；閏月由錶盤於前一格補上「閏」。"""
+    return {1: 'SZHENG', 11: 'DONG', 12: 'LA'}.get(month, 'SL%d' % month)
+
+
+def lunar_day_glyphs(day):
+    """農曆日：初一至初十、十一至十九、二十、廿一至廿九、三十。"""
+    if day <= 10:
+        return ('CHU', 'SL%d' % day)
+    tens, ones = divmod(day, 10)
+    if ones == 0:
+        return ('SL%d' % tens, 'SL10')
+    return ({1: 'SL10', 2: 'SL20'}[tens], 'SL%d' % ones)
+
+
+def hour_12h(hour):
+    return hour % 12 or 12
+
+
+# ==================== 輸出 ====================
+
+def glyph(name):
+    return 'GLYPH_%s' % name
+
+
+def render_pairs(out, name, comment, rows, first_index=0):
+    out.append('// %s' % comment)
+    out.append('static const uint8_t %s[%d][2] = {' % (name, first_index + len(rows)))
+    for index, (tens, ones) in enumerate(rows, first_index):
+        out.append('    [%d] = {%s, %s},' % (index, glyph(tens), glyph(ones)))
+    out.append('};')
+    out.append('')
+
+
+def render_header():
+    out = []
+    out.append('// 由 tools/build_numerals.py 產生，請勿手動修改')
+    out.append('#pragma once')
+    out.append('')
+    out.append('#include "glyph_atlas.auto.h"')
+    out.append('')
+    render_pairs(out, 'HOUR_GLYPHS_12H', '12 小時制，以 tm_hour 為索引',
+                 [hour_glyphs(hour_12h(h)) for h in range(24)])
+    render_pairs(out, 'HOUR_GLYPHS_24H', '24 小時制，以 tm_hour 為索引',
+                 [hour_glyphs(h) for h in range(24)])
+    render_pairs(out, 'MINUTE_GLYPHS', '以 tm_min 為索引',
+                 [minute_glyphs(m) for m in range(60)])
+    render_pairs(out, 'MONTH_GLYPHS', '以月份（tm_mon + 1）為索引，[0] 不使用',
+                 [month_glyphs(m) for m in range(1, 13)], first_index=1)
+    render_pairs(out, 'DAY_GLYPHS', '以 tm_mday 為索引，[0] 不使用',
+                 [day_glyphs(d) for d in range(1, 32)], first_index=1)
+    out.append('// 以 tm_wday 為索引')
+    out.append('static const uint8_t WEEKDAY_GLYPHS[7] = {')
+    for wday in range(7):
+        out.append('    [%d] = %s,' % (wday, glyph(weekday_glyph(wday))))
+    out.append('};')
+    out.append('')
+    out.append('// 以農曆月份為索引，[0] 不使用')
+    out.append('static const uint8_t LUNAR_MONTH_GLYPHS[13] = {')
+    for month in range(1, 13):
+        out.append('    [%d] = %s,' % (month, glyph(lunar_month_glyph(month))))
+    out.append('};')
+    out.append('')
+    render_pairs(out, 'LUNAR_DAY_GLYPHS', '以農曆日為索引，[0] 不使用',
+                 [lunar_day_glyphs(d) for d in range(1, 31)], first_index=1)
+    return '\n'.join(out).encode('utf-8')
+
+
+def check_glyph_names(header):
+    """表中引用的每個字形都必須存在於圖集，避免規則寫錯時產生無法編譯或錯置的表。"""
+    known = {name for name, _, _ in build_atlas.ALL_GLYPHS} | {NONE}
+    for token in header.decode('utf-8').replace(',', ' ').replace('{', ' ').replace('}', ' ').split():
+        if token.startswith('GLYPH_') and token[len('GLYPH_'):] not in known:
+            raise ValueError('unknown glyph in numeral tables: %s' % token)
+
+
+def build(repo_root):
+    header = render_header()
+    check_glyph_names(header)
+    build_atlas.write_if_changed(os.path.join(repo_root, 'src', 'c', 'numeral_tables.auto.h'), header)
+
+
+if __name__ == '__main__':
+    build(sys.argv[1] if len(sys.argv) > 1 else
+          os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
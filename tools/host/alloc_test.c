@@ -0,0 +1,133 @@
+// 穩定運作時的堆積配置檢查
+//
+// 以動畫開啟與關閉各重播一個月的每分鐘 tick，確認視窗載入後錶盤不再配置或釋放任何記憶體：
+// 換字動畫的 Animation 與 Aplite 字形預取的 AppTimer 都只建立一次並重複使用，
+// 之後的 tick 不得有任何堆積配置，且重播結束時的堆積用量與載入後相同。
+// 動畫於第一次換圖時才建立，計數自第一個 tick 之後開始。
+// 以 -DUSE_BITMAP_LAYERS 編譯時另外確認日期列圖層佔用的堆積少於它取代的每格一個 BitmapLayer。
+//
+// 用法：alloc_test（全部通過時回傳 0）
+#define main ccwatchface_main
+#include "../../src/c/ccwatchface.c"
+#undef main
+
+#include "host.h"
+
+// 起點：2026-01-01 00:00 UTC，涵蓋跨日與跨月
+#define START_EPOCH 1767225600
+#define REPLAY_DAYS 31
+
+static int s_failures;
+
+static void expect_equal(const char *label, const char *what, uint64_t got, uint64_t expected) {
+    if (got == expected) return;
+    s_failures++;
+    fprintf(stderr, "  %s: %s %llu, expected %llu\n", label, what,
+            (unsigned long long)got, (unsigned long long)expected);
+}
+
+static TimeUnits units_between(const struct tm *prev, const struct tm *now) {
+    TimeUnits units = MINUTE_UNIT;
+    if (prev->tm_hour != now->tm_hour) units |= HOUR_UNIT;
+    if (prev->tm_mday != now->tm_mday) units |= DAY_UNIT;
+    if (prev->tm_mon != now->tm_mon) units |= MONTH_UNIT;
+    if (prev->tm_year != now->tm_year) units |= YEAR_UNIT;
+    return units;
+}
+
+static void replay_month(bool animated) {
+    const char *label = animated ? "animated" : "static";
+
+    host_persist_clear();
+    host_reset();
+    host_set_time(START_EPOCH);
+    persist_write_bool(KEY_ANIMATION_ENABLED, animated);
+
+    app_init();
+    host_run_until_idle();
+    size_t loaded_heap = 0;
+    HostCounters before = host_counters;
+
+    for (int m = 1; m <= REPLAY_DAYS * 24 * 60; m++) {
+        if (m == 2) {
+            loaded_heap = heap_bytes_used();
+            before = host_counters;
+        }
+        time_t prev_time = host_get_time();
+        time_t target = START_EPOCH + (time_t)m * 60;
+        struct tm prev;
+        struct tm now;
+        localtime_r(&prev_time, &prev);
+        localtime_r(&target, &now);
+
+        host_advance_ms((uint32_t)(target - prev_time) * 1000);
+        host_tick(units_between(&prev, &now));
+        host_run_until_idle();
+    }
+
+    uint64_t allocs = host_counters.heap_allocs - before.heap_allocs;
+    uint64_t frees = host_counters.heap_frees - before.heap_frees;
+
+    expect_equal(label, "heap allocations", allocs, 0);
+    expect_equal(label, "heap frees", frees, 0);
+    expect_equal(label, "timers registered", host_counters.timers_registered - before.timers_registered, 0);
+    expect_equal(label, "gbitmap_create_with_resource calls",
+                 host_counters.resource_bitmap_loads - before.resource_bitmap_loads, 0);
+    expect_equal(label, "heap bytes in use after the month", heap_bytes_used(), loaded_heap);
+    if (!animated) {
+        expect_equal(label, "animations scheduled", host_counters.animations_scheduled - before.animations_scheduled, 0);
+    } else if (host_counters.animation_frames == before.animation_frames) {
+        s_failures++;
+        fprintf(stderr, "  %s: no animation frames\n", label);
+    }
+    expect_equal(label, "calls on freed animations", host_invalid_animation_calls(), 0);
+
+    app_deinit();
+    expect_equal(label, "heap bytes in use after unload", heap_bytes_used(), 0);
+
+    printf("%s: %llu allocations over %d days (%llu animation frames)", label,
+           (unsigned long long)allocs, REPLAY_DAYS,
+           (unsigned long long)(host_counters.animation_frames - before.animation_frames));
+}
+
+#if defined(USE_DATE_ROW_COMPOSITOR)
+// 卸下日期列前後的堆積差即其用量；與同樣格數的 BitmapLayer 比較
+static void check_date_row_heap(void) {
+    const char *label = "date row";
+    host_persist_clear();
+    host_reset();
+    host_set_time(START_EPOCH);
+    app_init();
+    host_run_until_idle();
+
+    size_t before = heap_bytes_used();
+    BitmapLayer *layer = bitmap_layer_create(GRectZero);
+    size_t per_layer = heap_bytes_used() - before;
+    bitmap_layer_destroy(layer);
+
+    size_t cells = 0;
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        if (display_layer_in_date_row(ALL_DISPLAY_LAYERS[i])) cells++;
+    }
+    date_row_unload();
+    size_t row = before - heap_bytes_used();
+    if (row == 0 || row >= cells * per_layer) {
+        s_failures++;
+        fprintf(stderr, "  %s: %zu B, not less than %zu BitmapLayers (%zu B)\n", label, row, cells,
+                cells * per_layer);
+    }
+    app_deinit();
+    printf("date row %zu B instead of %zu B, ", row, cells * per_layer);
+}
+#endif
+
+int main(void) {
+#if defined(USE_DATE_ROW_COMPOSITOR)
+    check_date_row_heap();
+#endif
+    replay_month(true);
+    printf(", ");
+    replay_month(false);
+    printf(", %d failures\n", s_failures);
+    return s_failures ? 1 : 0;
+}
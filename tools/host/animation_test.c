@@ -0,0 +1,127 @@
+// 換圖動畫引擎的檢查
+//
+// 確認：
+//   緩動表查出的位移兩端為 0、中點為 ANIMATION_OFFSET_Y，前後對稱、單調，與平方緩動相差不到 1 像素；
+//   一次換圖畫出的影格數不超過影格率上限允許的數量，且與省電策略估算的影格數（anim_batch_count_redraws）相同；
+//   每次繪製都超過影格預算時略過影格，但中點照常換字，結束時的畫面與繪製不超時時相同；
+//   畫出與略過的影格數計入效能計數器。
+// 以 -DPERF_COUNTERS 編譯，讀取引擎回報的計數。
+//
+// 用法：animation_test（全部通過時回傳 0）
+#define main ccwatchface_main
+#include "../../src/c/ccwatchface.c"
+#undef main
+
+#include "host.h"
+
+#include <math.h>
+
+// 起點：2026-01-01 09:41:00 UTC；下一分鐘兩個分鐘格子一起換字，不跨整點（不觸發效能計數器匯出）
+#define START_EPOCH 1767260460
+
+static uint32_t framebuffer_hash(void) {
+    GSize size = host_screen_size();
+    const uint8_t *pixels = (const uint8_t *)host_framebuffer();
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < size.w * size.h; i++) {
+        hash = (hash ^ pixels[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static void launch(void) {
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(START_EPOCH);
+    host_set_rendering(true);
+    app_init();
+    host_run_until_idle();
+}
+
+static void quit(void) {
+    app_deinit();
+    host_set_rendering(false);
+}
+
+typedef struct {
+    uint32_t frames;
+    uint32_t dropped;
+    GlyphId minute;
+    uint32_t hash;
+} Transition;
+
+// 換到下一分鐘並播放完換圖動畫
+static Transition play_minute_change(uint32_t render_cost_ms) {
+    launch();
+    host_set_render_cost_ms(render_cost_ms);
+    const uint32_t *values = s_app.perf.values;
+    uint32_t frames = values[PERF_ANIM_FRAMES];
+    uint32_t dropped = values[PERF_ANIM_DROPPED];
+
+    host_advance_ms(60 * 1000);
+    host_tick(MINUTE_UNIT);
+    host_run_until_idle();
+
+    Transition result = {
+        .frames = values[PERF_ANIM_FRAMES] - frames,
+        .dropped = values[PERF_ANIM_DROPPED] - dropped,
+        .minute = s_app.minute_layers[1].current_glyph,
+        .hash = framebuffer_hash(),
+    };
+    quit();
+    return result;
+}
+
+// ==================== 緩動表 ====================
+
+static void check_easing(void) {
+    const char *label = "easing";
+    const int32_t half = ANIMATION_NORMALIZED_MAX / 2;
+    host_check(anim_batch_offset(0) == 0 && anim_batch_offset(ANIMATION_NORMALIZED_MAX) == 0, label,
+               "ends not at rest");
+    host_check(anim_batch_offset(half) == ANIMATION_OFFSET_Y, label, "midpoint not at the full offset");
+
+    bool symmetric = true, monotonic = true, close = true;
+    int16_t previous = 0;
+    for (int32_t p = 0; p <= half; p += 16) {
+        int16_t offset = anim_batch_offset(p);
+        symmetric &= offset == anim_batch_offset(ANIMATION_NORMALIZED_MAX - p);
+        monotonic &= offset >= previous;
+        double s = (double)p / half;
+        close &= fabs(offset - ANIMATION_OFFSET_Y * s * s) < 1.0;
+        previous = offset;
+    }
+    host_check(symmetric, label, "exit and entry not mirrored");
+    host_check(monotonic, label, "offset not monotonic");
+    host_check(close, label, "offset more than a pixel from the quadratic curve");
+}
+
+// ==================== 影格率上限與預算 ====================
+
+static void check_frames(void) {
+    const char *label = "frames";
+    Transition normal = play_minute_change(0);
+    host_check(normal.frames > 0, label, "no frames reported");
+    host_check(normal.frames <= ANIMATION_DURATION_MS / ANIMATION_FRAME_INTERVAL_MS + 2, label, "frame cap exceeded");
+    host_check(normal.frames == anim_batch_count_redraws(), label, "frames differ from the power policy estimate");
+    host_check(normal.dropped == 0, label, "frames dropped without overruns");
+
+    // 每次繪製都超過一個影格間隔
+    Transition slow = play_minute_change(ANIMATION_FRAME_INTERVAL_MS + 1);
+    host_check(slow.dropped > 0, label, "no frames dropped on overruns");
+    host_check(slow.frames < normal.frames, label, "overruns did not reduce frames");
+    host_check(slow.minute == normal.minute, label, "minute not swapped with overruns");
+    host_check(slow.hash == normal.hash, label, "final face differs with overruns");
+}
+
+int main(void) {
+    setenv("TZ", "UTC", 1);
+    tzset();
+
+    check_easing();
+    check_frames();
+    printf("animation: %d checks, %d failures (cap %d fps, %u frames per transition)\n",
+           host_checks, host_failures, ANIMATION_FPS_CAP, (unsigned)anim_batch_count_redraws());
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,877 @@
+// 主機端基準測試
+//
+// 直接引入未經修改的 src/c/ccwatchface.c，於模擬環境中啟動錶盤，
+// 以 12/24 小時制逐分鐘重播一整年，統計每次 tick 的資源載入、堆積配置、動畫排程與重繪標記；
+// render 情境另以軟體繪製量測每次重繪的像素數與耗時；
+// power 情境模擬電量下降、勿擾模式與通知覆蓋，比較省電策略開關時的動畫與重繪影格數；
+// settings 情境統計啟動時的設定讀取次數，以及重複儲存相同設定時的 flash 寫入次數；
+// launch 情境量測再次啟動到畫出第一個影格的耗時，以及第一個影格是否就是離開時的畫面；
+// boundary 情境量測分鐘交界時（tick 到動畫結束）的資源載入次數、tick 到第一個影格的耗時與字形預取命中；
+// theme 情境反覆切換兩組配色，統計每次切換的資源載入、堆積配置與耗時，並確認畫面與直接以該配色啟動相同；
+// seconds 情境開啟秒數指示並模擬一小時內數次看錶，統計顯示期間每秒的重繪面積與耗時；
+// perf 情境（僅 bench-perf）以與 src/js/app.js 相同的方式彙總錶盤每小時匯出的效能計數器。
+//
+// 用法：bench [scenario] [--days N] [--render-days N] [--power-days N]
+#define main ccwatchface_main
+#include "../../src/c/ccwatchface.c"
+#undef main
+
+#include "host.h"
+
+#include <stddef.h>
+
+#if defined(PBL_PLATFORM_APLITE)
+    #define PLATFORM_NAME "aplite"
+#elif defined(PBL_PLATFORM_BASALT)
+    #define PLATFORM_NAME "basalt"
+#elif defined(PBL_PLATFORM_DIORITE)
+    #define PLATFORM_NAME "diorite"
+#elif defined(PBL_PLATFORM_EMERY)
+    #define PLATFORM_NAME "emery"
+#endif
+
+#if defined(USE_RLE_GLYPHS)
+    #define RENDERER_NAME "canvas, RLE glyph stream"
+#elif defined(USE_FRAMEBUFFER_BLITTER)
+    #define RENDERER_NAME "canvas, framebuffer blitter"
+#elif defined(USE_CANVAS_RENDERER)
+    #define RENDERER_NAME "canvas, graphics_draw_bitmap_in_rect"
+#else
+    #define RENDERER_NAME "bitmap layers"
+#endif
+
+#if defined(USE_RLE_GLYPHS)
+    #define GLYPH_SOURCE_NAME "glyph stream"
+#elif defined(USE_GLYPH_ATLAS)
+    #define GLYPH_SOURCE_NAME "glyph atlas"
+#else
+    #define GLYPH_SOURCE_NAME "glyph cache"
+#endif
+
+// 重播起點：2026-01-01 00:00 UTC（星期四）
+#define REPLAY_START_EPOCH 1767225600
+
+static int s_replay_days = 365;
+static int s_render_days = 1;
+static int s_power_days = 1;
+
+// ==================== 指標統計 ====================
+
+typedef struct {
+    const char *label;
+    size_t offset;
+} MetricSpec;
+
+static const MetricSpec METRICS[] = {
+    {"gbitmap_create_with_resource", offsetof(HostCounters, resource_bitmap_loads)},
+    {"resource_load", offsetof(HostCounters, resource_raw_loads)},
+    {"resource bytes read", offsetof(HostCounters, resource_bytes_read)},
+    {"heap allocations", offsetof(HostCounters, heap_allocs)},
+    {"heap bytes allocated", offsetof(HostCounters, heap_bytes_allocated)},
+    {"heap bytes freed", offsetof(HostCounters, heap_bytes_freed)},
+    {"animations scheduled", offsetof(HostCounters, animations_scheduled)},
+    {"animation frames", offsetof(HostCounters, animation_frames)},
+    {"layers marked dirty", offsetof(HostCounters, layers_marked_dirty)},
+};
+
+#define METRIC_COUNT ARRAY_LENGTH(METRICS)
+
+typedef struct {
+    uint64_t ticks;
+    uint64_t flash_free_ticks;
+    uint64_t total[METRIC_COUNT];
+    uint64_t max[METRIC_COUNT];
+} TickStats;
+
+static uint64_t counter_value(const HostCounters *counters, size_t index) {
+    return *(const uint64_t *)((const char *)counters + METRICS[index].offset);
+}
+
+// 字形載入次數：圖集平台與舊版逐張載入以 gbitmap_create_with_resource，Aplite 的快取槽位以 resource_load
+static uint64_t glyph_loads(const HostCounters *counters) {
+    return counters->resource_bitmap_loads + counters->resource_raw_loads;
+}
+
+static void stats_record(TickStats *stats, const HostCounters *before, const HostCounters *after) {
+    stats->ticks++;
+    if (glyph_loads(after) == glyph_loads(before)) stats->flash_free_ticks++;
+    for (size_t i = 0; i < METRIC_COUNT; i++) {
+        uint64_t delta = counter_value(after, i) - counter_value(before, i);
+        stats->total[i] += delta;
+        if (delta > stats->max[i]) stats->max[i] = delta;
+    }
+}
+
+static void stats_print(const TickStats *stats) {
+    printf("  %-30s %12s %12s %10s\n", "metric", "total", "per tick", "max/tick");
+    for (size_t i = 0; i < METRIC_COUNT; i++) {
+        double mean = stats->ticks ? (double)stats->total[i] / (double)stats->ticks : 0.0;
+        printf("  %-30s %12llu %12.3f %10llu\n", METRICS[i].label,
+               (unsigned long long)stats->total[i], mean, (unsigned long long)stats->max[i]);
+    }
+}
+
+// ==================== 模擬驅動 ====================
+
+static TimeUnits units_between(const struct tm *prev, const struct tm *now) {
+    TimeUnits units = MINUTE_UNIT;
+    if (prev->tm_hour != now->tm_hour) units |= HOUR_UNIT;
+    if (prev->tm_mday != now->tm_mday) units |= DAY_UNIT;
+    if (prev->tm_mon != now->tm_mon) units |= MONTH_UNIT;
+    if (prev->tm_year != now->tm_year) units |= YEAR_UNIT;
+    return units;
+}
+
+// 將模擬時鐘推進到 target，觸發對應的 tick 並跑完所有動畫
+static void advance_to_minute(time_t target) {
+    time_t prev_time = host_get_time();
+    struct tm prev;
+    struct tm now;
+    localtime_r(&prev_time, &prev);
+    localtime_r(&target, &now);
+
+    host_advance_ms((uint32_t)(target - prev_time) * 1000);
+    host_tick(units_between(&prev, &now));
+    host_run_until_idle();
+}
+
+// ==================== 情境：整年重播 ====================
+
+static void run_year_replay(bool is_24h) {
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(is_24h);
+    host_set_time(REPLAY_START_EPOCH);
+
+    app_init();
+    host_run_until_idle();
+    size_t startup_heap = heap_bytes_used();
+    host_heap_reset_peak();
+
+    TickStats stats;
+    memset(&stats, 0, sizeof(stats));
+
+    uint64_t minutes = (uint64_t)s_replay_days * 24 * 60;
+    for (uint64_t m = 1; m <= minutes; m++) {
+        HostCounters before = host_counters;
+        advance_to_minute(REPLAY_START_EPOCH + (time_t)(m * 60));
+        stats_record(&stats, &before, &host_counters);
+    }
+
+    size_t peak_heap = host_heap_peak();
+#if defined(USE_GLYPH_CACHE)
+    GlyphCacheStats cache = s_app.glyph_cache.stats;
+#endif
+    app_deinit();
+
+    printf("== %s · year replay (%s, %s, %d days) ==\n", PLATFORM_NAME, RENDERER_NAME,
+           is_24h ? "24h" : "12h", s_replay_days);
+    printf("  ticks %llu, heap after load %zu B, peak %zu B of %zu B, leaked %zu B, invalid animation calls %u\n",
+           (unsigned long long)stats.ticks, startup_heap, peak_heap, host_heap_capacity(),
+           heap_bytes_used(), host_invalid_animation_calls());
+#if defined(USE_GLYPH_ATLAS) || defined(USE_RLE_GLYPHS)
+    printf("  %s: ticks without glyph loads %.1f%%\n", GLYPH_SOURCE_NAME,
+           100.0 * stats.flash_free_ticks / (stats.ticks ? stats.ticks : 1));
+#else
+    printf("  glyph cache: %lu hits, %lu misses (%.1f%% hit), %lu evictions, %lu B resident; "
+           "ticks without glyph loads %.1f%%\n",
+           (unsigned long)cache.hits, (unsigned long)cache.misses,
+           100.0 * cache.hits / (cache.hits + cache.misses ? cache.hits + cache.misses : 1),
+           (unsigned long)cache.evictions, (unsigned long)cache.bytes_used,
+           100.0 * stats.flash_free_ticks / (stats.ticks ? stats.ticks : 1));
+    printf("  glyph prefetch: %lu loads, %lu hits, %lu evicted before use\n",
+           (unsigned long)cache.prefetch_loads, (unsigned long)cache.prefetch_hits,
+           (unsigned long)cache.prefetch_wasted);
+#endif
+    stats_print(&stats);
+}
+
+static void scenario_year(void) {
+    run_year_replay(false);
+    run_year_replay(true);
+}
+
+// ==================== 情境：繪製量測 ====================
+
+// 此建置使用的字形資源（圖集、逐張字形或字形串流）於 flash 中的位元組數；
+// package.json 一律列出全部三組，未使用的一組不計入
+static bool glyph_resource_used(const char *name) {
+#if defined(USE_RLE_GLYPHS)
+    return strcmp(name, "GLYPH_RLE") == 0;
+#else
+    return strcmp(name, "GLYPH_ATLAS") == 0 || strncmp(name, "IMG_", 4) == 0;
+#endif
+}
+
+static size_t glyph_resource_bytes(void) {
+    size_t bytes = 0;
+    for (int i = 0; i < HOST_RESOURCE_SLOTS; i++) {
+        const char *name = host_resources[i].name;
+        if (name && glyph_resource_used(name)) {
+            bytes += host_resources[i].file_size;
+        }
+    }
+    return bytes;
+}
+
+// FNV-1a，用於比對不同繪製方式在每分鐘結束時的畫面是否一致
+static uint32_t framebuffer_hash(uint32_t hash) {
+    GSize size = host_screen_size();
+    const uint8_t *pixels = (const uint8_t *)host_framebuffer();
+    for (int i = 0; i < size.w * size.h; i++) {
+        hash = (hash ^ pixels[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static void scenario_render(void) {
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(REPLAY_START_EPOCH);
+    host_set_rendering(true);
+
+    app_init();
+    host_run_until_idle();
+    size_t startup_heap = heap_bytes_used();
+    HostCounters before = host_counters;
+
+    uint32_t hash = 2166136261u;
+    uint64_t minutes = (uint64_t)s_render_days * 24 * 60;
+    for (uint64_t m = 1; m <= minutes; m++) {
+        advance_to_minute(REPLAY_START_EPOCH + (time_t)(m * 60));
+        hash = framebuffer_hash(hash);
+    }
+
+    uint64_t frames = host_counters.frames_rendered - before.frames_rendered;
+    uint64_t pixels = host_counters.pixels_drawn - before.pixels_drawn;
+    uint64_t layers = host_counters.layers_drawn - before.layers_drawn;
+    uint64_t render_ns = host_counters.render_ns - before.render_ns;
+    uint64_t bytes_read = host_counters.resource_bytes_read - before.resource_bytes_read;
+    size_t peak_heap = host_heap_peak();
+    app_deinit();
+    host_set_rendering(false);
+
+    printf("== %s · render (%s, %d days) ==\n", PLATFORM_NAME, RENDERER_NAME, s_render_days);
+    printf("  heap after load %zu B, frames %llu (%.2f per tick), framebuffer hash %08x\n",
+           startup_heap, (unsigned long long)frames, (double)frames / (double)(minutes ? minutes : 1), hash);
+    // 直寫畫面不經模擬的 graphics_* 函式，像素數只含其餘圖層（直寫路徑下為 0）
+    printf("  layers drawn per frame %.1f, pixels drawn per frame %.0f, host time per frame %.2f us\n",
+           frames ? (double)layers / (double)frames : 0.0,
+           frames ? (double)pixels / (double)frames : 0.0,
+           frames ? (double)render_ns / (double)frames / 1000.0 : 0.0);
+    printf("  %s: %zu B in flash, %.0f B read per frame, peak heap %zu B\n", GLYPH_SOURCE_NAME,
+           glyph_resource_bytes(), frames ? (double)bytes_read / (double)frames : 0.0, peak_heap);
+}
+
+// ==================== 情境：省電策略 ====================
+
+// 模擬一天的使用情境：電量每 15 分鐘下降 1%（約 20 小時後低於預設門檻），
+// 23:00–07:00 為勿擾模式，每小時 :20 起有通知覆蓋錶盤兩分鐘
+static void power_day_events(uint64_t minute, bool policy) {
+    int hour = (int)(minute / 60 % 24);
+    int min = (int)(minute % 60);
+    int percent = 100 - (int)(minute % (24 * 60) / 15);
+    host_set_battery((uint8_t)(percent > 0 ? percent : 0), false);
+    host_set_quiet_time(hour >= 23 || hour < 7);
+    if (policy) {
+        host_set_focus(!(min == 20 || min == 21));
+    }
+}
+
+static void run_power(bool policy) {
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(REPLAY_START_EPOCH);
+    host_set_rendering(true);
+
+    app_init();
+    host_run_until_idle();
+    if (!policy) {
+        // 基準：電量門檻設為 0 並關閉勿擾模式降級，且不發生通知覆蓋
+        const uint32_t keys[] = {KEY_POWER_SAVE_BATTERY, KEY_POWER_SAVE_QUIET_TIME};
+        const int32_t values[] = {0, 0};
+        host_deliver_message(keys, values, ARRAY_LENGTH(keys));
+        host_run_until_idle();
+    }
+    HostCounters before = host_counters;
+
+    // 每分鐘結束時（通知覆蓋期間除外）的畫面須與不啟用策略時相同
+    uint32_t hash = 2166136261u;
+    uint64_t minutes = (uint64_t)s_power_days * 24 * 60;
+    for (uint64_t m = 1; m <= minutes; m++) {
+        power_day_events(m, policy);
+        advance_to_minute(REPLAY_START_EPOCH + (time_t)(m * 60));
+        if (m % 60 != 20 && m % 60 != 21) hash = framebuffer_hash(hash);
+    }
+    host_set_focus(true);
+    host_run_until_idle();
+
+    uint64_t anim_frames = host_counters.animation_frames - before.animation_frames;
+    uint64_t frames = host_counters.frames_rendered - before.frames_rendered;
+    uint64_t pixels = host_counters.pixels_drawn - before.pixels_drawn;
+    uint32_t frames_saved = s_app.power.frames_saved;
+    app_deinit();
+    host_set_rendering(false);
+
+    printf("== %s · power (%s, policy %s, %d days) ==\n", PLATFORM_NAME, RENDERER_NAME,
+           policy ? "on" : "off", s_power_days);
+    printf("  animation frames %llu, frames rendered %llu, pixels drawn %llu, frames saved (app counter) %lu\n",
+           (unsigned long long)anim_frames, (unsigned long long)frames, (unsigned long long)pixels,
+           (unsigned long)frames_saved);
+    printf("  framebuffer hash %08x\n", hash);
+}
+
+static void scenario_power(void) {
+    run_power(false);
+    run_power(true);
+}
+
+// ==================== 情境：設定儲存 ====================
+
+// Clay 每次儲存送出的完整鍵值（皆為預設值）
+static const uint32_t CLAY_KEYS[] = {
+    KEY_BACKGROUND_COLOR, KEY_TEXT_COLOR, KEY_HOUR_COLOR, KEY_MINUTE_COLOR,
+    KEY_THEME_IS_DARK, KEY_BW_HOUR_ACCENT, KEY_ANIMATION_ENABLED,
+    KEY_POWER_SAVE_BATTERY, KEY_POWER_SAVE_QUIET_TIME, KEY_LUNAR_DATE, KEY_SECONDS_INDICATOR, KEY_SECONDS_TIMEOUT,
+};
+static const int32_t CLAY_DEFAULTS[] = {
+    0x000000, 0xFFFFFF, 0xFFAA00, 0xFFAA00, 1, 1, 1, POWER_SAVE_BATTERY_DEFAULT, 1, 0, 0, SECONDS_TIMEOUT_DEFAULT_S,
+};
+_Static_assert(ARRAY_LENGTH(CLAY_DEFAULTS) == ARRAY_LENGTH(CLAY_KEYS), "CLAY_DEFAULTS must cover CLAY_KEYS");
+
+#define SETTINGS_REPEATED_SAVES 10
+
+// 以舊版逐鍵格式寫入一組非預設設定
+static void write_legacy_settings(void) {
+    persist_write_int(KEY_BACKGROUND_COLOR, 0xFFFFFF);
+    persist_write_int(KEY_TEXT_COLOR, 0x000000);
+    persist_write_int(KEY_HOUR_COLOR, 0xFF0000);
+    persist_write_int(KEY_MINUTE_COLOR, 0x0000FF);
+    persist_write_bool(KEY_THEME_IS_DARK, false);
+    persist_write_bool(KEY_BW_HOUR_ACCENT, false);
+    persist_write_bool(KEY_ANIMATION_ENABLED, false);
+    persist_write_int(KEY_POWER_SAVE_BATTERY, 35);
+    persist_write_bool(KEY_POWER_SAVE_QUIET_TIME, false);
+}
+
+static bool legacy_settings_applied(void) {
+    bool ok = !s_app.animation_enabled && s_app.power.battery_threshold == 35 && !s_app.power.quiet_time_static;
+#if defined(PBL_COLOR)
+    ok = ok && gcolor_equal(s_app.theme.background, GColorWhite) && gcolor_equal(s_app.theme.hour_accent, GColorRed);
+#else
+    ok = ok && !s_app.theme.is_dark && !s_app.theme.bw_hour_accent;
+#endif
+    return ok;
+}
+
+// 啟動一次並回傳 app_init 期間的讀取與寫入次數；不清除已儲存的資料
+static void measure_startup(const char *label) {
+    host_reset();
+    host_set_time(REPLAY_START_EPOCH);
+    HostCounters before = host_counters;
+    app_init();
+    uint64_t reads = host_counters.persist_reads - before.persist_reads;
+    uint64_t writes = host_counters.persist_writes - before.persist_writes;
+    host_run_until_idle();
+    printf("  startup %-26s persist reads %2llu, writes %2llu\n", label,
+           (unsigned long long)reads, (unsigned long long)writes);
+}
+
+static void scenario_settings(void) {
+    printf("== %s · settings ==\n", PLATFORM_NAME);
+
+    host_persist_clear();
+    measure_startup("(fresh install)");
+    app_deinit();
+    measure_startup("(after fresh install)");
+    app_deinit();
+
+    host_persist_clear();
+    write_legacy_settings();
+    measure_startup("(per-key layout)");
+    bool migrated = legacy_settings_applied();
+    app_deinit();
+    measure_startup("(after migration)");
+    migrated = migrated && legacy_settings_applied();
+    printf("  migrated settings preserved: %s\n", migrated ? "yes" : "NO");
+    app_deinit();
+
+    // 重複儲存相同設定，再儲存一次有變動的設定
+    host_persist_clear();
+    host_reset();
+    host_set_time(REPLAY_START_EPOCH);
+    app_init();
+    host_run_until_idle();
+    HostCounters before = host_counters;
+    for (int i = 0; i < SETTINGS_REPEATED_SAVES; i++) {
+        host_deliver_message(CLAY_KEYS, CLAY_DEFAULTS, ARRAY_LENGTH(CLAY_KEYS));
+        host_run_until_idle();
+    }
+    uint64_t unchanged_writes = host_counters.persist_writes - before.persist_writes;
+
+    int32_t changed[ARRAY_LENGTH(CLAY_KEYS)];
+    memcpy(changed, CLAY_DEFAULTS, sizeof(changed));
+    changed[6] = 0;   // KEY_ANIMATION_ENABLED
+    before = host_counters;
+    host_deliver_message(CLAY_KEYS, changed, ARRAY_LENGTH(CLAY_KEYS));
+    host_run_until_idle();
+    uint64_t changed_writes = host_counters.persist_writes - before.persist_writes;
+    app_deinit();
+
+    printf("  %d identical Clay saves: persist writes %llu; one changed save: %llu\n",
+           SETTINGS_REPEATED_SAVES, (unsigned long long)unchanged_writes, (unsigned long long)changed_writes);
+}
+
+// ==================== 情境：再次啟動 ====================
+
+#define LAUNCH_REPEATS 50
+
+typedef struct {
+    uint64_t first_frame_ns;
+    uint64_t bitmap_loads;
+    uint64_t resource_bytes;
+    uint64_t frames_until_idle;
+    uint64_t animation_frames;
+    int first_frame_is_previous;      // 第一個影格與上次離開時的畫面相同
+    int runs;
+} LaunchStats;
+
+static uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// 於 now 啟動並跑完所有動畫後離開，回傳離開時的畫面雜湊；stats 非 NULL 時累計本次啟動的量測值
+static uint32_t launch_once(time_t now, uint32_t previous_hash, LaunchStats *stats) {
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(now);
+    host_set_rendering(true);
+
+    // window_stack_push 於視窗載入後立即畫出第一個影格
+    uint64_t start = monotonic_ns();
+    app_init();
+    uint64_t first_frame_ns = monotonic_ns() - start;
+    HostCounters first = host_counters;
+    uint32_t first_hash = framebuffer_hash(2166136261u);
+
+    host_run_until_idle();
+    uint32_t exit_hash = framebuffer_hash(2166136261u);
+    if (stats) {
+        stats->first_frame_ns += first_frame_ns;
+        stats->bitmap_loads += glyph_loads(&first);
+        stats->resource_bytes += first.resource_bytes_read;
+        stats->frames_until_idle += host_counters.frames_rendered;
+        stats->animation_frames += host_counters.animation_frames;
+        stats->first_frame_is_previous += first_hash == previous_hash;
+        stats->runs++;
+    }
+    app_deinit();
+    host_set_rendering(false);
+    return exit_hash;
+}
+
+static void launch_print(const char *label, const LaunchStats *stats) {
+    double runs = stats->runs ? stats->runs : 1;
+    printf("  %-20s first frame %.1f us, glyph loads %.1f, resource bytes %.0f, "
+           "frames until idle %.1f, animation frames %.1f, first frame shows previous face %d/%d\n",
+           label, stats->first_frame_ns / runs / 1000.0, stats->bitmap_loads / runs,
+           stats->resource_bytes / runs, stats->frames_until_idle / runs,
+           stats->animation_frames / runs, stats->first_frame_is_previous, stats->runs);
+}
+
+static void scenario_launch(void) {
+    const time_t start = REPLAY_START_EPOCH + 9 * 60 * 60 + 59 * 60;   // 09:59，下一分鐘時與分都換字
+    LaunchStats same_minute = {0};
+    LaunchStats next_minute = {0};
+
+    host_persist_clear();
+    uint32_t hash = launch_once(start, 0, NULL);
+    for (int i = 0; i < LAUNCH_REPEATS; i++) {
+        hash = launch_once(start, hash, &same_minute);
+    }
+    for (int i = 0; i < LAUNCH_REPEATS; i++) {
+        hash = launch_once(start, 0, NULL);
+        launch_once(start + 60, hash, &next_minute);
+    }
+
+    printf("== %s · launch (%s, %d launches each) ==\n", PLATFORM_NAME, RENDERER_NAME, LAUNCH_REPEATS);
+    launch_print("same minute", &same_minute);
+    launch_print("one minute later", &next_minute);
+}
+
+// ==================== 情境：主題切換 ====================
+
+#define THEME_SWITCHES 21
+
+// 與 CLAY_DEFAULTS 不同的另一組配色（白底黑字、紅色時、藍色分；黑白平台為淺色主題、不反白時）
+static const int32_t CLAY_ALTERNATE_THEME[] = {
+    0xFFFFFF, 0x000000, 0xFF0000, 0x0000FF, 0, 0, 1, POWER_SAVE_BATTERY_DEFAULT, 1, 0, 0, SECONDS_TIMEOUT_DEFAULT_S,
+};
+_Static_assert(ARRAY_LENGTH(CLAY_ALTERNATE_THEME) == ARRAY_LENGTH(CLAY_KEYS), "CLAY_ALTERNATE_THEME must cover CLAY_KEYS");
+
+// 以目前儲存的設定於 now 啟動並跑完動畫，回傳畫面雜湊
+static uint32_t theme_fresh_launch_hash(time_t now) {
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(now);
+    host_set_rendering(true);
+    app_init();
+    host_run_until_idle();
+    uint32_t hash = framebuffer_hash(2166136261u);
+    app_deinit();
+    host_set_rendering(false);
+    return hash;
+}
+
+static void scenario_theme(void) {
+    const time_t start = REPLAY_START_EPOCH + 9 * 60 * 60 + 41 * 60;
+
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(start);
+    app_init();
+    host_run_until_idle();
+
+    // 交替送出兩組配色，最後一次為 CLAY_ALTERNATE_THEME；切換期間不繪製，只量測套用主題的成本
+    HostCounters before = host_counters;
+    uint64_t begin = monotonic_ns();
+    for (int i = 0; i < THEME_SWITCHES; i++) {
+        const int32_t *values = (i % 2 == 0) ? CLAY_ALTERNATE_THEME : CLAY_DEFAULTS;
+        host_deliver_message(CLAY_KEYS, values, ARRAY_LENGTH(CLAY_KEYS));
+        host_run_until_idle();
+    }
+    uint64_t elapsed_ns = monotonic_ns() - begin;
+    double loads = (double)(glyph_loads(&host_counters) - glyph_loads(&before)) / THEME_SWITCHES;
+    double allocs = (double)(host_counters.heap_allocs - before.heap_allocs) / THEME_SWITCHES;
+
+    host_set_rendering(true);
+    layer_mark_dirty(window_get_root_layer(s_app.main_window));
+    host_render_pending();
+    uint32_t switched_hash = framebuffer_hash(2166136261u);
+    app_deinit();
+    host_set_rendering(false);
+
+    uint32_t fresh_hash = theme_fresh_launch_hash(start);
+
+    printf("== %s · theme (%s, %d switches) ==\n", PLATFORM_NAME, RENDERER_NAME, THEME_SWITCHES);
+    printf("  per switch: glyph loads %.1f, heap allocations %.1f, host time %.2f us\n",
+           loads, allocs, elapsed_ns / (double)THEME_SWITCHES / 1000.0);
+    printf("  face after switching matches a fresh launch with that theme: %s\n",
+           switched_hash == fresh_hash ? "yes" : "NO");
+}
+
+// ==================== 情境：分鐘交界 ====================
+
+#define BOUNDARY_DAYS 1
+
+typedef struct {
+    uint64_t ticks;
+    uint64_t loads;                 // tick 到動畫結束之間的 gbitmap_create_with_resource 次數
+    uint64_t loads_max;
+    uint64_t first_frame_ns;        // host_tick：tick_handler 加上第一次重繪（不含模擬環境的成本）
+    uint64_t first_frame_max_ns;
+    uint64_t app_ns;                // tick 到動畫結束之間錶盤本身的耗時（不含重繪）
+    uint64_t app_max_ns;
+} BoundaryStats;
+
+static void run_boundary(bool animated) {
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(REPLAY_START_EPOCH);
+    host_set_rendering(true);
+    app_init();
+    host_run_until_idle();
+    if (!animated) {
+        int32_t values[ARRAY_LENGTH(CLAY_KEYS)];
+        memcpy(values, CLAY_DEFAULTS, sizeof(values));
+        values[6] = 0;   // KEY_ANIMATION_ENABLED
+        host_deliver_message(CLAY_KEYS, values, ARRAY_LENGTH(CLAY_KEYS));
+        host_run_until_idle();
+    }
+#if defined(USE_GLYPH_CACHE)
+    GlyphCacheStats cache_before = s_app.glyph_cache.stats;
+#endif
+
+    BoundaryStats stats = {0};
+    uint64_t minutes = (uint64_t)BOUNDARY_DAYS * 24 * 60;
+    for (uint64_t m = 1; m <= minutes; m++) {
+        time_t prev_time = host_get_time();
+        time_t target = REPLAY_START_EPOCH + (time_t)(m * 60);
+        struct tm prev;
+        struct tm now;
+        localtime_r(&prev_time, &prev);
+        localtime_r(&target, &now);
+
+        // 交界前的計時器（含預取）於此觸發，不計入交界
+        host_advance_ms((uint32_t)(target - prev_time) * 1000);
+        HostCounters before = host_counters;
+        uint64_t start = monotonic_ns();
+        host_tick(units_between(&prev, &now));
+        uint64_t first_frame_ns = monotonic_ns() - start - (host_counters.emulation_ns - before.emulation_ns);
+        host_run_until_idle();
+        uint64_t app_ns = monotonic_ns() - start - (host_counters.render_ns - before.render_ns) -
+                          (host_counters.emulation_ns - before.emulation_ns);
+        uint64_t loads = glyph_loads(&host_counters) - glyph_loads(&before);
+
+        stats.ticks++;
+        stats.loads += loads;
+        stats.loads_max = MAX(stats.loads_max, loads);
+        stats.first_frame_ns += first_frame_ns;
+        stats.first_frame_max_ns = MAX(stats.first_frame_max_ns, first_frame_ns);
+        stats.app_ns += app_ns;
+        stats.app_max_ns = MAX(stats.app_max_ns, app_ns);
+    }
+#if defined(USE_GLYPH_CACHE)
+    GlyphCacheStats cache = s_app.glyph_cache.stats;
+#endif
+    app_deinit();
+    host_set_rendering(false);
+
+    double ticks = stats.ticks ? stats.ticks : 1;
+    printf("== %s · boundary (%s, %s, %d days) ==\n", PLATFORM_NAME, RENDERER_NAME,
+           animated ? "animated" : "static", BOUNDARY_DAYS);
+    printf("  glyph loads at the boundary %.3f per tick (max %llu); tick to first frame %.1f us (max %.1f); "
+           "app time until idle %.1f us (max %.1f)\n",
+           stats.loads / ticks, (unsigned long long)stats.loads_max,
+           stats.first_frame_ns / ticks / 1000.0, stats.first_frame_max_ns / 1000.0,
+           stats.app_ns / ticks / 1000.0, stats.app_max_ns / 1000.0);
+#if defined(USE_GLYPH_CACHE)
+    printf("  glyph cache misses %lu; prefetch %lu loads, %lu hits, %lu evicted before use\n",
+           (unsigned long)(cache.misses - cache_before.misses),
+           (unsigned long)(cache.prefetch_loads - cache_before.prefetch_loads),
+           (unsigned long)(cache.prefetch_hits - cache_before.prefetch_hits),
+           (unsigned long)(cache.prefetch_wasted - cache_before.prefetch_wasted));
+#endif
+}
+
+static void scenario_boundary(void) {
+    run_boundary(true);
+    run_boundary(false);
+}
+
+// ==================== 情境：秒數指示 ====================
+
+// 一小時內每 SECONDS_GLANCE_MINUTES 分鐘甩動手腕看一次錶，其中每隔一次於 SECONDS_GLANCE_LOWER_S 秒後放下手腕，
+// 其餘等秒數指示逾時自動關閉；統計顯示期間每秒（不含分鐘交界）的重繪成本，與整個畫面的像素數比較
+#define SECONDS_BENCH_MINUTES 60
+#define SECONDS_GLANCE_MINUTES 5
+#define SECONDS_GLANCE_LOWER_S 8
+
+typedef struct {
+    uint64_t ticks;                 // 顯示期間、分鐘未改變的 tick
+    uint64_t marks;                 // 以下皆為這些 tick 內的累計值
+    uint64_t frames;
+    uint64_t layers;
+    uint64_t pixels;
+    uint64_t pixels_max;
+    uint64_t render_ns;
+    uint64_t allocs;
+} SecondsStats;
+
+static void scenario_seconds(void) {
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(REPLAY_START_EPOCH);
+    host_set_rendering(true);
+    app_init();
+    host_run_until_idle();
+
+    int32_t values[ARRAY_LENGTH(CLAY_KEYS)];
+    memcpy(values, CLAY_DEFAULTS, sizeof(values));
+    values[10] = 1;   // KEY_SECONDS_INDICATOR
+    host_deliver_message(CLAY_KEYS, values, ARRAY_LENGTH(CLAY_KEYS));
+    host_run_until_idle();
+    // 開啟設定時即開始顯示；之後只在甩動手腕時顯示
+    while (s_app.seconds.active) {
+        host_advance_ms(1000);
+        host_tick(SECOND_UNIT);
+    }
+
+    SecondsStats stats = {0};
+    int glances = 0;
+    uint64_t active_s = 0;
+    uint64_t ticks = 0;
+    uint64_t seconds = (uint64_t)SECONDS_BENCH_MINUTES * 60;
+    time_t glance_at = 0;
+    for (uint64_t s = 1; s <= seconds; s++) {
+        time_t prev_time = host_get_time();
+        time_t target = prev_time + 1;
+        struct tm prev;
+        struct tm now;
+        localtime_r(&prev_time, &prev);
+        localtime_r(&target, &now);
+        host_advance_ms(1000);
+        if (glances % 2 == 0 && target - glance_at == SECONDS_GLANCE_LOWER_S) {
+            host_set_accel(-1000, 0, 0);
+        }
+
+        bool active = s_app.seconds.active;
+        TimeUnits units = prev.tm_min != now.tm_min ? units_between(&prev, &now) : SECOND_UNIT;
+        HostCounters before = host_counters;
+        host_tick(units);
+        if (active) active_s++;
+        if (active || (units & MINUTE_UNIT)) ticks++;
+
+        bool counted = active && !(units & MINUTE_UNIT);
+        if (counted) {
+            uint64_t pixels = host_counters.pixels_drawn - before.pixels_drawn;
+            stats.ticks++;
+            stats.marks += host_counters.layers_marked_dirty - before.layers_marked_dirty;
+            stats.frames += host_counters.frames_rendered - before.frames_rendered;
+            stats.layers += host_counters.layers_drawn - before.layers_drawn;
+            stats.pixels += pixels;
+            stats.pixels_max = MAX(stats.pixels_max, pixels);
+            stats.render_ns += host_counters.render_ns - before.render_ns;
+            stats.allocs += host_counters.heap_allocs - before.heap_allocs;
+        }
+
+        if (s % (SECONDS_GLANCE_MINUTES * 60) == 17) {
+            host_set_accel(0, 0, -1000);
+            host_accel_tap();
+            glance_at = target;
+            glances++;
+        }
+    }
+    GRect bar = layer_get_frame(s_app.seconds.layer);
+    app_deinit();
+    host_set_rendering(false);
+
+    GSize screen = host_screen_size();
+    double n = stats.ticks ? stats.ticks : 1;
+    printf("== %s · seconds (%s, %d minutes, a glance every %d minutes) ==\n", PLATFORM_NAME, RENDERER_NAME,
+           SECONDS_BENCH_MINUTES, SECONDS_GLANCE_MINUTES);
+    printf("  shown %llu s over %d glances (timeout %d s, every other glance lowers the wrist after %d s); "
+           "ticks delivered %llu of %llu seconds\n",
+           (unsigned long long)active_s, glances, SECONDS_TIMEOUT_DEFAULT_S, SECONDS_GLANCE_LOWER_S,
+           (unsigned long long)ticks, (unsigned long long)seconds);
+    // 直寫畫面不經模擬的 graphics_* 函式；秒數指示以 graphics_fill_rect 繪製，像素數即其重畫面積
+    printf("  per seconds tick: layers marked dirty %.2f, frames %.2f, layers drawn %.1f, pixels drawn %.1f "
+           "(max %llu, bar %d, screen %d), host time %.2f us, heap allocations %llu\n",
+           stats.marks / n, stats.frames / n, stats.layers / n, stats.pixels / n,
+           (unsigned long long)stats.pixels_max, bar.size.w * bar.size.h, screen.w * screen.h,
+           stats.render_ns / n / 1000.0, (unsigned long long)stats.allocs);
+}
+
+#if defined(PERF_COUNTERS)
+// ==================== 情境：效能計數器匯出 ====================
+
+// 與 src/js/app.js 相同：HEAP_PEAK、*_MS_MAX 取最大值，HEAP_USED 取最新值，其餘加總
+static uint32_t s_perf_totals[PERF_FIELD_COUNT];
+static int s_perf_reports;
+
+static void perf_outbox_sent(DictionaryIterator *iter, void *context) {
+    for (int i = 0; i < PERF_FIELD_COUNT; i++) {
+        Tuple *tuple = dict_find(iter, KEY_PERF_FIRST + i);
+        if (!tuple) return;
+        uint32_t value = (uint32_t)tuple->value->int32;
+        if (i == PERF_HEAP_PEAK || i == PERF_TICK_MS_MAX || i == PERF_LOAD_MS_MAX) {
+            s_perf_totals[i] = MAX(s_perf_totals[i], value);
+        } else if (i == PERF_HEAP_USED) {
+            s_perf_totals[i] = value;
+        } else {
+            s_perf_totals[i] += value;
+        }
+    }
+    s_perf_reports++;
+}
+
+static void scenario_perf(void) {
+    static const char *const TYPE_NAMES[LAYER_TYPE_COUNT] = {"hour", "minute accent", "minute", "date", "static"};
+
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(REPLAY_START_EPOCH);
+    memset(s_perf_totals, 0, sizeof(s_perf_totals));
+    s_perf_reports = 0;
+
+    app_init();
+    app_message_register_outbox_sent(perf_outbox_sent);
+    host_run_until_idle();
+
+    uint64_t minutes = (uint64_t)s_replay_days * 24 * 60;
+    for (uint64_t m = 1; m <= minutes; m++) {
+        advance_to_minute(REPLAY_START_EPOCH + (time_t)(m * 60));
+    }
+    uint64_t messages = host_counters.app_messages_sent;
+    app_deinit();
+
+    const uint32_t *t = s_perf_totals;
+    double ticks = t[PERF_TICKS] ? t[PERF_TICKS] : 1;
+    printf("== %s · perf counters (%s, %d days) ==\n", PLATFORM_NAME, RENDERER_NAME, s_replay_days);
+    printf("  reports %d (app messages %llu), ticks %lu, heap used %lu B, peak %lu B\n",
+           s_perf_reports, (unsigned long long)messages, (unsigned long)t[PERF_TICKS],
+           (unsigned long)t[PERF_HEAP_USED], (unsigned long)t[PERF_HEAP_PEAK]);
+    printf("  per tick: animations created %.3f, cancelled %.3f, tick ms %.2f (max %lu), load ms max %lu\n",
+           t[PERF_ANIM_CREATED] / ticks, t[PERF_ANIM_CANCELLED] / ticks, t[PERF_TICK_MS_TOTAL] / ticks,
+           (unsigned long)t[PERF_TICK_MS_MAX], (unsigned long)t[PERF_LOAD_MS_MAX]);
+    double transitions = t[PERF_ANIM_CREATED] ? t[PERF_ANIM_CREATED] : 1;
+    double frames = t[PERF_ANIM_FRAMES] ? t[PERF_ANIM_FRAMES] : 1;
+    printf("  animation engine (cap %d fps): frames per transition %.2f, dropped %.2f, ms per frame %.2f\n",
+           ANIMATION_FPS_CAP, t[PERF_ANIM_FRAMES] / transitions, t[PERF_ANIM_DROPPED] / transitions,
+           t[PERF_ANIM_FRAME_MS] / frames);
+    printf("  glyph loads:");
+    for (int i = 0; i < LAYER_TYPE_COUNT; i++) {
+        printf(" %s %lu%s", TYPE_NAMES[i], (unsigned long)t[PERF_LOADS + i], i + 1 < LAYER_TYPE_COUNT ? "," : "\n");
+    }
+}
+#endif
+
+// ==================== 進入點 ====================
+
+typedef struct {
+    const char *name;
+    void (*run)(void);
+} Scenario;
+
+static const Scenario SCENARIOS[] = {
+    {"year", scenario_year},
+    {"render", scenario_render},
+    {"power", scenario_power},
+    {"settings", scenario_settings},
+    {"launch", scenario_launch},
+    {"boundary", scenario_boundary},
+    {"theme", scenario_theme},
+    {"seconds", scenario_seconds},
+#if defined(PERF_COUNTERS)
+    {"perf", scenario_perf},
+#endif
+};
+
+int main(int argc, char **argv) {
+    setenv("TZ", "UTC", 1);
+    tzset();
+
+    const char *only = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--days") == 0 && i + 1 < argc) {
+            s_replay_days = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--render-days") == 0 && i + 1 < argc) {
+            s_render_days = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--power-days") == 0 && i + 1 < argc) {
+            s_power_days = atoi(argv[++i]);
+        } else {
+            only = argv[i];
+        }
+    }
+
+    int ran = 0;
+    for (size_t i = 0; i < ARRAY_LENGTH(SCENARIOS); i++) {
+        if (!only || strcmp(only, SCENARIOS[i].name) == 0) {
+            SCENARIOS[i].run();
+            ran++;
+        }
+    }
+    if (!ran) {
+        fprintf(stderr, "unknown scenario: %s\n", only);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,45 @@
+// 產生 lunar_test 的參考資料 lunar_reference.h
+//
+// 以 ICU 的中國曆（Intl.DateTimeFormat 'zh-TW-u-ca-chinese'）逐日換算 1900-01-01 至 2101-02-28，
+// 記下每個農曆月初一的公曆日期（自 1970-01-01 起的天數）、月份與是否為閏月。
+// 與錶盤的壓縮查表無關，只依賴 Node.js 內建的 ICU。
+//
+// 用法：node gen_lunar_reference.js > lunar_reference.h
+'use strict';
+
+const DAY_MS = 86400000;
+const MONTHS = {'正': 1, '二': 2, '三': 3, '四': 4, '五': 5, '六': 6,
+                '七': 7, '八': 8, '九': 9, '十': 10, '冬': 11, '臘': 12};
+
+const format = new Intl.DateTimeFormat('zh-TW-u-ca-chinese',
+    {timeZone: 'UTC', year: 'numeric', month: 'numeric', day: 'numeric'});
+
+const entries = [];
+for (let t = Date.UTC(1900, 0, 1); t < Date.UTC(2101, 2, 1); t += DAY_MS) {
+    const parts = {};
+    for (const part of format.formatToParts(new Date(t))) parts[part.type] = part.value;
+    if (parts.day !== '1') continue;
+
+    let name = parts.month.replace('月', '');
+    const leap = name.startsWith('閏');
+    if (leap) name = name.slice(1);
+    entries.push(`{${t / DAY_MS}, ${MONTHS[name]}, ${leap ? 1 : 0}}`);
+}
+
+const out = [];
+out.push('// 由 tools/host/gen_lunar_reference.js 產生，請勿手動修改');
+out.push('#pragma once');
+out.push('');
+out.push('// 每個農曆月初一：自 1970-01-01 起的天數、月份、是否為閏月');
+out.push('typedef struct {');
+out.push('    int32_t epoch_day;');
+out.push('    uint8_t month;');
+out.push('    uint8_t leap;');
+out.push('} LunarMonthStart;');
+out.push('');
+out.push(`static const LunarMonthStart LUNAR_REFERENCE[${entries.length}] = {`);
+for (let i = 0; i < entries.length; i += 6) {
+    out.push('    ' + entries.slice(i, i + 6).join(', ') + ',');
+}
+out.push('};');
+process.stdout.write(out.join('\n') + '\n');
@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+"""
+主機端資源產生器。
+
+依 package.json 的 media 清單為指定平台挑選資源，模擬 Pebble SDK 的資源編號規則，
+並將 PNG 轉換為 SDK 預設（Smallest）會選用的記憶體格式，輸出：
+  resource_ids.auto.h ─ RESOURCE_ID_* 定義（與 SDK 產生的同名標頭對應）
+  resources.auto.c    ─ 已解碼的點陣圖資料、調色盤與原始檔大小
+  glyph_squares.auto.h ─ 裁切前的方形字形（RLE，格式同字形串流），供 trim_test 逐像素比對墨跡裁切
+package.json 同時列出圖集、逐張字形與字形串流資源，各種建置共用同一份輸出。
+
+用法：gen_resources.py <repo_root> <platform> <out_dir>
+"""
+
+import json
+import os
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+import build_atlas  # noqa: E402
+import pngio  # noqa: E402
+
+# 對應 pebble.h 內 GBitmapFormat 列舉
+FORMAT_1BIT = 0
+FORMAT_8BIT = 1
+FORMAT_1BIT_PALETTE = 2
+FORMAT_2BIT_PALETTE = 3
+FORMAT_4BIT_PALETTE = 4
+
+FORMAT_NAMES = {
+    FORMAT_1BIT: 'GBitmapFormat1Bit',
+    FORMAT_8BIT: 'GBitmapFormat8Bit',
+    FORMAT_1BIT_PALETTE: 'GBitmapFormat1BitPalette',
+    FORMAT_2BIT_PALETTE: 'GBitmapFormat2BitPalette',
+    FORMAT_4BIT_PALETTE: 'GBitmapFormat4BitPalette',
+}
+
+MEMORY_FORMATS = {
+    '1Bit': FORMAT_1BIT,
+    '8Bit': FORMAT_8BIT,
+    '1BitPalette': FORMAT_1BIT_PALETTE,
+    '2BitPalette': FORMAT_2BIT_PALETTE,
+    '4BitPalette': FORMAT_4BIT_PALETTE,
+}
+
+
+def to_gcolor8(rgba):
+    r, g, b, a = rgba
+    if a < 64:
+        return 0x00
+    return ((a >> 6) << 6) | ((r >> 6) << 4) | ((g >> 6) << 2) | (b >> 6)
+
+
+def select_media(package, platform):
+    selected = []
+    for media in package['pebble']['resources']['media']:
+        targets = media.get('targetPlatforms')
+        if targets is None or platform in targets:
+            selected.append(media)
+    return selected
+
+
+def assign_ids(package):
+    # SDK 依 media 清單中名稱首次出現的順序編號，從 1 開始
+    ids = {}
+    for media in package['pebble']['resources']['media']:
+        if media['name'] not in ids:
+            ids[media['name']] = len(ids) + 1
+    return ids
+
+
+def convert_bitmap(path, memory_format):
+    width, height, rows = pngio.read_png(path)
+    pixels = [[to_gcolor8(px) for px in row] for row in rows]
+
+    palette = []
+    for row in pixels:
+        for color in row:
+            if color not in palette:
+                palette.append(color)
+
+    if memory_format in (None, 'Smallest', 'SmallestPalette'):
+        count = len(palette)
+        fmt = (FORMAT_1BIT_PALETTE if count <= 2 else
+               FORMAT_2BIT_PALETTE if count <= 4 else
+               FORMAT_4BIT_PALETTE if count <= 16 else FORMAT_8BIT)
+        if fmt == FORMAT_8BIT and memory_format == 'SmallestPalette':
+            raise ValueError('%s: %d colors do not fit a palette' % (path, count))
+    else:
+        fmt = MEMORY_FORMATS[memory_format]
+
+    if fmt == FORMAT_8BIT:
+        row_bytes = width
+        data = bytearray(c for row in pixels for c in row)
+        return fmt, width, height, row_bytes, data, []
+
+    if fmt == FORMAT_1BIT:
+        row_bytes = (width + 31) // 32 * 4
+        data = bytearray(row_bytes * height)
+        for y, row in enumerate(pixels):
+            for x, color in enumerate(row):
+                if color == 0xFF:
+                    data[y * row_bytes + x // 8] |= 1 << (x % 8)
+        return fmt, width, height, row_bytes, data, []
+
+    bpp = {FORMAT_1BIT_PALETTE: 1, FORMAT_2BIT_PALETTE: 2, FORMAT_4BIT_PALETTE: 4}[fmt]
+    if len(palette) > (1 << bpp):
+        raise ValueError('%s: %d colors do not fit %s' % (path, len(palette), FORMAT_NAMES[fmt]))
+    palette += [0x00] * ((1 << bpp) - len(palette))
+    row_bytes = (width * bpp + 7) // 8
+    data = bytearray(row_bytes * height)
+    for y, row in enumerate(pixels):
+        for x, color in enumerate(row):
+            bit = x * bpp
+            data[y * row_bytes + bit // 8] |= palette.index(color) << (8 - bpp - bit % 8)
+    return fmt, width, height, row_bytes, data, palette
+
+
+def c_bytes(data):
+    items = ['0x%02x' % b for b in data]
+    return ',\n'.join('    ' + ', '.join(items[i:i + 16]) for i in range(0, len(items), 16))
+
+
+def write_glyph_squares(repo_root, platform, out_dir):
+    """每張字形量化後、裁切前的完整方形（底稿尺寸，Emery 的日期字形為 11x11），像素值為語意色插槽。"""
+    resources = os.path.join(repo_root, 'resources')
+    slots = build_atlas.platform_slots(platform)
+    data = bytearray()
+    index = []
+    for name, directory, stem in build_atlas.ALL_GLYPHS:
+        width, height, rows = build_atlas.load_glyph(resources, directory, stem, platform)
+        stream = build_atlas.rle_stream(name, width, height, rows, slots)
+        index.append('    [GLYPH_%s] = {%d, %d, %d, %d},' % (name, len(data), len(stream), width, height))
+        data += stream
+
+    with open(os.path.join(out_dir, 'glyph_squares.auto.h'), 'w') as f:
+        f.write('// 由 tools/host/gen_resources.py 產生，請勿手動修改\n#pragma once\n\n')
+        f.write('#define HOST_GLYPH_SQUARE_SLOT_SHIFT %d\n' % build_atlas.RLE_SLOT_SHIFT)
+        f.write('#define HOST_GLYPH_SQUARE_LENGTH_MASK 0x%02X\n\n' % (build_atlas.RLE_MAX_RUN - 1))
+        f.write('static const uint8_t HOST_GLYPH_SQUARE_DATA[] = {\n%s\n};\n\n' % c_bytes(data))
+        f.write('static const struct {\n    uint32_t offset;\n    uint16_t size;\n    uint8_t width;\n'
+                '    uint8_t height;\n} HOST_GLYPH_SQUARES[GLYPH_COUNT] = {\n%s\n};\n' % '\n'.join(index))
+
+
+def main():
+    repo_root, platform, out_dir = sys.argv[1:4]
+    with open(os.path.join(repo_root, 'package.json'), encoding='utf-8') as f:
+        package = json.load(f)
+
+    ids = assign_ids(package)
+    media = select_media(package, platform)
+    os.makedirs(out_dir, exist_ok=True)
+
+    with open(os.path.join(out_dir, 'resource_ids.auto.h'), 'w') as f:
+        f.write('// 由 tools/host/gen_resources.py 產生，請勿手動修改\n#pragma once\n\n')
+        for name, rid in sorted(ids.items(), key=lambda kv: kv[1]):
+            if any(m['name'] == name for m in media):
+                f.write('#define RESOURCE_ID_%s %d\n' % (name, rid))
+        f.write('\n#define HOST_RESOURCE_SLOTS %d\n' % (len(ids) + 1))
+
+    body = []
+    entries = []
+    for m in media:
+        rid = ids[m['name']]
+        path = os.path.join(repo_root, 'resources', m['file'])
+        file_size = os.path.getsize(path)
+        if m['type'] == 'bitmap':
+            fmt, w, h, row_bytes, data, palette = convert_bitmap(path, m.get('memoryFormat'))
+            body.append('static const uint8_t res_%d_data[] = {\n%s\n};\n' % (rid, c_bytes(data)))
+            palette_ref = 'NULL'
+            if palette:
+                body.append('static const uint8_t res_%d_palette[] = { %s };\n'
+                            % (rid, ', '.join('0x%02x' % c for c in palette)))
+                palette_ref = 'res_%d_palette' % rid
+            entries.append('    [%d] = { "%s", HOST_RESOURCE_BITMAP, %s, %d, %d, %d, res_%d_data, %d, %s, %d, %d },'
+                           % (rid, m['name'], FORMAT_NAMES[fmt], w, h, row_bytes, rid, len(data),
+                              palette_ref, len(palette), file_size))
+        else:
+            with open(path, 'rb') as rf:
+                data = rf.read()
+            body.append('static const uint8_t res_%d_data[] = {\n%s\n};\n' % (rid, c_bytes(data)))
+            entries.append('    [%d] = { "%s", HOST_RESOURCE_RAW, 0, 0, 0, 0, res_%d_data, %d, NULL, 0, %d },'
+                           % (rid, m['name'], rid, len(data), file_size))
+
+    with open(os.path.join(out_dir, 'resources.auto.c'), 'w') as f:
+        f.write('// 由 tools/host/gen_resources.py 產生，請勿手動修改\n')
+        f.write('#include "host.h"\n\n')
+        f.write('\n'.join(body))
+        f.write('\nconst HostResource host_resources[HOST_RESOURCE_SLOTS] = {\n')
+        f.write('\n'.join(entries))
+        f.write('\n};\n')
+
+    write_glyph_squares(repo_root, platform, out_dir)
+
+
+if __name__ == '__main__':
+    main()
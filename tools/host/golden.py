@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""
+golden_test 的黃金影像轉換。
+
+黃金影像以 PNG 存於 tools/host/golden/<平台>/<主題>.png（調色盤格式，方便檢視與比較差異）；
+golden_test 讀寫的是像素值為 GColor8 argb 的 PGM（P5），兩者以此腳本互轉：
+  unpack <png> <pgm>      make test 前轉出供 golden_test 比對
+  pack <pgm 目錄> <png 目錄>  make golden 時將 golden_test --update 寫出的 PGM 轉為 PNG
+
+用法：golden.py unpack <png> <pgm> | golden.py pack <pgm_dir> <png_dir>
+"""
+
+import os
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+import pngio  # noqa: E402
+from gen_resources import to_gcolor8  # noqa: E402
+
+
+def to_rgba(color):
+    return (((color >> 4) & 3) * 85, ((color >> 2) & 3) * 85, (color & 3) * 85, (color >> 6) * 85)
+
+
+def read_pgm(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    fields = data.split(maxsplit=4)
+    if fields[0] != b'P5' or fields[3] != b'255':
+        raise ValueError('%s: not an 8-bit binary PGM' % path)
+    width, height = int(fields[1]), int(fields[2])
+    pixels = data[len(data) - width * height:]
+    return width, height, [pixels[y * width:(y + 1) * width] for y in range(height)]
+
+
+def unpack(png_path, pgm_path):
+    width, height, rows = pngio.read_png(png_path)
+    os.makedirs(os.path.dirname(pgm_path) or '.', exist_ok=True)
+    with open(pgm_path, 'wb') as f:
+        f.write(b'P5\n%d %d\n255\n' % (width, height))
+        f.write(bytes(to_gcolor8(px) for row in rows for px in row))
+
+
+def pack(pgm_dir, png_dir):
+    os.makedirs(png_dir, exist_ok=True)
+    for name in sorted(os.listdir(pgm_dir)):
+        stem, ext = os.path.splitext(name)
+        if ext != '.pgm':
+            continue
+        width, height, rows = read_pgm(os.path.join(pgm_dir, name))
+        # 調色盤依色值排序，同樣的畫面總是寫出同樣的檔案
+        colors = sorted(set(c for row in rows for c in row))
+        index = {c: i for i, c in enumerate(colors)}
+        indices = [[index[c] for c in row] for row in rows]
+        pngio.write_png_indexed(os.path.join(png_dir, stem + '.png'), width, height, indices,
+                                [to_rgba(c) for c in colors])
+
+
+def main():
+    if len(sys.argv) == 4 and sys.argv[1] == 'unpack':
+        unpack(sys.argv[2], sys.argv[3])
+    elif len(sys.argv) == 4 and sys.argv[1] == 'pack':
+        pack(sys.argv[2], sys.argv[3])
+    else:
+        sys.exit(__doc__.strip().splitlines()[-1])
+
+
+if __name__ == '__main__':
+    main()
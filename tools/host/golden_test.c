@@ -0,0 +1,362 @@
+// 錶盤畫面的黃金影像比對
+//
+// 以主機端軟體繪製（BitmapLayer、GCompOpSet 與調色盤點陣圖，見 host_pebble.c）畫出整個視窗，
+// 於每組主題配色下依序走過：
+//   24 小時制一天中的每一分鐘（播放換圖動畫，比對動畫結束後的畫面）；
+//   12 小時制一天中的每一分鐘、2026 年每一天的公曆日期、
+//   乙巳年（2025-01-29 至 2026-02-16，含閏六月）每一天的農曆日期（關閉動畫，走靜態更新）。
+// 每個畫面都與 golden/<平台>/<主題>.png 逐像素比對。黃金影像只收錄依上列順序「某格子首次顯示某字形」的畫面，
+// 這些畫面整張比對；其餘畫面的每個格子與曾顯示同一字形的黃金畫面的同一範圍比對，格子以外的像素與第一張比對。
+// 各格子應顯示的字形由數字查表（time_glyphs_at / date_glyphs_at）決定，不讀取格子目前的狀態，
+// 因此換錯字、漏換字或點整 / 點半等讀法的版面錯誤也會被抓出。
+// 以 -DUSE_GRAPHICS_BLIT、-DUSE_BITMAP_LAYERS、-DUSE_RLE_GLYPHS 編譯時，以同一組黃金影像檢查其他繪製方式。
+//
+// 黃金影像以 make golden 重新產生（golden_test --update 寫出 PGM，golden.py pack 轉為 PNG）；
+// make test 前由 golden.py unpack 將 PNG 轉為 PGM，像素值為 GColor8。
+//
+// 用法：golden_test <PGM 目錄>              比對，全部通過時回傳 0
+//       golden_test --update <輸出目錄>     以目前的畫面寫出黃金影像
+#define main ccwatchface_main
+#include "../../src/c/ccwatchface.c"
+#undef main
+
+#include "host.h"
+
+// 黃金影像每列的畫面數
+#define GOLDEN_COLUMNS 8
+#define GOLDEN_MAX_FACES 96
+// 最大的畫面（Emery）
+#define GOLDEN_MAX_PIXELS (200 * 228)
+
+// 2026-01-01 00:00 UTC（星期四）
+#define DAY_EPOCH 1767225600
+// 2026-01-01 09:41 UTC
+#define DATES_EPOCH 1767260460
+// 2025-01-29 09:41 UTC：乙巳年正月初一
+#define LUNAR_EPOCH 1738143660
+
+// ==================== 主題與情境 ====================
+
+// 彩色平台送出四個顏色，黑白平台送出深色與小時挖空兩個開關（另一組鍵值錶盤不讀取）
+typedef struct {
+    const char *name;
+    int32_t background;
+    int32_t text;
+    int32_t hour_accent;
+    int32_t minute_accent;
+    bool is_dark;
+    bool bw_hour_accent;
+} GoldenTheme;
+
+static const GoldenTheme THEMES[] = {
+#if defined(PBL_COLOR)
+    {"default", 0x000000, 0xFFFFFF, 0xFFAA00, 0xFFAA00},
+    {"light", 0xFFFFFF, 0x000000, 0xFF0000, 0x0000FF},
+    {"hollow", 0x000055, 0xFFFFFF, 0x000055, 0x55FFFF},     // 小時強調色同背景色
+    {"warm", 0x550000, 0xFFFFAA, 0xFF5500, 0x00AA55},
+#else
+    {"dark-hollow", .is_dark = true, .bw_hour_accent = true},    // 預設
+    {"dark", .is_dark = true, .bw_hour_accent = false},
+    {"light-hollow", .is_dark = false, .bw_hour_accent = true},
+    {"light", .is_dark = false, .bw_hour_accent = false},
+#endif
+};
+
+typedef struct {
+    const char *name;
+    bool is_24h;
+    bool lunar;
+    bool animated;
+    time_t start;
+    int steps;
+    int step_s;
+} GoldenPass;
+
+static const GoldenPass PASSES[] = {
+    {"24h", true, false, true, DAY_EPOCH, 24 * 60, SECONDS_PER_MINUTE},
+    {"12h", false, false, false, DAY_EPOCH, 24 * 60, SECONDS_PER_MINUTE},
+    {"dates", true, false, false, DATES_EPOCH, 365, 24 * 60 * 60},
+    {"lunar", true, true, false, LUNAR_EPOCH, 384, 24 * 60 * 60},
+};
+
+static void launch(const GoldenTheme *theme, const GoldenPass *pass) {
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(pass->is_24h);
+    host_set_time(pass->start);
+    host_set_rendering(true);
+    app_init();
+
+    const uint32_t keys[] = {
+        KEY_BACKGROUND_COLOR, KEY_TEXT_COLOR, KEY_HOUR_COLOR, KEY_MINUTE_COLOR,
+        KEY_THEME_IS_DARK, KEY_BW_HOUR_ACCENT, KEY_LUNAR_DATE, KEY_ANIMATION_ENABLED,
+    };
+    const int32_t values[] = {
+        theme->background, theme->text, theme->hour_accent, theme->minute_accent,
+        theme->is_dark, theme->bw_hour_accent, pass->lunar, pass->animated,
+    };
+    host_deliver_message(keys, values, ARRAY_LENGTH(keys));
+    host_run_until_idle();
+}
+
+static void quit(void) {
+    app_deinit();
+    host_set_rendering(false);
+}
+
+static TimeUnits units_between(const struct tm *prev, const struct tm *now) {
+    TimeUnits units = MINUTE_UNIT;
+    if (prev->tm_hour != now->tm_hour) units |= HOUR_UNIT;
+    if (prev->tm_mday != now->tm_mday) units |= DAY_UNIT;
+    if (prev->tm_mon != now->tm_mon) units |= MONTH_UNIT;
+    if (prev->tm_year != now->tm_year) units |= YEAR_UNIT;
+    return units;
+}
+
+// 將模擬時鐘推進到 target，觸發對應的 tick 並跑完換圖動畫
+static void advance_to(time_t target) {
+    time_t prev_time = host_get_time();
+    struct tm prev;
+    struct tm now;
+    localtime_r(&prev_time, &prev);
+    localtime_r(&target, &now);
+
+    host_advance_ms((uint32_t)(target - prev_time) * 1000);
+    host_tick(units_between(&prev, &now));
+    host_run_until_idle();
+}
+
+// 依數字查表得出目前每個格子應顯示的字形，以 ALL_DISPLAY_LAYERS 的順序填入
+static void expected_glyphs(GlyphId glyphs[DISPLAY_LAYER_COUNT]) {
+    time_t now = host_get_time();
+    struct tm t;
+    localtime_r(&now, &t);
+
+    GlyphId time_glyphs[ARRAY_LENGTH(TIME_CELLS)];
+    GlyphId date_glyphs[ARRAY_LENGTH(DATE_CELLS)];
+    time_glyphs_at(&t, time_glyphs);
+    bool show_lunar = date_glyphs_at(&t, date_glyphs);
+    for (size_t i = 0; i < ARRAY_LENGTH(TIME_CELLS); i++) glyphs[TIME_CELLS[i]->cell] = time_glyphs[i];
+    for (size_t i = 0; i < ARRAY_LENGTH(DATE_CELLS); i++) glyphs[DATE_CELLS[i]->cell] = date_glyphs[i];
+    glyphs[s_app.yue_layer.cell] = GLYPH_YUE;
+    glyphs[s_app.ri_layer.cell] = show_lunar ? GLYPH_NONE : GLYPH_RI;
+    glyphs[s_app.zhou_layer.cell] = GLYPH_ZHOU;
+}
+
+// ==================== 黃金影像 ====================
+//
+// 一張主題的黃金影像為 GOLDEN_COLUMNS 欄的畫面拼貼，依挑出的順序由左而右、由上而下排列
+
+static GColor8 s_golden[GOLDEN_MAX_FACES * GOLDEN_MAX_PIXELS];
+static int s_golden_w;
+static int s_golden_h;
+static int s_face_count;
+// 黃金影像可容納的畫面數（含最後一列的空位）
+static int s_face_capacity;
+// 某格子顯示某字形的第一張黃金畫面；-1 為尚未出現
+static int8_t s_face_of[DISPLAY_LAYER_COUNT][GLYPH_COUNT];
+// 每個像素所屬的格子；-1 為格子以外
+static int8_t s_owner[GOLDEN_MAX_PIXELS];
+
+static void sheet_size(int faces, int *w, int *h) {
+    GSize screen = host_screen_size();
+    *w = GOLDEN_COLUMNS * screen.w;
+    *h = (faces + GOLDEN_COLUMNS - 1) / GOLDEN_COLUMNS * screen.h;
+}
+
+static GColor8 *face_pixel(int face, int x, int y) {
+    GSize screen = host_screen_size();
+    int sx = face % GOLDEN_COLUMNS * screen.w + x;
+    int sy = face / GOLDEN_COLUMNS * screen.h + y;
+    return &s_golden[sy * s_golden_w + sx];
+}
+
+static void sheet_path(char *path, size_t size, const char *dir, const GoldenTheme *theme) {
+    snprintf(path, size, "%s/%s.pgm", dir, theme->name);
+}
+
+// PGM（P5）：每個像素一個位元組，即 GColor8 的 argb
+static bool sheet_read(const char *dir, const GoldenTheme *theme) {
+    char path[256];
+    sheet_path(path, sizeof(path), dir, theme);
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    int w = 0, h = 0, max = 0;
+    GSize screen = host_screen_size();
+    bool ok = fscanf(f, "P5 %d %d %d", &w, &h, &max) == 3 && fgetc(f) != EOF && max == 255 &&
+              w == GOLDEN_COLUMNS * screen.w && h % screen.h == 0 &&
+              (size_t)w * h <= sizeof(s_golden) &&
+              fread(s_golden, 1, (size_t)w * h, f) == (size_t)w * h;
+    fclose(f);
+    s_golden_w = w;
+    s_golden_h = h;
+    s_face_capacity = ok ? h / screen.h * GOLDEN_COLUMNS : 0;
+    return ok;
+}
+
+static bool sheet_write(const char *dir, const GoldenTheme *theme) {
+    char path[256];
+    sheet_path(path, sizeof(path), dir, theme);
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    int w, h;
+    sheet_size(s_face_count, &w, &h);
+    fprintf(f, "P5\n%d %d\n255\n", w, h);
+    bool ok = fwrite(s_golden, 1, (size_t)w * h, f) == (size_t)w * h;
+    return fclose(f) == 0 && ok;
+}
+
+static void owners_init(void) {
+    GSize screen = host_screen_size();
+    GRect bounds = GRect(0, 0, screen.w, screen.h);
+    memset(s_owner, -1, sizeof(s_owner));
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        GRect cell = ALL_DISPLAY_LAYERS[i]->base_frame;
+        grect_clip(&cell, &bounds);
+        for (int y = cell.origin.y; y < cell.origin.y + cell.size.h; y++) {
+            memset(&s_owner[y * screen.w + cell.origin.x], (int)i, cell.size.w);
+        }
+    }
+}
+
+// ==================== 比對 ====================
+
+typedef struct {
+    bool update;
+    int screens;
+    int failed_screens;
+    char first_failure[96];
+} GoldenRun;
+
+// 目前畫面與黃金影像是否相同；不同時 *cell_out 為第一處不同所屬的格子（-1 為格子以外）。
+// new_face 為整張比對的黃金畫面，-1 時逐格比對；各列依格子邊界切段，每段與對應的黃金畫面整段比較
+static bool screen_matches(const GlyphId glyphs[DISPLAY_LAYER_COUNT], int new_face, int *cell_out) {
+    GSize screen = host_screen_size();
+    const GColor8 *pixels = host_framebuffer();
+    for (int y = 0; y < screen.h; y++) {
+        const int8_t *owners = &s_owner[y * screen.w];
+        for (int x = 0, end; x < screen.w; x = end) {
+            int owner = owners[x];
+            for (end = x + 1; end < screen.w && owners[end] == owner; end++) {}
+            int face = new_face >= 0 ? new_face : owner >= 0 ? s_face_of[owner][glyphs[owner]] : 0;
+            if (face < 0 || face >= s_face_capacity ||
+                memcmp(&pixels[y * screen.w + x], face_pixel(face, x, y), end - x) != 0) {
+                *cell_out = owner;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void verify_screen(GoldenRun *run) {
+    GSize screen = host_screen_size();
+    GlyphId glyphs[DISPLAY_LAYER_COUNT];
+    expected_glyphs(glyphs);
+
+    // 有格子首次顯示某字形時收錄為新的黃金畫面
+    int new_face = -1;
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        if (s_face_of[i][glyphs[i]] >= 0) continue;
+        if (new_face < 0) {
+            if (s_face_count == GOLDEN_MAX_FACES) break;
+            new_face = s_face_count++;
+        }
+        s_face_of[i][glyphs[i]] = (int8_t)new_face;
+    }
+    if (run->update && new_face >= 0) {
+        sheet_size(s_face_count, &s_golden_w, &s_golden_h);
+        s_face_capacity = s_face_count;
+        const GColor8 *pixels = host_framebuffer();
+        for (int y = 0; y < screen.h; y++) {
+            memcpy(face_pixel(new_face, 0, y), &pixels[y * screen.w], screen.w);
+        }
+    }
+
+    run->screens++;
+    int cell = -1;
+    if (screen_matches(glyphs, new_face, &cell)) return;
+    if (run->failed_screens++) return;
+
+    time_t now = host_get_time();
+    char when[32];
+    strftime(when, sizeof(when), "%Y-%m-%d %H:%M", gmtime(&now));
+    if (new_face >= 0) {
+        snprintf(run->first_failure, sizeof(run->first_failure), "%s: differs from face %d", when, new_face);
+    } else if (cell >= 0) {
+        snprintf(run->first_failure, sizeof(run->first_failure), "%s: cell %d (glyph %d) differs from face %d",
+                 when, cell, (int)glyphs[cell], s_face_of[cell][glyphs[cell]]);
+    } else {
+        snprintf(run->first_failure, sizeof(run->first_failure), "%s: background differs from face 0", when);
+    }
+}
+
+static uint64_t s_render_ns;
+static uint64_t s_frames;
+
+static int run_theme(const GoldenTheme *theme, const char *dir, bool update) {
+    if (update) {
+        memset(s_golden, 0, sizeof(s_golden));
+        s_golden_w = s_golden_h = 0;
+        s_face_capacity = 0;
+    } else if (!sheet_read(dir, theme)) {
+        host_check(false, theme->name, "golden sheet missing or malformed (make golden)");
+        return 0;
+    }
+    memset(s_face_of, -1, sizeof(s_face_of));
+    s_face_count = 0;
+
+    int screens = 0;
+    for (size_t p = 0; p < ARRAY_LENGTH(PASSES); p++) {
+        const GoldenPass *pass = &PASSES[p];
+        GoldenRun run = {.update = update};
+        launch(theme, pass);
+        owners_init();
+        for (int i = 0; i < pass->steps; i++) {
+            if (i) advance_to(pass->start + (time_t)i * pass->step_s);
+            verify_screen(&run);
+        }
+        s_render_ns += host_counters.render_ns;
+        s_frames += host_counters.frames_rendered;
+        quit();
+        screens += run.screens;
+
+        char label[48];
+        snprintf(label, sizeof(label), "%s %s", theme->name, pass->name);
+        char what[160];
+        snprintf(what, sizeof(what), "%d of %d screens differ, first %s", run.failed_screens, run.screens,
+                 run.first_failure);
+        host_check(!run.failed_screens, label, what);
+    }
+
+    int w, h;
+    sheet_size(s_face_count, &w, &h);
+    if (update) {
+        host_check(s_face_count < GOLDEN_MAX_FACES && sheet_write(dir, theme), theme->name,
+                   "too many faces or cannot write the sheet");
+    } else {
+        host_check(w == s_golden_w && h == s_golden_h, theme->name, "sheet size differs (make golden)");
+    }
+    return screens;
+}
+
+int main(int argc, char *argv[]) {
+    setenv("TZ", "UTC", 1);
+    tzset();
+
+    bool update = argc == 3 && strcmp(argv[1], "--update") == 0;
+    if (argc != 2 && !update) {
+        fprintf(stderr, "usage: golden_test <pgm dir> | golden_test --update <out dir>\n");
+        return 2;
+    }
+    const char *dir = argv[argc - 1];
+
+    int screens = 0;
+    for (size_t i = 0; i < ARRAY_LENGTH(THEMES); i++) {
+        screens += run_theme(&THEMES[i], dir, update);
+    }
+    printf("golden: %d checks, %d failures (%d themes x %d screens, %d faces, %.1f us per frame)\n",
+           host_checks, host_failures, (int)ARRAY_LENGTH(THEMES), screens / (int)ARRAY_LENGTH(THEMES), s_face_count,
+           s_frames ? (double)s_render_ns / (double)s_frames / 1000.0 : 0.0);
+    return host_failures ? 1 : 0;
+}
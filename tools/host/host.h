@@ -0,0 +1,136 @@
+// 主機端模擬環境的控制介面
+//
+// 基準測試程式透過此標頭推進模擬時鐘、驅動動畫、注入 AppMessage，
+// 並讀取 HostCounters 統計值。錶盤原始碼本身不應引用此標頭。
+#pragma once
+
+#include "pebble.h"
+
+// ==================== 資源表 ====================
+
+typedef enum {
+    HOST_RESOURCE_EMPTY = 0,
+    HOST_RESOURCE_BITMAP,
+    HOST_RESOURCE_RAW,
+} HostResourceKind;
+
+typedef struct {
+    const char *name;
+    HostResourceKind kind;
+    GBitmapFormat format;
+    int16_t width;
+    int16_t height;
+    uint16_t row_bytes;
+    const uint8_t *data;
+    uint32_t data_size;
+    const uint8_t *palette;
+    uint8_t palette_size;
+    uint32_t file_size;
+} HostResource;
+
+extern const HostResource host_resources[HOST_RESOURCE_SLOTS];
+
+// ==================== 統計計數器 ====================
+
+typedef struct {
+    uint64_t resource_bitmap_loads;     // gbitmap_create_with_resource 呼叫次數
+    uint64_t resource_raw_loads;        // resource_load / resource_load_byte_range 呼叫次數
+    uint64_t resource_bytes_read;       // 自資源區讀取的位元組數
+    uint64_t heap_allocs;
+    uint64_t heap_frees;
+    uint64_t heap_bytes_allocated;
+    uint64_t heap_bytes_freed;
+    uint64_t animations_scheduled;
+    uint64_t animation_frames;          // 動畫更新回呼次數
+    uint64_t layers_marked_dirty;       // 明確或隱含（frame/bitmap 變更）的重繪標記
+    uint64_t persist_reads;
+    uint64_t persist_writes;
+    uint64_t timers_registered;
+    uint64_t app_messages_sent;         // app_message_outbox_send 呼叫次數
+    uint64_t frames_rendered;           // 實際執行的重繪次數（僅於開啟軟體繪製時計數）
+    uint64_t pixels_drawn;              // 填色與點陣圖繪製寫入的像素數
+    uint64_t layers_drawn;              // 重繪時執行的圖層 update_proc 次數
+    uint64_t render_ns;                 // 重繪耗費的主機時間（不含 emulation_ns）
+    uint64_t emulation_ns;              // 模擬環境才有的成本（黑白平台畫面擷取時的打包與寫回）
+} HostCounters;
+
+extern HostCounters host_counters;
+
+// 各平台應用程式可用的堆積上限（位元組），用於 heap_bytes_free 與峰值比較
+size_t host_heap_capacity(void);
+size_t host_heap_peak(void);
+void host_heap_reset_peak(void);
+
+// ==================== 模擬控制 ====================
+
+void host_set_24h_style(bool is_24h);
+void host_set_time(time_t now);
+time_t host_get_time(void);
+
+// 以模擬時鐘呼叫已訂閱的 TickHandler；與韌體相同，較大的單位改變時秒數必然也改變，units_changed 一律含 SECOND_UNIT
+void host_tick(TimeUnits units_changed);
+
+// 以固定影格間隔推進動畫與計時器，直到沒有任何排程中的動畫或計時器為止；回傳推進的毫秒數
+uint32_t host_run_until_idle(void);
+
+// 推進指定毫秒數（動畫與 app_timer 同步推進）
+void host_advance_ms(uint32_t ms);
+
+// 對已釋放動畫呼叫 API 的次數（應恆為 0）
+uint32_t host_invalid_animation_calls(void);
+
+// 模擬的單一影格長度（Pebble 動畫約 30 fps）
+#define HOST_FRAME_MS 33
+
+// 模擬電量變化、通知等視窗覆蓋錶盤（失去焦點）與勿擾模式；電量與焦點改變時呼叫已訂閱的處理函式
+void host_set_battery(uint8_t charge_percent, bool is_charging);
+void host_set_focus(bool in_focus);
+void host_set_quiet_time(bool active);
+
+// 與韌體相同，以 HOST_UNOBSTRUCTED_ANIMATION_MS 的系統動畫將未遮蔽區域的高度（自畫面頂端起算）改為 height：
+// 開始時呼叫 will_change，之後每影格呼叫 change，結束時呼叫 did_change；由 host_advance_ms 推進。
+// Aplite 沒有此功能，呼叫不會有任何作用
+#define HOST_UNOBSTRUCTED_ANIMATION_MS 250
+void host_set_unobstructed_height(int16_t height);
+
+// 模擬加速度計：host_set_accel 設定 accel_service_peek 回傳的取樣（mG，錶面朝上平放為 0, 0, -1000），
+// host_accel_tap 呼叫已訂閱的輕敲處理函式；host_accel_sampling_hz 回傳資料服務的取樣率，未訂閱時為 0
+void host_set_accel(int16_t x, int16_t y, int16_t z);
+void host_accel_tap(void);
+int host_accel_sampling_hz(void);
+
+// 建立一則包含 count 個 int32 鍵值的 AppMessage 並交給已註冊的 inbox 處理函式
+void host_deliver_message(const uint32_t *keys, const int32_t *values, int count);
+
+// 最近一次 app_message_outbox_send 送出的訊息（尚未送出過時為空）
+const DictionaryIterator *host_last_message_sent(void);
+
+// 開啟後，每當有圖層標記為需重繪，即於事件處理結束時以軟體繪製整個視窗至模擬畫面。
+// 與韌體相同，畫面內容在兩次重繪之間保留，視窗背景為透明時不會先清除
+void host_set_rendering(bool enabled);
+
+// 模擬較慢的繪製：每次重繪使 time_ms 多經過 ms 毫秒（動畫與計時器的排程不受影響），預設為 0
+void host_set_render_cost_ms(uint32_t ms);
+
+// 若有待處理的重繪則立即執行（模擬時鐘推進、tick 與 AppMessage 之後會自動呼叫）
+void host_render_pending(void);
+
+// 模擬畫面（HOST_SCREEN_W x HOST_SCREEN_H，GColor8，逐列排列）
+const GColor8 *host_framebuffer(void);
+GSize host_screen_size(void);
+
+// 清空持久化儲存，模擬全新安裝
+void host_persist_clear(void);
+
+// 重設計數器、計時器、動畫、模擬時鐘與電量 / 焦點 / 勿擾模式 / 加速度計 / 繪製耗時（不影響持久化儲存）
+void host_reset(void);
+
+// ==================== 測試檢查 ====================
+//
+// 主機端測試共用：每次 host_check 計入 host_checks，ok 為 false 時另計入 host_failures 並輸出 label 與說明。
+// 各測試於結束時印出兩者，並以 host_failures 決定回傳值。
+
+extern int host_checks;
+extern int host_failures;
+
+void host_check(bool ok, const char *label, const char *what);
@@ -0,0 +1,1648 @@
+// 主機端 Pebble SDK 模擬實作
+//
+// 以最小代價重現錶盤依賴的 SDK 行為：圖層樹、點陣圖、動畫排程（SDK 3 語意：
+// 結束或取消後自動釋放）、app_timer、持久化儲存、AppMessage，以及可選的軟體繪製。
+// 所有配置都經過受追蹤的堆積，物件大小以接近韌體的估計值計入，便於比較不同設計的堆積用量。
+#include "host.h"
+
+#include <stdarg.h>
+
+#undef malloc
+#undef calloc
+#undef free
+#undef time
+
+HostCounters host_counters;
+
+// ==================== 平台參數 ====================
+
+#if defined(PBL_PLATFORM_EMERY)
+    #define HOST_SCREEN_W 200
+    #define HOST_SCREEN_H 228
+    #define HOST_HEAP_CAPACITY (128 * 1024)
+#elif defined(PBL_PLATFORM_APLITE)
+    #define HOST_SCREEN_W 144
+    #define HOST_SCREEN_H 168
+    #define HOST_HEAP_CAPACITY (24 * 1024)
+#else
+    #define HOST_SCREEN_W 144
+    #define HOST_SCREEN_H 168
+    #define HOST_HEAP_CAPACITY (64 * 1024)
+#endif
+
+// 韌體內部結構大小的估計值（32-bit ARM），用於堆積統計而非主機實際大小
+#define FW_SIZEOF_GBITMAP 20
+#define FW_SIZEOF_LAYER 44
+#define FW_SIZEOF_BITMAP_LAYER 56
+#define FW_SIZEOF_WINDOW 96
+#define FW_SIZEOF_ANIMATION 64
+#define FW_SIZEOF_PROPERTY_ANIMATION 96
+#define FW_SIZEOF_APP_TIMER 24
+
+// ==================== 受追蹤堆積 ====================
+
+typedef struct {
+    size_t accounted;
+    size_t pad;
+} HeapHeader;
+
+static size_t s_heap_used;
+static size_t s_heap_peak;
+
+static void *heap_alloc(size_t actual, size_t accounted) {
+    HeapHeader *header = calloc(1, sizeof(HeapHeader) + actual);
+    if (!header) return NULL;
+    header->accounted = accounted;
+
+    s_heap_used += accounted;
+    if (s_heap_used > s_heap_peak) s_heap_peak = s_heap_used;
+    host_counters.heap_allocs++;
+    host_counters.heap_bytes_allocated += accounted;
+    return header + 1;
+}
+
+static void heap_free(void *ptr) {
+    if (!ptr) return;
+    HeapHeader *header = (HeapHeader *)ptr - 1;
+    s_heap_used -= header->accounted;
+    host_counters.heap_frees++;
+    host_counters.heap_bytes_freed += header->accounted;
+    free(header);
+}
+
+void *host_malloc(size_t size) {
+    return heap_alloc(size, size);
+}
+
+void *host_calloc(size_t count, size_t size) {
+    return heap_alloc(count * size, count * size);
+}
+
+void host_free(void *ptr) {
+    heap_free(ptr);
+}
+
+size_t heap_bytes_used(void) {
+    return s_heap_used;
+}
+
+size_t heap_bytes_free(void) {
+    return s_heap_used >= HOST_HEAP_CAPACITY ? 0 : HOST_HEAP_CAPACITY - s_heap_used;
+}
+
+size_t host_heap_capacity(void) {
+    return HOST_HEAP_CAPACITY;
+}
+
+size_t host_heap_peak(void) {
+    return s_heap_peak;
+}
+
+void host_heap_reset_peak(void) {
+    s_heap_peak = s_heap_used;
+}
+
+// ==================== 日誌 ====================
+
+void app_log(uint8_t log_level, const char *src_filename, int src_line_number, const char *fmt, ...) {
+    static int verbose = -1;
+    if (verbose < 0) verbose = getenv("HOST_VERBOSE") != NULL;
+    if (!verbose && log_level > APP_LOG_LEVEL_ERROR) return;
+
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "[%s:%d] ", src_filename, src_line_number);
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
+
+// ==================== 幾何與色彩 ====================
+
+bool grect_equal(const GRect *rect_a, const GRect *rect_b) {
+    return memcmp(rect_a, rect_b, sizeof(GRect)) == 0;
+}
+
+bool grect_is_empty(const GRect *const rect) {
+    return rect->size.w <= 0 || rect->size.h <= 0;
+}
+
+void grect_clip(GRect *const rect_to_clip, const GRect *const rect_clipper) {
+    int x0 = rect_to_clip->origin.x > rect_clipper->origin.x ? rect_to_clip->origin.x : rect_clipper->origin.x;
+    int y0 = rect_to_clip->origin.y > rect_clipper->origin.y ? rect_to_clip->origin.y : rect_clipper->origin.y;
+    int x1 = rect_to_clip->origin.x + rect_to_clip->size.w;
+    int y1 = rect_to_clip->origin.y + rect_to_clip->size.h;
+    int cx1 = rect_clipper->origin.x + rect_clipper->size.w;
+    int cy1 = rect_clipper->origin.y + rect_clipper->size.h;
+    if (x1 > cx1) x1 = cx1;
+    if (y1 > cy1) y1 = cy1;
+    *rect_to_clip = GRect(x0, y0, x1 > x0 ? x1 - x0 : 0, y1 > y0 ? y1 - y0 : 0);
+}
+
+bool gpoint_equal(const GPoint *point_a, const GPoint *point_b) {
+    return point_a->x == point_b->x && point_a->y == point_b->y;
+}
+
+bool gcolor_equal(GColor8 x, GColor8 y) {
+    return x.argb == y.argb || (x.a == 0 && y.a == 0);
+}
+
+// ==================== 點陣圖 ====================
+
+struct GBitmap {
+    uint8_t *addr;
+    uint16_t row_size_bytes;
+    GBitmapFormat format;
+    GRect bounds;
+    GColor *palette;
+    bool owns_data;
+    bool owns_palette;
+};
+
+static int palette_entries(GBitmapFormat format) {
+    switch (format) {
+        case GBitmapFormat1BitPalette: return 2;
+        case GBitmapFormat2BitPalette: return 4;
+        case GBitmapFormat4BitPalette: return 16;
+        default: return 0;
+    }
+}
+
+static uint16_t row_bytes_for(GBitmapFormat format, int16_t width) {
+    switch (format) {
+        case GBitmapFormat1Bit: return (uint16_t)((width + 31) / 32 * 4);
+        case GBitmapFormat1BitPalette: return (uint16_t)((width + 7) / 8);
+        case GBitmapFormat2BitPalette: return (uint16_t)((width + 3) / 4);
+        case GBitmapFormat4BitPalette: return (uint16_t)((width + 1) / 2);
+        default: return (uint16_t)width;
+    }
+}
+
+GBitmap *gbitmap_create_with_resource(uint32_t resource_id) {
+    host_counters.resource_bitmap_loads++;
+    if (resource_id >= HOST_RESOURCE_SLOTS) return NULL;
+    const HostResource *res = &host_resources[resource_id];
+    if (res->kind != HOST_RESOURCE_BITMAP) return NULL;
+
+    GBitmap *bitmap = heap_alloc(sizeof(GBitmap), FW_SIZEOF_GBITMAP);
+    bitmap->format = res->format;
+    bitmap->row_size_bytes = res->row_bytes;
+    bitmap->bounds = GRect(0, 0, res->width, res->height);
+    bitmap->addr = heap_alloc(res->data_size, res->data_size);
+    memcpy(bitmap->addr, res->data, res->data_size);
+    bitmap->owns_data = true;
+    host_counters.resource_bytes_read += res->file_size;
+
+    if (res->palette_size) {
+        bitmap->palette = heap_alloc(res->palette_size, res->palette_size);
+        memcpy(bitmap->palette, res->palette, res->palette_size);
+        bitmap->owns_palette = true;
+    }
+    return bitmap;
+}
+
+GBitmap *gbitmap_create_as_sub_bitmap(const GBitmap *base_bitmap, GRect sub_rect) {
+    if (!base_bitmap) return NULL;
+    GBitmap *bitmap = heap_alloc(sizeof(GBitmap), FW_SIZEOF_GBITMAP);
+    *bitmap = *base_bitmap;
+    bitmap->owns_data = false;
+    bitmap->owns_palette = false;
+    bitmap->bounds = sub_rect;
+    return bitmap;
+}
+
+GBitmap *gbitmap_create_blank_with_palette(GSize size, GBitmapFormat format, GColor *palette,
+                                           bool free_on_destroy) {
+    GBitmap *bitmap = heap_alloc(sizeof(GBitmap), FW_SIZEOF_GBITMAP);
+    bitmap->format = format;
+    bitmap->row_size_bytes = row_bytes_for(format, size.w);
+    bitmap->bounds = GRect(0, 0, size.w, size.h);
+    size_t data_size = (size_t)bitmap->row_size_bytes * size.h;
+    bitmap->addr = heap_alloc(data_size, data_size);
+    bitmap->owns_data = true;
+    bitmap->palette = palette;
+    bitmap->owns_palette = free_on_destroy;
+    return bitmap;
+}
+
+GBitmap *gbitmap_create_blank(GSize size, GBitmapFormat format) {
+    int entries = palette_entries(format);
+    GColor *palette = entries ? heap_alloc(entries, entries) : NULL;
+    return gbitmap_create_blank_with_palette(size, format, palette, palette != NULL);
+}
+
+void gbitmap_destroy(GBitmap *bitmap) {
+    if (!bitmap) return;
+    if (bitmap->owns_data) heap_free(bitmap->addr);
+    if (bitmap->owns_palette) heap_free(bitmap->palette);
+    heap_free(bitmap);
+}
+
+GBitmapFormat gbitmap_get_format(const GBitmap *bitmap) {
+    return bitmap->format;
+}
+
+GColor *gbitmap_get_palette(const GBitmap *bitmap) {
+    return bitmap->palette;
+}
+
+void gbitmap_set_palette(GBitmap *bitmap, GColor *palette, bool free_on_destroy) {
+    if (bitmap->owns_palette && bitmap->palette != palette) heap_free(bitmap->palette);
+    bitmap->palette = palette;
+    bitmap->owns_palette = free_on_destroy;
+}
+
+GRect gbitmap_get_bounds(const GBitmap *bitmap) {
+    return bitmap->bounds;
+}
+
+void gbitmap_set_bounds(GBitmap *bitmap, GRect bounds) {
+    bitmap->bounds = bounds;
+}
+
+uint16_t gbitmap_get_bytes_per_row(const GBitmap *bitmap) {
+    return bitmap->row_size_bytes;
+}
+
+uint8_t *gbitmap_get_data(const GBitmap *bitmap) {
+    return bitmap->addr;
+}
+
+// ==================== 資源 ====================
+
+ResHandle resource_get_handle(uint32_t resource_id) {
+    if (resource_id >= HOST_RESOURCE_SLOTS) return NULL;
+    const HostResource *res = &host_resources[resource_id];
+    return res->kind == HOST_RESOURCE_EMPTY ? NULL : res;
+}
+
+size_t resource_size(ResHandle h) {
+    const HostResource *res = h;
+    return res ? res->data_size : 0;
+}
+
+size_t resource_load_byte_range(ResHandle h, uint32_t start_offset, uint8_t *buffer, size_t num_bytes) {
+    const HostResource *res = h;
+    if (!res || start_offset >= res->data_size) return 0;
+    size_t n = res->data_size - start_offset;
+    if (n > num_bytes) n = num_bytes;
+    memcpy(buffer, res->data + start_offset, n);
+    host_counters.resource_raw_loads++;
+    host_counters.resource_bytes_read += n;
+    return n;
+}
+
+size_t resource_load(ResHandle h, uint8_t *buffer, size_t max_length) {
+    return resource_load_byte_range(h, 0, buffer, max_length);
+}
+
+// ==================== 圖層 ====================
+
+struct Layer {
+    GRect frame;
+    GRect bounds;
+    bool hidden;
+    Layer *parent;
+    Layer *first_child;
+    Layer *next_sibling;
+    LayerUpdateProc update_proc;
+    void *data;
+};
+
+struct BitmapLayer {
+    Layer layer;
+    const GBitmap *bitmap;
+    GColor background_color;
+    GCompOp compositing_mode;
+    GAlign alignment;
+};
+
+struct Window {
+    Layer *root_layer;
+    WindowHandlers handlers;
+    GColor background_color;
+    bool loaded;
+};
+
+static void layer_init(Layer *layer, GRect frame) {
+    layer->frame = frame;
+    layer->bounds = GRect(0, 0, frame.size.w, frame.size.h);
+}
+
+static bool s_render_pending;
+
+static void mark_dirty(void) {
+    host_counters.layers_marked_dirty++;
+    s_render_pending = true;
+}
+
+Layer *layer_create(GRect frame) {
+    return layer_create_with_data(frame, 0);
+}
+
+Layer *layer_create_with_data(GRect frame, size_t data_size) {
+    Layer *layer = heap_alloc(sizeof(Layer) + data_size, FW_SIZEOF_LAYER + data_size);
+    layer_init(layer, frame);
+    if (data_size) layer->data = layer + 1;
+    return layer;
+}
+
+void layer_remove_from_parent(Layer *child) {
+    if (!child || !child->parent) return;
+    Layer **link = &child->parent->first_child;
+    while (*link && *link != child) link = &(*link)->next_sibling;
+    if (*link) *link = child->next_sibling;
+    child->parent = NULL;
+    child->next_sibling = NULL;
+    mark_dirty();
+}
+
+void layer_destroy(Layer *layer) {
+    if (!layer) return;
+    layer_remove_from_parent(layer);
+    heap_free(layer);
+}
+
+void *layer_get_data(const Layer *layer) {
+    return layer->data;
+}
+
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc) {
+    layer->update_proc = update_proc;
+}
+
+void layer_mark_dirty(Layer *layer) {
+    if (layer) mark_dirty();
+}
+
+void layer_set_frame(Layer *layer, GRect frame) {
+    if (grect_equal(&layer->frame, &frame)) return;
+    bool same_size = layer->frame.size.w == frame.size.w && layer->frame.size.h == frame.size.h;
+    layer->frame = frame;
+    if (!same_size) layer->bounds.size = frame.size;
+    mark_dirty();
+}
+
+GRect layer_get_frame(const Layer *layer) {
+    return layer->frame;
+}
+
+void layer_set_bounds(Layer *layer, GRect bounds) {
+    if (grect_equal(&layer->bounds, &bounds)) return;
+    layer->bounds = bounds;
+    mark_dirty();
+}
+
+GRect layer_get_bounds(const Layer *layer) {
+    return layer->bounds;
+}
+
+void layer_set_hidden(Layer *layer, bool hidden) {
+    if (layer->hidden == hidden) return;
+    layer->hidden = hidden;
+    mark_dirty();
+}
+
+bool layer_get_hidden(const Layer *layer) {
+    return layer->hidden;
+}
+
+void layer_add_child(Layer *parent, Layer *child) {
+    if (!parent || !child) return;
+    layer_remove_from_parent(child);
+    Layer **link = &parent->first_child;
+    while (*link) link = &(*link)->next_sibling;
+    *link = child;
+    child->parent = parent;
+    mark_dirty();
+}
+
+// 與韌體相同：先以背景色填滿，再依對齊方式以指定合成模式繪製點陣圖
+static void bitmap_layer_update_proc(Layer *layer, GContext *ctx) {
+    BitmapLayer *bitmap_layer = layer->data;
+    GRect bounds = layer->bounds;
+    graphics_context_set_fill_color(ctx, bitmap_layer->background_color);
+    graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+
+    if (!bitmap_layer->bitmap) return;
+    GSize size = gbitmap_get_bounds(bitmap_layer->bitmap).size;
+    GRect rect = GRect(bounds.origin.x, bounds.origin.y, size.w, size.h);
+    if (bitmap_layer->alignment == GAlignCenter) {
+        rect.origin.x += (bounds.size.w - size.w) / 2;
+        rect.origin.y += (bounds.size.h - size.h) / 2;
+    }
+    graphics_context_set_compositing_mode(ctx, bitmap_layer->compositing_mode);
+    graphics_draw_bitmap_in_rect(ctx, bitmap_layer->bitmap, rect);
+}
+
+BitmapLayer *bitmap_layer_create(GRect frame) {
+    BitmapLayer *bitmap_layer = heap_alloc(sizeof(BitmapLayer), FW_SIZEOF_BITMAP_LAYER);
+    layer_init(&bitmap_layer->layer, frame);
+    bitmap_layer->layer.data = bitmap_layer;
+    bitmap_layer->layer.update_proc = bitmap_layer_update_proc;
+    bitmap_layer->compositing_mode = GCompOpAssign;
+    bitmap_layer->alignment = GAlignCenter;
+    return bitmap_layer;
+}
+
+void bitmap_layer_destroy(BitmapLayer *bitmap_layer) {
+    if (!bitmap_layer) return;
+    layer_remove_from_parent(&bitmap_layer->layer);
+    heap_free(bitmap_layer);
+}
+
+Layer *bitmap_layer_get_layer(const BitmapLayer *bitmap_layer) {
+    return (Layer *)&bitmap_layer->layer;
+}
+
+void bitmap_layer_set_bitmap(BitmapLayer *bitmap_layer, const GBitmap *bitmap) {
+    bitmap_layer->bitmap = bitmap;
+    mark_dirty();
+}
+
+void bitmap_layer_set_background_color(BitmapLayer *bitmap_layer, GColor color) {
+    bitmap_layer->background_color = color;
+    mark_dirty();
+}
+
+void bitmap_layer_set_compositing_mode(BitmapLayer *bitmap_layer, GCompOp mode) {
+    bitmap_layer->compositing_mode = mode;
+    mark_dirty();
+}
+
+void bitmap_layer_set_alignment(BitmapLayer *bitmap_layer, GAlign alignment) {
+    bitmap_layer->alignment = alignment;
+    mark_dirty();
+}
+
+// ==================== 視窗 ====================
+
+Window *window_create(void) {
+    Window *window = heap_alloc(sizeof(Window), FW_SIZEOF_WINDOW);
+    window->root_layer = layer_create(GRect(0, 0, HOST_SCREEN_W, HOST_SCREEN_H));
+    window->background_color = GColorWhite;
+    return window;
+}
+
+static Window *s_top_window;
+
+void window_destroy(Window *window) {
+    if (!window) return;
+    if (s_top_window == window) s_top_window = NULL;
+    if (window->loaded) {
+        if (window->handlers.disappear) window->handlers.disappear(window);
+        if (window->handlers.unload) window->handlers.unload(window);
+        window->loaded = false;
+    }
+    layer_destroy(window->root_layer);
+    heap_free(window);
+}
+
+void window_set_window_handlers(Window *window, WindowHandlers handlers) {
+    window->handlers = handlers;
+}
+
+void window_set_background_color(Window *window, GColor background_color) {
+    window->background_color = background_color;
+    mark_dirty();
+}
+
+Layer *window_get_root_layer(const Window *window) {
+    return window->root_layer;
+}
+
+void window_stack_push(Window *window, bool animated) {
+    if (window->loaded) return;
+    window->loaded = true;
+    s_top_window = window;
+    s_render_pending = true;
+    if (window->handlers.load) window->handlers.load(window);
+    if (window->handlers.appear) window->handlers.appear(window);
+    host_render_pending();
+}
+
+// ==================== 軟體繪製 ====================
+//
+// 以 GColor8 模擬畫面，逐圖層呼叫 update_proc。繪圖座標經 GContext 的原點平移，
+// 並裁切至圖層 frame 與所有祖先 frame 的交集。黑白平台的調色盤本來就只含黑、白與透明，
+// 因此同樣以 GColor8 儲存。
+
+struct GContext {
+    GPoint origin;
+    GRect clip;
+    GColor fill_color;
+    GCompOp compositing_mode;
+};
+
+static GColor8 s_framebuffer[HOST_SCREEN_H * HOST_SCREEN_W];
+static bool s_rendering;
+
+void host_set_rendering(bool enabled) {
+    s_rendering = enabled;
+}
+
+const GColor8 *host_framebuffer(void) {
+    return s_framebuffer;
+}
+
+GSize host_screen_size(void) {
+    return GSize(HOST_SCREEN_W, HOST_SCREEN_H);
+}
+
+void graphics_context_set_fill_color(GContext *ctx, GColor color) {
+    ctx->fill_color = color;
+}
+
+void graphics_context_set_compositing_mode(GContext *ctx, GCompOp mode) {
+    ctx->compositing_mode = mode;
+}
+
+// 將圖層座標的矩形轉為裁切後的螢幕座標
+static GRect context_clip_rect(const GContext *ctx, GRect rect) {
+    rect.origin.x += ctx->origin.x;
+    rect.origin.y += ctx->origin.y;
+    grect_clip(&rect, &ctx->clip);
+    return rect;
+}
+
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask) {
+    if (ctx->fill_color.a == 0) return;
+    GRect area = context_clip_rect(ctx, rect);
+    GColor8 color = ctx->fill_color;
+    for (int y = area.origin.y; y < area.origin.y + area.size.h; y++) {
+        GColor8 *row = &s_framebuffer[y * HOST_SCREEN_W];
+        for (int x = area.origin.x; x < area.origin.x + area.size.w; x++) {
+            row[x] = color;
+        }
+    }
+    host_counters.pixels_drawn += (uint64_t)area.size.w * area.size.h;
+}
+
+static GColor8 bitmap_pixel(const GBitmap *bitmap, int x, int y) {
+    const uint8_t *row = bitmap->addr + y * bitmap->row_size_bytes;
+    int index;
+    switch (bitmap->format) {
+        case GBitmapFormat1Bit:
+            // 非調色盤 1-bit 為 LSB 在前
+            return (row[x / 8] >> (x % 8)) & 1 ? GColorWhite : GColorBlack;
+        case GBitmapFormat1BitPalette:
+            index = (row[x / 8] >> (7 - x % 8)) & 0x1;
+            break;
+        case GBitmapFormat2BitPalette:
+            index = (row[x / 4] >> (6 - 2 * (x % 4))) & 0x3;
+            break;
+        case GBitmapFormat4BitPalette:
+            index = (row[x / 2] >> (4 - 4 * (x % 2))) & 0xF;
+            break;
+        default:
+            return (GColor8){.argb = row[x]};
+    }
+    return bitmap->palette ? bitmap->palette[index] : GColorBlack;
+}
+
+// rect 大於點陣圖時與韌體相同以平鋪方式填滿
+void graphics_draw_bitmap_in_rect(GContext *ctx, const GBitmap *bitmap, GRect rect) {
+    if (!bitmap) return;
+    GRect src = bitmap->bounds;
+    if (grect_is_empty(&src)) return;
+
+    GRect area = context_clip_rect(ctx, rect);
+    int dest_x = rect.origin.x + ctx->origin.x;
+    int dest_y = rect.origin.y + ctx->origin.y;
+    bool set = ctx->compositing_mode == GCompOpSet;
+    for (int y = area.origin.y; y < area.origin.y + area.size.h; y++) {
+        GColor8 *row = &s_framebuffer[y * HOST_SCREEN_W];
+        int sy = src.origin.y + (y - dest_y) % src.size.h;
+        for (int x = area.origin.x; x < area.origin.x + area.size.w; x++) {
+            GColor8 color = bitmap_pixel(bitmap, src.origin.x + (x - dest_x) % src.size.w, sy);
+            // GCompOpSet 略過透明像素；字形只有全透明與不透明兩種像素，不需混色
+            if (set && color.a == 0) continue;
+            color.a = 3;
+            row[x] = color;
+            host_counters.pixels_drawn++;
+        }
+    }
+}
+
+// 彩色平台直接交出 GColor8 畫面。黑白平台與韌體相同交出 1-bit 畫面：擷取時由 GColor8 畫面打包，
+// 釋放時整個寫回為 GColorWhite / GColorBlack（實機畫面只有這兩種狀態）。打包與寫回是模擬環境才有的成本，
+// 不計入 render_ns
+#if defined(PBL_BW)
+#define HOST_FB1_ROW_BYTES (((HOST_SCREEN_W + 31) / 32) * 4)
+static uint8_t s_framebuffer_1bit[HOST_SCREEN_H * HOST_FB1_ROW_BYTES];
+#endif
+static GBitmap s_captured_framebuffer;
+static bool s_framebuffer_captured;
+static uint64_t s_emulation_ns;
+
+static uint64_t host_elapsed_ns(const struct timespec *start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (uint64_t)(end.tv_sec - start->tv_sec) * 1000000000ull
+           + (uint64_t)end.tv_nsec - (uint64_t)start->tv_nsec;
+}
+
+GBitmap *graphics_capture_frame_buffer(GContext *ctx) {
+    if (s_framebuffer_captured) return NULL;
+    s_framebuffer_captured = true;
+    s_captured_framebuffer = (GBitmap){
+        .bounds = GRect(0, 0, HOST_SCREEN_W, HOST_SCREEN_H),
+    };
+#if defined(PBL_BW)
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    memset(s_framebuffer_1bit, 0, sizeof(s_framebuffer_1bit));
+    for (int y = 0; y < HOST_SCREEN_H; y++) {
+        for (int x = 0; x < HOST_SCREEN_W; x++) {
+            if (gcolor_equal(s_framebuffer[y * HOST_SCREEN_W + x], GColorWhite)) {
+                s_framebuffer_1bit[y * HOST_FB1_ROW_BYTES + x / 8] |= (uint8_t)(1u << (x % 8));
+            }
+        }
+    }
+    s_captured_framebuffer.addr = s_framebuffer_1bit;
+    s_captured_framebuffer.row_size_bytes = HOST_FB1_ROW_BYTES;
+    s_captured_framebuffer.format = GBitmapFormat1Bit;
+    s_emulation_ns += host_elapsed_ns(&start);
+#else
+    s_captured_framebuffer.addr = (uint8_t *)s_framebuffer;
+    s_captured_framebuffer.row_size_bytes = HOST_SCREEN_W;
+    s_captured_framebuffer.format = GBitmapFormat8Bit;
+#endif
+    return &s_captured_framebuffer;
+}
+
+bool graphics_release_frame_buffer(GContext *ctx, GBitmap *buffer) {
+    if (!s_framebuffer_captured || buffer != &s_captured_framebuffer) return false;
+    s_framebuffer_captured = false;
+#if defined(PBL_BW)
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int y = 0; y < HOST_SCREEN_H; y++) {
+        for (int x = 0; x < HOST_SCREEN_W; x++) {
+            bool white = (s_framebuffer_1bit[y * HOST_FB1_ROW_BYTES + x / 8] >> (x % 8)) & 1;
+            s_framebuffer[y * HOST_SCREEN_W + x] = white ? GColorWhite : GColorBlack;
+        }
+    }
+    s_emulation_ns += host_elapsed_ns(&start);
+#endif
+    return true;
+}
+
+GFont fonts_get_system_font(const char *font_key) {
+    return NULL;
+}
+
+void graphics_context_set_text_color(GContext *ctx, GColor color) {
+}
+
+void graphics_draw_text(GContext *ctx, const char *text, const GFont font, const GRect box,
+                        const GTextOverflowMode overflow_mode, const GTextAlignment alignment,
+                        GTextAttributes *text_attributes) {
+}
+
+static void render_layer(GContext *ctx, Layer *layer, GPoint parent_origin, GRect parent_clip) {
+    if (layer->hidden) return;
+
+    GRect frame = layer->frame;
+    frame.origin.x += parent_origin.x;
+    frame.origin.y += parent_origin.y;
+    GRect clip = frame;
+    grect_clip(&clip, &parent_clip);
+    if (grect_is_empty(&clip)) return;
+
+    GPoint origin = GPoint(frame.origin.x + layer->bounds.origin.x, frame.origin.y + layer->bounds.origin.y);
+    if (layer->update_proc) {
+        ctx->origin = origin;
+        ctx->clip = clip;
+        host_counters.layers_drawn++;
+        layer->update_proc(layer, ctx);
+    }
+    for (Layer *child = layer->first_child; child; child = child->next_sibling) {
+        render_layer(ctx, child, origin, clip);
+    }
+}
+
+// 與韌體相同，每輪事件處理後若有圖層需重繪，整個視窗由上而下重繪一次
+// 模擬的繪製耗時：只推進 time_ms 讀到的時間
+static uint32_t s_render_cost_ms;
+static int64_t s_cpu_ms;
+
+void host_render_pending(void) {
+    if (!s_render_pending || !s_top_window) return;
+    s_render_pending = false;
+    if (!s_rendering) return;
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    s_cpu_ms += s_render_cost_ms;
+
+    GContext ctx = {
+        .clip = GRect(0, 0, HOST_SCREEN_W, HOST_SCREEN_H),
+        .fill_color = s_top_window->background_color,
+        .compositing_mode = GCompOpAssign,
+    };
+    graphics_fill_rect(&ctx, ctx.clip, 0, GCornerNone);
+    render_layer(&ctx, s_top_window->root_layer, GPointZero, ctx.clip);
+
+    host_counters.render_ns += host_elapsed_ns(&start) - s_emulation_ns;
+    host_counters.emulation_ns += s_emulation_ns;
+    s_emulation_ns = 0;
+    host_counters.frames_rendered++;
+}
+
+void host_set_render_cost_ms(uint32_t ms) {
+    s_render_cost_ms = ms;
+}
+
+// ==================== 模擬時鐘 ====================
+
+static int64_t s_now_ms;
+static bool s_is_24h = true;
+
+time_t host_time(time_t *tloc) {
+    time_t now = (time_t)(s_now_ms / 1000);
+    if (tloc) *tloc = now;
+    return now;
+}
+
+void host_set_time(time_t now) {
+    s_now_ms = (int64_t)now * 1000;
+}
+
+time_t host_get_time(void) {
+    return host_time(NULL);
+}
+
+uint16_t time_ms(time_t *tloc, uint16_t *out_ms) {
+    int64_t now = s_now_ms + s_cpu_ms;
+    uint16_t ms = (uint16_t)(now % 1000);
+    if (tloc) *tloc = (time_t)(now / 1000);
+    if (out_ms) *out_ms = ms;
+    return ms;
+}
+
+void host_set_24h_style(bool is_24h) {
+    s_is_24h = is_24h;
+}
+
+bool clock_is_24h_style(void) {
+    return s_is_24h;
+}
+
+// ==================== 動畫 ====================
+//
+// 依 SDK 3 語意：動畫結束（finished=true）或被取消（finished=false）時呼叫 stopped 回呼，
+// 回呼返回後若 app 未自行銷毀、也未在回呼內重新排程則自動釋放。所有存活中的動畫登記於 s_live_animations，
+// 對已釋放的指標呼叫 API 會被偵測並計入 invalid_animation_calls。
+// 仍在延遲中的動畫不產生影格，推進時間時直接跳到其開始時間，也不算 host_run_until_idle 等待的動畫。
+
+struct Animation {
+    uint32_t duration_ms;
+    uint32_t delay_ms;
+    AnimationCurve curve;
+    AnimationHandlers handlers;
+    void *context;
+    const AnimationImplementation *implementation;
+    bool scheduled;
+    bool started;
+    bool in_stopped;
+    bool destroy_requested;
+    uint32_t elapsed_ms;
+    Animation *next_live;
+};
+
+struct PropertyAnimation {
+    Animation animation;
+    const PropertyAnimationImplementation *implementation;
+    void *subject;
+    GRect from;
+    GRect to;
+};
+
+static Animation *s_live_animations;
+static uint32_t s_invalid_animation_calls;
+
+static bool animation_is_live(Animation *animation) {
+    for (Animation *a = s_live_animations; a; a = a->next_live) {
+        if (a == animation) return true;
+    }
+    return false;
+}
+
+static Animation *animation_alloc(size_t actual, size_t accounted) {
+    Animation *animation = heap_alloc(actual, accounted);
+    animation->duration_ms = 250;
+    animation->curve = AnimationCurveDefault;
+    animation->next_live = s_live_animations;
+    s_live_animations = animation;
+    return animation;
+}
+
+static void animation_free(Animation *animation) {
+    Animation **link = &s_live_animations;
+    while (*link && *link != animation) link = &(*link)->next_live;
+    if (*link) *link = animation->next_live;
+    heap_free(animation);
+}
+
+static bool check_live(Animation *animation) {
+    if (animation && animation_is_live(animation)) return true;
+    if (animation) {
+        s_invalid_animation_calls++;
+        APP_LOG(APP_LOG_LEVEL_ERROR, "host: call on dead animation %p", (void *)animation);
+    }
+    return false;
+}
+
+Animation *animation_create(void) {
+    return animation_alloc(sizeof(Animation), FW_SIZEOF_ANIMATION);
+}
+
+bool animation_destroy(Animation *animation) {
+    if (!check_live(animation)) return false;
+    if (animation->in_stopped) {
+        animation->destroy_requested = true;
+        return true;
+    }
+    if (animation->scheduled) {
+        animation->destroy_requested = true;
+        animation_unschedule(animation);
+        return true;
+    }
+    animation_free(animation);
+    return true;
+}
+
+bool animation_set_duration(Animation *animation, uint32_t duration_ms) {
+    if (!check_live(animation)) return false;
+    animation->duration_ms = duration_ms;
+    return true;
+}
+
+bool animation_set_delay(Animation *animation, uint32_t delay_ms) {
+    if (!check_live(animation)) return false;
+    animation->delay_ms = delay_ms;
+    return true;
+}
+
+bool animation_set_curve(Animation *animation, AnimationCurve curve) {
+    if (!check_live(animation)) return false;
+    animation->curve = curve;
+    return true;
+}
+
+bool animation_set_handlers(Animation *animation, AnimationHandlers callbacks, void *context) {
+    if (!check_live(animation)) return false;
+    animation->handlers = callbacks;
+    animation->context = context;
+    return true;
+}
+
+bool animation_set_implementation(Animation *animation, const AnimationImplementation *implementation) {
+    if (!check_live(animation)) return false;
+    animation->implementation = implementation;
+    return true;
+}
+
+void *animation_get_context(Animation *animation) {
+    return check_live(animation) ? animation->context : NULL;
+}
+
+bool animation_schedule(Animation *animation) {
+    if (!check_live(animation)) return false;
+    if (animation->scheduled) return true;
+    animation->scheduled = true;
+    animation->started = false;
+    animation->elapsed_ms = 0;
+    host_counters.animations_scheduled++;
+    return true;
+}
+
+static void animation_finish(Animation *animation, bool finished) {
+    animation->scheduled = false;
+    animation->in_stopped = true;
+    if (animation->handlers.stopped) {
+        animation->handlers.stopped(animation, finished, animation->context);
+    }
+    if (animation->implementation && animation->implementation->teardown) {
+        animation->implementation->teardown(animation);
+    }
+    animation->in_stopped = false;
+    if (animation->scheduled && !animation->destroy_requested) return;
+    animation_free(animation);
+}
+
+bool animation_unschedule(Animation *animation) {
+    if (!check_live(animation)) return false;
+    if (!animation->scheduled) return false;
+    animation_finish(animation, false);
+    return true;
+}
+
+bool animation_is_scheduled(Animation *animation) {
+    return check_live(animation) && animation->scheduled;
+}
+
+static int32_t apply_curve(AnimationCurve curve, int32_t t) {
+    int64_t max = ANIMATION_NORMALIZED_MAX;
+    switch (curve) {
+        case AnimationCurveEaseIn:
+            return (int32_t)(t * (int64_t)t / max);
+        case AnimationCurveEaseOut:
+            return (int32_t)(max - (max - t) * (max - t) / max);
+        case AnimationCurveEaseInOut:
+            if (t < max / 2) return (int32_t)(2 * (int64_t)t * t / max);
+            return (int32_t)(max - 2 * (max - t) * (max - t) / max);
+        default:
+            return t;
+    }
+}
+
+void property_animation_update_grect(PropertyAnimation *property_animation, const uint32_t distance_normalized) {
+    PropertyAnimation *pa = property_animation;
+    int32_t progress = (int32_t)distance_normalized;
+    GRect frame = pa->from;
+    frame.origin.x += (int16_t)((pa->to.origin.x - pa->from.origin.x) * progress / ANIMATION_NORMALIZED_MAX);
+    frame.origin.y += (int16_t)((pa->to.origin.y - pa->from.origin.y) * progress / ANIMATION_NORMALIZED_MAX);
+    frame.size.w += (int16_t)((pa->to.size.w - pa->from.size.w) * progress / ANIMATION_NORMALIZED_MAX);
+    frame.size.h += (int16_t)((pa->to.size.h - pa->from.size.h) * progress / ANIMATION_NORMALIZED_MAX);
+    pa->implementation->accessors.setter.grect(pa->subject, frame);
+}
+
+PropertyAnimation *property_animation_create(const PropertyAnimationImplementation *implementation,
+                                             void *subject, void *from_value, void *to_value) {
+    PropertyAnimation *pa = (PropertyAnimation *)animation_alloc(sizeof(PropertyAnimation),
+                                                                 FW_SIZEOF_PROPERTY_ANIMATION);
+    pa->animation.implementation = &implementation->base;
+    pa->implementation = implementation;
+    pa->subject = subject;
+    GRectGetter getter = implementation->accessors.getter.grect;
+    pa->from = from_value ? *(GRect *)from_value : getter(subject);
+    pa->to = to_value ? *(GRect *)to_value : getter(subject);
+    return pa;
+}
+
+static const PropertyAnimationImplementation s_layer_frame_impl = {
+    .base = {
+        .update = (AnimationUpdateImplementation)property_animation_update_grect,
+    },
+    .accessors = {
+        .setter = {.grect = (GRectSetter)layer_set_frame},
+        .getter = {.grect = (GRectGetter)layer_get_frame},
+    },
+};
+
+PropertyAnimation *property_animation_create_layer_frame(Layer *layer, GRect *from_frame, GRect *to_frame) {
+    return property_animation_create(&s_layer_frame_impl, layer, from_frame, to_frame);
+}
+
+void property_animation_destroy(PropertyAnimation *property_animation) {
+    if (property_animation) animation_destroy(&property_animation->animation);
+}
+
+Animation *property_animation_get_animation(PropertyAnimation *property_animation) {
+    return property_animation ? &property_animation->animation : NULL;
+}
+
+// 推進所有排程中的動畫 dt 毫秒；新排程的動畫從下一影格開始計時
+static void animations_step(uint32_t dt) {
+    Animation *due[64];
+    size_t count = 0;
+    for (Animation *a = s_live_animations; a && count < ARRAY_LENGTH(due); a = a->next_live) {
+        if (a->scheduled) due[count++] = a;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        Animation *a = due[i];
+        if (!animation_is_live(a) || !a->scheduled) continue;
+
+        a->elapsed_ms += dt;
+        if (a->elapsed_ms < a->delay_ms) continue;
+
+        if (!a->started) {
+            a->started = true;
+            if (a->handlers.started) a->handlers.started(a, a->context);
+            if (!animation_is_live(a) || !a->scheduled) continue;
+            if (a->implementation && a->implementation->setup) a->implementation->setup(a);
+        }
+
+        uint32_t run = a->elapsed_ms - a->delay_ms;
+        int32_t t = a->duration_ms ? (int32_t)((int64_t)run * ANIMATION_NORMALIZED_MAX / a->duration_ms)
+                                   : ANIMATION_NORMALIZED_MAX;
+        if (t > ANIMATION_NORMALIZED_MAX) t = ANIMATION_NORMALIZED_MAX;
+
+        if (a->implementation && a->implementation->update) {
+            a->implementation->update(a, apply_curve(a->curve, t));
+            host_counters.animation_frames++;
+        }
+        if (!animation_is_live(a) || !a->scheduled) continue;
+
+        if (t >= ANIMATION_NORMALIZED_MAX) {
+            animation_finish(a, true);
+        }
+    }
+}
+
+// 遮蔽物進出的系統動畫（見「未遮蔽區域」一節）與 App 的動畫一起推進
+static bool s_unobstructed_animating;
+static void unobstructed_step(uint32_t dt);
+
+static bool animations_pending(void) {
+    if (s_unobstructed_animating) return true;
+    for (Animation *a = s_live_animations; a; a = a->next_live) {
+        if (a->scheduled && a->elapsed_ms >= a->delay_ms) return true;
+    }
+    return false;
+}
+
+// 延遲中的動畫最早的開始時間
+static int64_t next_animation_start(void) {
+    int64_t next = INT64_MAX;
+    for (Animation *a = s_live_animations; a; a = a->next_live) {
+        if (a->scheduled && a->elapsed_ms < a->delay_ms && s_now_ms + (a->delay_ms - a->elapsed_ms) < next) {
+            next = s_now_ms + (a->delay_ms - a->elapsed_ms);
+        }
+    }
+    return next;
+}
+
+uint32_t host_invalid_animation_calls(void) {
+    return s_invalid_animation_calls;
+}
+
+// ==================== 計時器 ====================
+//
+// 與韌體相同，觸發的計時器於回呼返回後釋放；回呼內以 app_timer_reschedule 重新排定自己時則保留，
+// 同一個計時器可重複使用而不再配置。
+
+struct AppTimer {
+    int64_t fire_at_ms;
+    AppTimerCallback callback;
+    void *data;
+    AppTimer *next;
+};
+
+static AppTimer *s_timers;
+static AppTimer *s_firing_timer;      // 回呼執行中的計時器（已自 s_timers 移除）
+static bool s_firing_rescheduled;
+
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data) {
+    AppTimer *timer = heap_alloc(sizeof(AppTimer), FW_SIZEOF_APP_TIMER);
+    timer->fire_at_ms = s_now_ms + timeout_ms;
+    timer->callback = callback;
+    timer->data = callback_data;
+    timer->next = s_timers;
+    s_timers = timer;
+    host_counters.timers_registered++;
+    return timer;
+}
+
+static bool timer_unlink(AppTimer *timer) {
+    AppTimer **link = &s_timers;
+    while (*link && *link != timer) link = &(*link)->next;
+    if (!*link) return false;
+    *link = timer->next;
+    return true;
+}
+
+bool app_timer_reschedule(AppTimer *timer_handle, uint32_t new_timeout_ms) {
+    if (timer_handle && timer_handle == s_firing_timer) {
+        timer_handle->fire_at_ms = s_now_ms + new_timeout_ms;
+        s_firing_rescheduled = true;
+        return true;
+    }
+    for (AppTimer *t = s_timers; t; t = t->next) {
+        if (t == timer_handle) {
+            t->fire_at_ms = s_now_ms + new_timeout_ms;
+            return true;
+        }
+    }
+    return false;
+}
+
+void app_timer_cancel(AppTimer *timer_handle) {
+    if (timer_handle && timer_handle == s_firing_timer) {
+        s_firing_rescheduled = false;
+        return;
+    }
+    if (timer_handle && timer_unlink(timer_handle)) heap_free(timer_handle);
+}
+
+static int64_t next_timer_due(void) {
+    int64_t next = INT64_MAX;
+    for (AppTimer *t = s_timers; t; t = t->next) {
+        if (t->fire_at_ms < next) next = t->fire_at_ms;
+    }
+    return next;
+}
+
+static void timers_fire_due(void) {
+    for (;;) {
+        AppTimer *due = NULL;
+        for (AppTimer *t = s_timers; t; t = t->next) {
+            if (t->fire_at_ms <= s_now_ms && (!due || t->fire_at_ms < due->fire_at_ms)) due = t;
+        }
+        if (!due) return;
+        timer_unlink(due);
+        s_firing_timer = due;
+        s_firing_rescheduled = false;
+        due->callback(due->data);
+        s_firing_timer = NULL;
+        if (s_firing_rescheduled) {
+            due->next = s_timers;
+            s_timers = due;
+        } else {
+            heap_free(due);
+        }
+    }
+}
+
+// ==================== 時間推進 ====================
+
+void host_advance_ms(uint32_t ms) {
+    int64_t target = s_now_ms + ms;
+    while (s_now_ms < target) {
+        if (animations_pending()) {
+            int64_t step = target - s_now_ms < HOST_FRAME_MS ? target - s_now_ms : HOST_FRAME_MS;
+            s_now_ms += step;
+            timers_fire_due();
+            unobstructed_step((uint32_t)step);
+            animations_step((uint32_t)step);
+        } else {
+            int64_t next = MIN(next_timer_due(), next_animation_start());
+            int64_t step = (next < target ? next : target) - s_now_ms;
+            s_now_ms += step;
+            timers_fire_due();
+            animations_step((uint32_t)step);
+        }
+        host_render_pending();
+    }
+}
+
+uint32_t host_run_until_idle(void) {
+    uint32_t elapsed = 0;
+    while (animations_pending() && elapsed < 10000) {
+        host_advance_ms(HOST_FRAME_MS);
+        elapsed += HOST_FRAME_MS;
+    }
+    return elapsed;
+}
+
+// ==================== 時間服務 ====================
+
+static TickHandler s_tick_handler;
+static TimeUnits s_tick_units;
+
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler) {
+    s_tick_handler = handler;
+    s_tick_units = tick_units;
+}
+
+void tick_timer_service_unsubscribe(void) {
+    s_tick_handler = NULL;
+    s_tick_units = 0;
+}
+
+void host_tick(TimeUnits units_changed) {
+    units_changed |= SECOND_UNIT;
+    if (!s_tick_handler || !(units_changed & s_tick_units)) return;
+    time_t now = host_time(NULL);
+    struct tm tick_time;
+    localtime_r(&now, &tick_time);
+    s_tick_handler(&tick_time, units_changed);
+    host_render_pending();
+}
+
+// ==================== 系統事件服務 ====================
+//
+// 電量、焦點、勿擾模式與加速度計由基準測試透過 host_set_* 設定；
+// 狀態改變時與韌體相同，同步呼叫已訂閱的處理函式。
+
+static BatteryChargeState s_battery = {.charge_percent = 100};
+static BatteryStateHandler s_battery_handler;
+static AppFocusHandlers s_focus_handlers;
+static bool s_in_focus = true;
+static bool s_quiet_time;
+static AccelData s_accel = {.z = -1000};
+static AccelTapHandler s_accel_tap_handler;
+static bool s_accel_data_subscribed;
+static bool s_accel_data_streaming;
+static AccelSamplingRate s_accel_sampling_rate = ACCEL_SAMPLING_25HZ;
+
+void battery_state_service_subscribe(BatteryStateHandler handler) {
+    s_battery_handler = handler;
+}
+
+void battery_state_service_unsubscribe(void) {
+    s_battery_handler = NULL;
+}
+
+BatteryChargeState battery_state_service_peek(void) {
+    return s_battery;
+}
+
+void app_focus_service_subscribe_handlers(AppFocusHandlers handlers) {
+    s_focus_handlers = handlers;
+}
+
+void app_focus_service_unsubscribe(void) {
+    memset(&s_focus_handlers, 0, sizeof(s_focus_handlers));
+}
+
+#if !defined(PBL_PLATFORM_APLITE)
+bool quiet_time_is_active(void) {
+    return s_quiet_time;
+}
+#endif
+
+void host_set_battery(uint8_t charge_percent, bool is_charging) {
+    if (s_battery.charge_percent == charge_percent && s_battery.is_charging == is_charging) return;
+    s_battery.charge_percent = charge_percent;
+    s_battery.is_charging = is_charging;
+    s_battery.is_plugged = is_charging;
+    if (s_battery_handler) s_battery_handler(s_battery);
+    host_render_pending();
+}
+
+void host_set_focus(bool in_focus) {
+    if (s_in_focus == in_focus) return;
+    if (s_focus_handlers.will_focus) s_focus_handlers.will_focus(in_focus);
+    s_in_focus = in_focus;
+    if (s_focus_handlers.did_focus) s_focus_handlers.did_focus(in_focus);
+    host_render_pending();
+}
+
+void host_set_quiet_time(bool active) {
+    s_quiet_time = active;
+}
+
+void accel_tap_service_subscribe(AccelTapHandler handler) {
+    s_accel_tap_handler = handler;
+}
+
+void accel_tap_service_unsubscribe(void) {
+    s_accel_tap_handler = NULL;
+}
+
+// 模擬器不產生批次取樣，只記錄訂閱狀態供 accel_service_peek 檢查
+void accel_data_service_subscribe(uint32_t samples_per_update, AccelDataHandler handler) {
+    s_accel_data_subscribed = true;
+    s_accel_data_streaming = samples_per_update > 0;
+}
+
+void accel_data_service_unsubscribe(void) {
+    s_accel_data_subscribed = false;
+    s_accel_data_streaming = false;
+    s_accel_sampling_rate = ACCEL_SAMPLING_25HZ;
+}
+
+int accel_service_set_sampling_rate(AccelSamplingRate rate) {
+    if (!s_accel_data_subscribed) return -1;
+    s_accel_sampling_rate = rate;
+    return 0;
+}
+
+int accel_service_peek(AccelData *data) {
+    if (!s_accel_data_subscribed) return -1;
+    if (s_accel_data_streaming) return -2;
+    *data = s_accel;
+    data->timestamp = (uint64_t)s_now_ms;
+    return 0;
+}
+
+void host_set_accel(int16_t x, int16_t y, int16_t z) {
+    s_accel = (AccelData){.x = x, .y = y, .z = z};
+}
+
+int host_accel_sampling_hz(void) {
+    return s_accel_data_subscribed ? (int)s_accel_sampling_rate : 0;
+}
+
+void host_accel_tap(void) {
+    if (s_accel_tap_handler) s_accel_tap_handler(ACCEL_AXIS_Y, 1);
+    host_render_pending();
+}
+
+// ==================== 未遮蔽區域 ====================
+//
+// 遮蔽物的進出由系統動畫驅動，不佔用 App 的堆積，也不計入 animations_scheduled；
+// 動畫期間 layer_get_unobstructed_bounds 回傳逐影格插值的範圍。Aplite 沒有此功能。
+
+#if !defined(PBL_PLATFORM_APLITE)
+static UnobstructedAreaHandlers s_unobstructed_handlers;
+static void *s_unobstructed_context;
+static int16_t s_unobstructed_h = HOST_SCREEN_H;     // 目前可見區域的高度
+static int16_t s_unobstructed_from;
+static int16_t s_unobstructed_to = HOST_SCREEN_H;
+static uint32_t s_unobstructed_elapsed_ms;
+
+void unobstructed_area_service_subscribe(UnobstructedAreaHandlers handlers, void *context) {
+    s_unobstructed_handlers = handlers;
+    s_unobstructed_context = context;
+}
+
+void unobstructed_area_service_unsubscribe(void) {
+    memset(&s_unobstructed_handlers, 0, sizeof(s_unobstructed_handlers));
+    s_unobstructed_context = NULL;
+}
+
+// layer 的 bounds 與可見區域的交集，以 layer 的 bounds 座標表示
+GRect layer_get_unobstructed_bounds(const Layer *layer) {
+    GPoint offset = GPointZero;
+    for (const Layer *l = layer; l; l = l->parent) {
+        offset.x += l->frame.origin.x + l->bounds.origin.x;
+        offset.y += l->frame.origin.y + l->bounds.origin.y;
+    }
+    GRect visible = GRect(-offset.x, -offset.y, HOST_SCREEN_W, s_unobstructed_h);
+    GRect bounds = layer->bounds;
+    grect_clip(&bounds, &visible);
+    return bounds;
+}
+
+void host_set_unobstructed_height(int16_t height) {
+    if (height == s_unobstructed_to) return;
+    s_unobstructed_from = s_unobstructed_h;
+    s_unobstructed_to = height;
+    s_unobstructed_elapsed_ms = 0;
+    s_unobstructed_animating = true;
+    if (s_unobstructed_handlers.will_change) {
+        s_unobstructed_handlers.will_change(GRect(0, 0, HOST_SCREEN_W, height), s_unobstructed_context);
+    }
+    host_render_pending();
+}
+
+static void unobstructed_step(uint32_t dt) {
+    if (!s_unobstructed_animating) return;
+
+    s_unobstructed_elapsed_ms += dt;
+    uint32_t run = MIN(s_unobstructed_elapsed_ms, HOST_UNOBSTRUCTED_ANIMATION_MS);
+    AnimationProgress progress = (AnimationProgress)((int64_t)run * ANIMATION_NORMALIZED_MAX /
+                                                     HOST_UNOBSTRUCTED_ANIMATION_MS);
+    s_unobstructed_h = (int16_t)(s_unobstructed_from +
+                                 (s_unobstructed_to - s_unobstructed_from) * (int64_t)progress / ANIMATION_NORMALIZED_MAX);
+    if (s_unobstructed_handlers.change) {
+        s_unobstructed_handlers.change(progress, s_unobstructed_context);
+    }
+    if (run >= HOST_UNOBSTRUCTED_ANIMATION_MS) {
+        s_unobstructed_animating = false;
+        if (s_unobstructed_handlers.did_change) {
+            s_unobstructed_handlers.did_change(s_unobstructed_context);
+        }
+    }
+}
+
+static void unobstructed_reset(void) {
+    s_unobstructed_h = HOST_SCREEN_H;
+    s_unobstructed_to = HOST_SCREEN_H;
+    s_unobstructed_animating = false;
+}
+#else
+void host_set_unobstructed_height(int16_t height) {
+}
+
+static void unobstructed_step(uint32_t dt) {
+}
+
+static void unobstructed_reset(void) {
+}
+#endif
+
+// ==================== 持久化儲存 ====================
+
+#define HOST_PERSIST_SLOTS 64
+
+typedef struct {
+    bool used;
+    uint32_t key;
+    int size;
+    uint8_t data[PERSIST_DATA_MAX_LENGTH];
+} PersistSlot;
+
+static PersistSlot s_persist[HOST_PERSIST_SLOTS];
+
+static PersistSlot *persist_find(uint32_t key) {
+    for (int i = 0; i < HOST_PERSIST_SLOTS; i++) {
+        if (s_persist[i].used && s_persist[i].key == key) return &s_persist[i];
+    }
+    return NULL;
+}
+
+static PersistSlot *persist_slot_for_write(uint32_t key) {
+    PersistSlot *slot = persist_find(key);
+    if (slot) return slot;
+    for (int i = 0; i < HOST_PERSIST_SLOTS; i++) {
+        if (!s_persist[i].used) {
+            s_persist[i].used = true;
+            s_persist[i].key = key;
+            return &s_persist[i];
+        }
+    }
+    return NULL;
+}
+
+void host_persist_clear(void) {
+    memset(s_persist, 0, sizeof(s_persist));
+}
+
+bool persist_exists(uint32_t key) {
+    host_counters.persist_reads++;
+    return persist_find(key) != NULL;
+}
+
+int persist_get_size(uint32_t key) {
+    host_counters.persist_reads++;
+    PersistSlot *slot = persist_find(key);
+    return slot ? slot->size : E_DOES_NOT_EXIST;
+}
+
+int persist_read_data(uint32_t key, void *buffer, size_t buffer_size) {
+    host_counters.persist_reads++;
+    PersistSlot *slot = persist_find(key);
+    if (!slot) return E_DOES_NOT_EXIST;
+    int n = slot->size < (int)buffer_size ? slot->size : (int)buffer_size;
+    memcpy(buffer, slot->data, n);
+    return n;
+}
+
+int32_t persist_read_int(uint32_t key) {
+    int32_t value = 0;
+    persist_read_data(key, &value, sizeof(value));
+    return value;
+}
+
+bool persist_read_bool(uint32_t key) {
+    return persist_read_int(key) != 0;
+}
+
+int persist_write_data(uint32_t key, const void *data, size_t size) {
+    if (size > PERSIST_DATA_MAX_LENGTH) size = PERSIST_DATA_MAX_LENGTH;
+    PersistSlot *slot = persist_slot_for_write(key);
+    if (!slot) return E_DOES_NOT_EXIST;
+    host_counters.persist_writes++;
+    memcpy(slot->data, data, size);
+    slot->size = (int)size;
+    return (int)size;
+}
+
+status_t persist_write_int(uint32_t key, int32_t value) {
+    return persist_write_data(key, &value, sizeof(value)) == sizeof(value) ? S_SUCCESS : E_DOES_NOT_EXIST;
+}
+
+status_t persist_write_bool(uint32_t key, bool value) {
+    return persist_write_int(key, value ? 1 : 0);
+}
+
+status_t persist_delete(uint32_t key) {
+    PersistSlot *slot = persist_find(key);
+    if (!slot) return E_DOES_NOT_EXIST;
+    host_counters.persist_writes++;
+    slot->used = false;
+    return S_SUCCESS;
+}
+
+// ==================== AppMessage ====================
+
+#define HOST_DICT_CAPACITY 32
+
+struct DictionaryIterator {
+    Tuple tuples[HOST_DICT_CAPACITY];
+    int count;
+    int cursor;
+};
+
+static AppMessageInboxReceived s_inbox_received;
+static AppMessageInboxDropped s_inbox_dropped;
+static AppMessageOutboxSent s_outbox_sent;
+static AppMessageOutboxFailed s_outbox_failed;
+static DictionaryIterator s_outbox;
+static bool s_outbox_open;
+
+Tuple *dict_find(const DictionaryIterator *iter, const uint32_t key) {
+    for (int i = 0; i < iter->count; i++) {
+        if (iter->tuples[i].key == key) return (Tuple *)&iter->tuples[i];
+    }
+    return NULL;
+}
+
+Tuple *dict_read_first(DictionaryIterator *iter) {
+    iter->cursor = 0;
+    return dict_read_next(iter);
+}
+
+Tuple *dict_read_next(DictionaryIterator *iter) {
+    if (iter->cursor >= iter->count) return NULL;
+    return &iter->tuples[iter->cursor++];
+}
+
+DictionaryResult dict_write_int32(DictionaryIterator *iter, const uint32_t key, const int32_t value) {
+    if (iter->count >= HOST_DICT_CAPACITY) return DICT_NOT_ENOUGH_STORAGE;
+    Tuple *tuple = &iter->tuples[iter->count++];
+    tuple->key = key;
+    tuple->type = TUPLE_INT;
+    tuple->length = sizeof(int32_t);
+    tuple->value->int32 = value;
+    return DICT_OK;
+}
+
+AppMessageResult app_message_open(const uint32_t size_inbound, const uint32_t size_outbound) {
+    return APP_MSG_OK;
+}
+
+void app_message_deregister_callbacks(void) {
+    s_inbox_received = NULL;
+    s_inbox_dropped = NULL;
+    s_outbox_sent = NULL;
+    s_outbox_failed = NULL;
+}
+
+AppMessageInboxReceived app_message_register_inbox_received(AppMessageInboxReceived received_callback) {
+    AppMessageInboxReceived previous = s_inbox_received;
+    s_inbox_received = received_callback;
+    return previous;
+}
+
+AppMessageInboxDropped app_message_register_inbox_dropped(AppMessageInboxDropped dropped_callback) {
+    AppMessageInboxDropped previous = s_inbox_dropped;
+    s_inbox_dropped = dropped_callback;
+    return previous;
+}
+
+AppMessageOutboxSent app_message_register_outbox_sent(AppMessageOutboxSent sent_callback) {
+    AppMessageOutboxSent previous = s_outbox_sent;
+    s_outbox_sent = sent_callback;
+    return previous;
+}
+
+AppMessageOutboxFailed app_message_register_outbox_failed(AppMessageOutboxFailed failed_callback) {
+    AppMessageOutboxFailed previous = s_outbox_failed;
+    s_outbox_failed = failed_callback;
+    return previous;
+}
+
+AppMessageResult app_message_outbox_begin(DictionaryIterator **iterator) {
+    if (s_outbox_open) return APP_MSG_BUSY;
+    memset(&s_outbox, 0, sizeof(s_outbox));
+    s_outbox_open = true;
+    *iterator = &s_outbox;
+    return APP_MSG_OK;
+}
+
+AppMessageResult app_message_outbox_send(void) {
+    if (!s_outbox_open) return APP_MSG_INVALID_ARGS;
+    s_outbox_open = false;
+    host_counters.app_messages_sent++;
+    if (s_outbox_sent) s_outbox_sent(&s_outbox, NULL);
+    return APP_MSG_OK;
+}
+
+void host_deliver_message(const uint32_t *keys, const int32_t *values, int count) {
+    DictionaryIterator iter;
+    memset(&iter, 0, sizeof(iter));
+    for (int i = 0; i < count; i++) {
+        dict_write_int32(&iter, keys[i], values[i]);
+    }
+    if (s_inbox_received) s_inbox_received(&iter, NULL);
+    host_render_pending();
+}
+
+const DictionaryIterator *host_last_message_sent(void) {
+    return &s_outbox;
+}
+
+// ==================== 應用程式 ====================
+
+void app_event_loop(void) {
+}
+
+void host_reset(void) {
+    while (s_timers) {
+        AppTimer *t = s_timers;
+        s_timers = t->next;
+        heap_free(t);
+    }
+    memset(&host_counters, 0, sizeof(host_counters));
+    s_invalid_animation_calls = 0;
+    s_heap_peak = s_heap_used;
+    s_render_pending = false;
+    memset(s_framebuffer, 0, sizeof(s_framebuffer));
+    s_battery = (BatteryChargeState){.charge_percent = 100};
+    s_in_focus = true;
+    s_quiet_time = false;
+    s_accel = (AccelData){.z = -1000};
+    accel_data_service_unsubscribe();
+    s_render_cost_ms = 0;
+    s_cpu_ms = 0;
+    unobstructed_reset();
+}
+
+// ==================== 測試檢查 ====================
+
+int host_checks;
+int host_failures;
+
+void host_check(bool ok, const char *label, const char *what) {
+    host_checks++;
+    if (ok) return;
+    host_failures++;
+    fprintf(stderr, "  %s: %s\n", label, what);
+}
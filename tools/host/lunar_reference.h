@@ -0,0 +1,427 @@
+// 由 tools/host/gen_lunar_reference.js 產生，請勿手動修改
+#pragma once
+
+// 每個農曆月初一：自 1970-01-01 起的天數、月份、是否為閏月
+typedef struct {
+    int32_t epoch_day;
+    uint8_t month;
+    uint8_t leap;
+} LunarMonthStart;
+
+static const LunarMonthStart LUNAR_REFERENCE[2489] = {
+    {-25567, 12, 0}, {-25537, 1, 0}, {-25508, 2, 0}, {-25478, 3, 0}, {-25449, 4, 0}, {-25420, 5, 0},
+    {-25390, 6, 0}, {-25361, 7, 0}, {-25331, 8, 0}, {-25301, 8, 1}, {-25272, 9, 0}, {-25242, 10, 0},
+    {-25212, 11, 0}, {-25183, 12, 0}, {-25153, 1, 0}, {-25124, 2, 0}, {-25094, 3, 0}, {-25065, 4, 0},
+    {-25036, 5, 0}, {-25006, 6, 0}, {-24977, 7, 0}, {-24947, 8, 0}, {-24918, 9, 0}, {-24888, 10, 0},
+    {-24858, 11, 0}, {-24828, 12, 0}, {-24799, 1, 0}, {-24769, 2, 0}, {-24740, 3, 0}, {-24710, 4, 0},
+    {-24681, 5, 0}, {-24652, 6, 0}, {-24622, 7, 0}, {-24593, 8, 0}, {-24563, 9, 0}, {-24534, 10, 0},
+    {-24504, 11, 0}, {-24474, 12, 0}, {-24444, 1, 0}, {-24415, 2, 0}, {-24385, 3, 0}, {-24356, 4, 0},
+    {-24326, 5, 0}, {-24297, 5, 1}, {-24268, 6, 0}, {-24238, 7, 0}, {-24209, 8, 0}, {-24180, 9, 0},
+    {-24150, 10, 0}, {-24120, 11, 0}, {-24091, 12, 0}, {-24061, 1, 0}, {-24031, 2, 0}, {-24001, 3, 0},
+    {-23972, 4, 0}, {-23942, 5, 0}, {-23913, 6, 0}, {-23884, 7, 0}, {-23854, 8, 0}, {-23825, 9, 0},
+    {-23796, 10, 0}, {-23766, 11, 0}, {-23736, 12, 0}, {-23707, 1, 0}, {-23677, 2, 0}, {-23647, 3, 0},
+    {-23618, 4, 0}, {-23588, 5, 0}, {-23558, 6, 0}, {-23529, 7, 0}, {-23500, 8, 0}, {-23470, 9, 0},
+    {-23441, 10, 0}, {-23411, 11, 0}, {-23382, 12, 0}, {-23352, 1, 0}, {-23323, 2, 0}, {-23293, 3, 0},
+    {-23263, 4, 0}, {-23234, 4, 1}, {-23204, 5, 0}, {-23175, 6, 0}, {-23145, 7, 0}, {-23116, 8, 0},
+    {-23086, 9, 0}, {-23057, 10, 0}, {-23027, 11, 0}, {-22998, 12, 0}, {-22968, 1, 0}, {-22939, 2, 0},
+    {-22909, 3, 0}, {-22880, 4, 0}, {-22850, 5, 0}, {-22821, 6, 0}, {-22791, 7, 0}, {-22761, 8, 0},
+    {-22732, 9, 0}, {-22702, 10, 0}, {-22673, 11, 0}, {-22643, 12, 0}, {-22614, 1, 0}, {-22584, 2, 0},
+    {-22555, 3, 0}, {-22526, 4, 0}, {-22496, 5, 0}, {-22466, 6, 0}, {-22437, 7, 0}, {-22407, 8, 0},
+    {-22378, 9, 0}, {-22348, 10, 0}, {-22318, 11, 0}, {-22289, 12, 0}, {-22259, 1, 0}, {-22230, 2, 0},
+    {-22200, 2, 1}, {-22171, 3, 0}, {-22142, 4, 0}, {-22112, 5, 0}, {-22083, 6, 0}, {-22053, 7, 0},
+    {-22024, 8, 0}, {-21994, 9, 0}, {-21964, 10, 0}, {-21934, 11, 0}, {-21905, 12, 0}, {-21875, 1, 0},
+    {-21846, 2, 0}, {-21816, 3, 0}, {-21787, 4, 0}, {-21758, 5, 0}, {-21728, 6, 0}, {-21699, 7, 0},
+    {-21669, 8, 0}, {-21640, 9, 0}, {-21610, 10, 0}, {-21580, 11, 0}, {-21550, 12, 0}, {-21521, 1, 0},
+    {-21491, 2, 0}, {-21462, 3, 0}, {-21432, 4, 0}, {-21403, 5, 0}, {-21374, 6, 0}, {-21344, 6, 1},
+    {-21315, 7, 0}, {-21286, 8, 0}, {-21256, 9, 0}, {-21226, 10, 0}, {-21197, 11, 0}, {-21167, 12, 0},
+    {-21137, 1, 0}, {-21107, 2, 0}, {-21078, 3, 0}, {-21048, 4, 0}, {-21019, 5, 0}, {-20990, 6, 0},
+    {-20960, 7, 0}, {-20931, 8, 0}, {-20902, 9, 0}, {-20872, 10, 0}, {-20842, 11, 0}, {-20813, 12, 0},
+    {-20783, 1, 0}, {-20753, 2, 0}, {-20723, 3, 0}, {-20694, 4, 0}, {-20664, 5, 0}, {-20635, 6, 0},
+    {-20606, 7, 0}, {-20576, 8, 0}, {-20547, 9, 0}, {-20518, 10, 0}, {-20488, 11, 0}, {-20459, 12, 0},
+    {-20429, 1, 0}, {-20399, 2, 0}, {-20369, 3, 0}, {-20340, 4, 0}, {-20310, 5, 0}, {-20281, 5, 1},
+    {-20251, 6, 0}, {-20222, 7, 0}, {-20192, 8, 0}, {-20163, 9, 0}, {-20134, 10, 0}, {-20104, 11, 0},
+    {-20075, 12, 0}, {-20045, 1, 0}, {-20015, 2, 0}, {-19986, 3, 0}, {-19956, 4, 0}, {-19926, 5, 0},
+    {-19897, 6, 0}, {-19867, 7, 0}, {-19838, 8, 0}, {-19808, 9, 0}, {-19779, 10, 0}, {-19749, 11, 0},
+    {-19720, 12, 0}, {-19691, 1, 0}, {-19661, 2, 0}, {-19631, 3, 0}, {-19602, 4, 0}, {-19572, 5, 0},
+    {-19543, 6, 0}, {-19513, 7, 0}, {-19483, 8, 0}, {-19454, 9, 0}, {-19424, 10, 0}, {-19395, 11, 0},
+    {-19365, 12, 0}, {-19336, 1, 0}, {-19306, 2, 0}, {-19277, 3, 0}, {-19248, 3, 1}, {-19218, 4, 0},
+    {-19189, 5, 0}, {-19159, 6, 0}, {-19129, 7, 0}, {-19100, 8, 0}, {-19070, 9, 0}, {-19040, 10, 0},
+    {-19011, 11, 0}, {-18981, 12, 0}, {-18952, 1, 0}, {-18922, 2, 0}, {-18893, 3, 0}, {-18864, 4, 0},
+    {-18834, 5, 0}, {-18805, 6, 0}, {-18775, 7, 0}, {-18746, 8, 0}, {-18716, 9, 0}, {-18686, 10, 0},
+    {-18657, 11, 0}, {-18627, 12, 0}, {-18597, 1, 0}, {-18568, 2, 0}, {-18538, 3, 0}, {-18509, 4, 0},
+    {-18480, 5, 0}, {-18450, 6, 0}, {-18421, 7, 0}, {-18392, 7, 1}, {-18362, 8, 0}, {-18332, 9, 0},
+    {-18303, 10, 0}, {-18273, 11, 0}, {-18243, 12, 0}, {-18213, 1, 0}, {-18184, 2, 0}, {-18154, 3, 0},
+    {-18125, 4, 0}, {-18096, 5, 0}, {-18066, 6, 0}, {-18037, 7, 0}, {-18008, 8, 0}, {-17978, 9, 0},
+    {-17949, 10, 0}, {-17919, 11, 0}, {-17889, 12, 0}, {-17859, 1, 0}, {-17829, 2, 0}, {-17800, 3, 0},
+    {-17770, 4, 0}, {-17741, 5, 0}, {-17712, 6, 0}, {-17682, 7, 0}, {-17653, 8, 0}, {-17624, 9, 0},
+    {-17594, 10, 0}, {-17565, 11, 0}, {-17535, 12, 0}, {-17505, 1, 0}, {-17475, 2, 0}, {-17446, 3, 0},
+    {-17416, 4, 0}, {-17386, 5, 0}, {-17357, 6, 0}, {-17328, 6, 1}, {-17298, 7, 0}, {-17269, 8, 0},
+    {-17240, 9, 0}, {-17210, 10, 0}, {-17181, 11, 0}, {-17151, 12, 0}, {-17121, 1, 0}, {-17092, 2, 0},
+    {-17062, 3, 0}, {-17032, 4, 0}, {-17003, 5, 0}, {-16973, 6, 0}, {-16944, 7, 0}, {-16914, 8, 0},
+    {-16885, 9, 0}, {-16856, 10, 0}, {-16826, 11, 0}, {-16797, 12, 0}, {-16767, 1, 0}, {-16738, 2, 0},
+    {-16708, 3, 0}, {-16678, 4, 0}, {-16649, 5, 0}, {-16619, 6, 0}, {-16589, 7, 0}, {-16560, 8, 0},
+    {-16530, 9, 0}, {-16501, 10, 0}, {-16471, 11, 0}, {-16442, 12, 0}, {-16413, 1, 0}, {-16383, 2, 0},
+    {-16354, 3, 0}, {-16324, 4, 0}, {-16295, 4, 1}, {-16265, 5, 0}, {-16235, 6, 0}, {-16206, 7, 0},
+    {-16176, 8, 0}, {-16146, 9, 0}, {-16117, 10, 0}, {-16087, 11, 0}, {-16058, 12, 0}, {-16028, 1, 0},
+    {-15999, 2, 0}, {-15970, 3, 0}, {-15940, 4, 0}, {-15911, 5, 0}, {-15881, 6, 0}, {-15852, 7, 0},
+    {-15822, 8, 0}, {-15792, 9, 0}, {-15763, 10, 0}, {-15733, 11, 0}, {-15703, 12, 0}, {-15674, 1, 0},
+    {-15644, 2, 0}, {-15615, 3, 0}, {-15586, 4, 0}, {-15556, 5, 0}, {-15527, 6, 0}, {-15497, 7, 0},
+    {-15468, 8, 0}, {-15438, 9, 0}, {-15409, 10, 0}, {-15379, 11, 0}, {-15349, 12, 0}, {-15319, 1, 0},
+    {-15290, 2, 0}, {-15260, 2, 1}, {-15231, 3, 0}, {-15202, 4, 0}, {-15172, 5, 0}, {-15143, 6, 0},
+    {-15114, 7, 0}, {-15084, 8, 0}, {-15055, 9, 0}, {-15025, 10, 0}, {-14995, 11, 0}, {-14965, 12, 0},
+    {-14935, 1, 0}, {-14906, 2, 0}, {-14876, 3, 0}, {-14847, 4, 0}, {-14818, 5, 0}, {-14788, 6, 0},
+    {-14759, 7, 0}, {-14730, 8, 0}, {-14700, 9, 0}, {-14671, 10, 0}, {-14641, 11, 0}, {-14611, 12, 0},
+    {-14581, 1, 0}, {-14552, 2, 0}, {-14522, 3, 0}, {-14492, 4, 0}, {-14463, 5, 0}, {-14434, 6, 0},
+    {-14404, 6, 1}, {-14375, 7, 0}, {-14346, 8, 0}, {-14316, 9, 0}, {-14287, 10, 0}, {-14257, 11, 0},
+    {-14227, 12, 0}, {-14198, 1, 0}, {-14168, 2, 0}, {-14138, 3, 0}, {-14109, 4, 0}, {-14079, 5, 0},
+    {-14050, 6, 0}, {-14020, 7, 0}, {-13991, 8, 0}, {-13962, 9, 0}, {-13932, 10, 0}, {-13903, 11, 0},
+    {-13873, 12, 0}, {-13844, 1, 0}, {-13814, 2, 0}, {-13784, 3, 0}, {-13754, 4, 0}, {-13725, 5, 0},
+    {-13695, 6, 0}, {-13666, 7, 0}, {-13636, 8, 0}, {-13607, 9, 0}, {-13578, 10, 0}, {-13548, 11, 0},
+    {-13519, 12, 0}, {-13489, 1, 0}, {-13460, 2, 0}, {-13430, 3, 0}, {-13400, 4, 0}, {-13371, 5, 0},
+    {-13341, 5, 1}, {-13311, 6, 0}, {-13282, 7, 0}, {-13252, 8, 0}, {-13223, 9, 0}, {-13193, 10, 0},
+    {-13164, 11, 0}, {-13135, 12, 0}, {-13105, 1, 0}, {-13076, 2, 0}, {-13046, 3, 0}, {-13017, 4, 0},
+    {-12987, 5, 0}, {-12957, 6, 0}, {-12928, 7, 0}, {-12898, 8, 0}, {-12869, 9, 0}, {-12839, 10, 0},
+    {-12809, 11, 0}, {-12780, 12, 0}, {-12750, 1, 0}, {-12721, 2, 0}, {-12692, 3, 0}, {-12662, 4, 0},
+    {-12633, 5, 0}, {-12603, 6, 0}, {-12574, 7, 0}, {-12544, 8, 0}, {-12514, 9, 0}, {-12485, 10, 0},
+    {-12455, 11, 0}, {-12425, 12, 0}, {-12396, 1, 0}, {-12366, 2, 0}, {-12337, 3, 0}, {-12308, 3, 1},
+    {-12278, 4, 0}, {-12249, 5, 0}, {-12220, 6, 0}, {-12190, 7, 0}, {-12160, 8, 0}, {-12131, 9, 0},
+    {-12101, 10, 0}, {-12071, 11, 0}, {-12041, 12, 0}, {-12012, 1, 0}, {-11982, 2, 0}, {-11953, 3, 0},
+    {-11924, 4, 0}, {-11894, 5, 0}, {-11865, 6, 0}, {-11836, 7, 0}, {-11806, 8, 0}, {-11777, 9, 0},
+    {-11747, 10, 0}, {-11717, 11, 0}, {-11687, 12, 0}, {-11658, 1, 0}, {-11628, 2, 0}, {-11598, 3, 0},
+    {-11569, 4, 0}, {-11540, 5, 0}, {-11510, 6, 0}, {-11481, 7, 0}, {-11452, 7, 1}, {-11422, 8, 0},
+    {-11393, 9, 0}, {-11363, 10, 0}, {-11333, 11, 0}, {-11304, 12, 0}, {-11274, 1, 0}, {-11244, 2, 0},
+    {-11214, 3, 0}, {-11185, 4, 0}, {-11156, 5, 0}, {-11126, 6, 0}, {-11097, 7, 0}, {-11068, 8, 0},
+    {-11038, 9, 0}, {-11009, 10, 0}, {-10979, 11, 0}, {-10950, 12, 0}, {-10920, 1, 0}, {-10890, 2, 0},
+    {-10860, 3, 0}, {-10831, 4, 0}, {-10801, 5, 0}, {-10772, 6, 0}, {-10742, 7, 0}, {-10713, 8, 0},
+    {-10684, 9, 0}, {-10654, 10, 0}, {-10625, 11, 0}, {-10595, 12, 0}, {-10566, 1, 0}, {-10536, 2, 0},
+    {-10506, 3, 0}, {-10477, 4, 0}, {-10447, 5, 0}, {-10417, 6, 0}, {-10388, 6, 1}, {-10358, 7, 0},
+    {-10329, 8, 0}, {-10300, 9, 0}, {-10270, 10, 0}, {-10241, 11, 0}, {-10211, 12, 0}, {-10182, 1, 0},
+    {-10152, 2, 0}, {-10123, 3, 0}, {-10093, 4, 0}, {-10063, 5, 0}, {-10034, 6, 0}, {-10004, 7, 0},
+    {-9975, 8, 0}, {-9945, 9, 0}, {-9916, 10, 0}, {-9886, 11, 0}, {-9857, 12, 0}, {-9827, 1, 0},
+    {-9798, 2, 0}, {-9768, 3, 0}, {-9739, 4, 0}, {-9709, 5, 0}, {-9680, 6, 0}, {-9650, 7, 0},
+    {-9620, 8, 0}, {-9591, 9, 0}, {-9561, 10, 0}, {-9532, 11, 0}, {-9502, 12, 0}, {-9473, 1, 0},
+    {-9443, 2, 0}, {-9414, 3, 0}, {-9384, 4, 0}, {-9355, 4, 1}, {-9325, 5, 0}, {-9296, 6, 0},
+    {-9266, 7, 0}, {-9237, 8, 0}, {-9207, 9, 0}, {-9177, 10, 0}, {-9148, 11, 0}, {-9118, 12, 0},
+    {-9088, 1, 0}, {-9059, 2, 0}, {-9030, 3, 0}, {-9000, 4, 0}, {-8971, 5, 0}, {-8942, 6, 0},
+    {-8912, 7, 0}, {-8883, 8, 0}, {-8853, 9, 0}, {-8823, 10, 0}, {-8793, 11, 0}, {-8764, 12, 0},
+    {-8734, 1, 0}, {-8704, 2, 0}, {-8675, 3, 0}, {-8646, 4, 0}, {-8616, 5, 0}, {-8587, 6, 0},
+    {-8558, 7, 0}, {-8528, 8, 0}, {-8499, 9, 0}, {-8469, 10, 0}, {-8439, 11, 0}, {-8410, 12, 0},
+    {-8380, 1, 0}, {-8350, 2, 0}, {-8320, 2, 1}, {-8291, 3, 0}, {-8262, 4, 0}, {-8232, 5, 0},
+    {-8203, 6, 0}, {-8174, 7, 0}, {-8144, 8, 0}, {-8115, 9, 0}, {-8085, 10, 0}, {-8056, 11, 0},
+    {-8026, 12, 0}, {-7996, 1, 0}, {-7966, 2, 0}, {-7937, 3, 0}, {-7907, 4, 0}, {-7878, 5, 0},
+    {-7848, 6, 0}, {-7819, 7, 0}, {-7790, 8, 0}, {-7760, 9, 0}, {-7731, 10, 0}, {-7701, 11, 0},
+    {-7672, 12, 0}, {-7642, 1, 0}, {-7612, 2, 0}, {-7583, 3, 0}, {-7553, 4, 0}, {-7523, 5, 0},
+    {-7494, 6, 0}, {-7464, 7, 0}, {-7435, 7, 1}, {-7406, 8, 0}, {-7376, 9, 0}, {-7347, 10, 0},
+    {-7317, 11, 0}, {-7288, 12, 0}, {-7258, 1, 0}, {-7229, 2, 0}, {-7199, 3, 0}, {-7169, 4, 0},
+    {-7140, 5, 0}, {-7110, 6, 0}, {-7080, 7, 0}, {-7051, 8, 0}, {-7022, 9, 0}, {-6992, 10, 0},
+    {-6963, 11, 0}, {-6933, 12, 0}, {-6904, 1, 0}, {-6874, 2, 0}, {-6845, 3, 0}, {-6815, 4, 0},
+    {-6785, 5, 0}, {-6756, 6, 0}, {-6726, 7, 0}, {-6697, 8, 0}, {-6667, 9, 0}, {-6638, 10, 0},
+    {-6608, 11, 0}, {-6579, 12, 0}, {-6549, 1, 0}, {-6520, 2, 0}, {-6490, 3, 0}, {-6461, 4, 0},
+    {-6431, 5, 0}, {-6402, 5, 1}, {-6372, 6, 0}, {-6343, 7, 0}, {-6313, 8, 0}, {-6283, 9, 0},
+    {-6254, 10, 0}, {-6224, 11, 0}, {-6195, 12, 0}, {-6165, 1, 0}, {-6136, 2, 0}, {-6106, 3, 0},
+    {-6077, 4, 0}, {-6048, 5, 0}, {-6018, 6, 0}, {-5988, 7, 0}, {-5959, 8, 0}, {-5929, 9, 0},
+    {-5899, 10, 0}, {-5870, 11, 0}, {-5840, 12, 0}, {-5810, 1, 0}, {-5781, 2, 0}, {-5752, 3, 0},
+    {-5722, 4, 0}, {-5693, 5, 0}, {-5664, 6, 0}, {-5634, 7, 0}, {-5605, 8, 0}, {-5575, 9, 0},
+    {-5545, 10, 0}, {-5516, 11, 0}, {-5486, 12, 0}, {-5456, 1, 0}, {-5426, 2, 0}, {-5397, 3, 0},
+    {-5368, 3, 1}, {-5338, 4, 0}, {-5309, 5, 0}, {-5280, 6, 0}, {-5250, 7, 0}, {-5221, 8, 0},
+    {-5191, 9, 0}, {-5162, 10, 0}, {-5132, 11, 0}, {-5102, 12, 0}, {-5072, 1, 0}, {-5043, 2, 0},
+    {-5013, 3, 0}, {-4984, 4, 0}, {-4954, 5, 0}, {-4925, 6, 0}, {-4896, 7, 0}, {-4866, 8, 0},
+    {-4837, 9, 0}, {-4807, 10, 0}, {-4778, 11, 0}, {-4748, 12, 0}, {-4718, 1, 0}, {-4688, 2, 0},
+    {-4659, 3, 0}, {-4629, 4, 0}, {-4600, 5, 0}, {-4570, 6, 0}, {-4541, 7, 0}, {-4512, 8, 0},
+    {-4482, 8, 1}, {-4453, 9, 0}, {-4423, 10, 0}, {-4394, 11, 0}, {-4364, 12, 0}, {-4335, 1, 0},
+    {-4305, 2, 0}, {-4275, 3, 0}, {-4245, 4, 0}, {-4216, 5, 0}, {-4186, 6, 0}, {-4157, 7, 0},
+    {-4128, 8, 0}, {-4098, 9, 0}, {-4069, 10, 0}, {-4039, 11, 0}, {-4010, 12, 0}, {-3980, 1, 0},
+    {-3951, 2, 0}, {-3921, 3, 0}, {-3891, 4, 0}, {-3862, 5, 0}, {-3832, 6, 0}, {-3803, 7, 0},
+    {-3773, 8, 0}, {-3744, 9, 0}, {-3714, 10, 0}, {-3685, 11, 0}, {-3655, 12, 0}, {-3626, 1, 0},
+    {-3596, 2, 0}, {-3567, 3, 0}, {-3537, 4, 0}, {-3508, 5, 0}, {-3478, 6, 0}, {-3448, 6, 1},
+    {-3419, 7, 0}, {-3389, 8, 0}, {-3360, 9, 0}, {-3330, 10, 0}, {-3301, 11, 0}, {-3271, 12, 0},
+    {-3242, 1, 0}, {-3212, 2, 0}, {-3183, 3, 0}, {-3153, 4, 0}, {-3124, 5, 0}, {-3094, 6, 0},
+    {-3065, 7, 0}, {-3035, 8, 0}, {-3005, 9, 0}, {-2976, 10, 0}, {-2946, 11, 0}, {-2917, 12, 0},
+    {-2887, 1, 0}, {-2858, 2, 0}, {-2828, 3, 0}, {-2799, 4, 0}, {-2770, 5, 0}, {-2740, 6, 0},
+    {-2711, 7, 0}, {-2681, 8, 0}, {-2651, 9, 0}, {-2622, 10, 0}, {-2592, 11, 0}, {-2562, 12, 0},
+    {-2533, 1, 0}, {-2503, 2, 0}, {-2474, 3, 0}, {-2444, 4, 0}, {-2415, 4, 1}, {-2386, 5, 0},
+    {-2356, 6, 0}, {-2327, 7, 0}, {-2297, 8, 0}, {-2268, 9, 0}, {-2238, 10, 0}, {-2208, 11, 0},
+    {-2178, 12, 0}, {-2149, 1, 0}, {-2119, 2, 0}, {-2090, 3, 0}, {-2060, 4, 0}, {-2031, 5, 0},
+    {-2002, 6, 0}, {-1972, 7, 0}, {-1943, 8, 0}, {-1913, 9, 0}, {-1884, 10, 0}, {-1854, 11, 0},
+    {-1824, 12, 0}, {-1794, 1, 0}, {-1765, 2, 0}, {-1735, 3, 0}, {-1706, 4, 0}, {-1676, 5, 0},
+    {-1647, 6, 0}, {-1618, 7, 0}, {-1588, 8, 0}, {-1559, 9, 0}, {-1530, 10, 0}, {-1500, 11, 0},
+    {-1470, 12, 0}, {-1441, 1, 0}, {-1411, 2, 0}, {-1381, 3, 0}, {-1351, 3, 1}, {-1322, 4, 0},
+    {-1292, 5, 0}, {-1263, 6, 0}, {-1234, 7, 0}, {-1204, 8, 0}, {-1175, 9, 0}, {-1146, 10, 0},
+    {-1116, 11, 0}, {-1086, 12, 0}, {-1057, 1, 0}, {-1027, 2, 0}, {-997, 3, 0}, {-968, 4, 0},
+    {-938, 5, 0}, {-908, 6, 0}, {-879, 7, 0}, {-850, 8, 0}, {-820, 9, 0}, {-791, 10, 0},
+    {-761, 11, 0}, {-732, 12, 0}, {-702, 1, 0}, {-673, 2, 0}, {-643, 3, 0}, {-614, 4, 0},
+    {-584, 5, 0}, {-554, 6, 0}, {-525, 7, 0}, {-495, 7, 1}, {-466, 8, 0}, {-436, 9, 0},
+    {-407, 10, 0}, {-377, 11, 0}, {-348, 12, 0}, {-318, 1, 0}, {-289, 2, 0}, {-259, 3, 0},
+    {-230, 4, 0}, {-200, 5, 0}, {-171, 6, 0}, {-141, 7, 0}, {-111, 8, 0}, {-82, 9, 0},
+    {-52, 10, 0}, {-23, 11, 0}, {7, 12, 0}, {36, 1, 0}, {66, 2, 0}, {95, 3, 0},
+    {124, 4, 0}, {154, 5, 0}, {183, 6, 0}, {213, 7, 0}, {243, 8, 0}, {272, 9, 0},
+    {302, 10, 0}, {332, 11, 0}, {361, 12, 0}, {391, 1, 0}, {420, 2, 0}, {450, 3, 0},
+    {479, 4, 0}, {508, 5, 0}, {538, 5, 1}, {567, 6, 0}, {597, 7, 0}, {626, 8, 0},
+    {656, 9, 0}, {686, 10, 0}, {716, 11, 0}, {745, 12, 0}, {775, 1, 0}, {804, 2, 0},
+    {834, 3, 0}, {863, 4, 0}, {892, 5, 0}, {922, 6, 0}, {951, 7, 0}, {981, 8, 0},
+    {1010, 9, 0}, {1040, 10, 0}, {1070, 11, 0}, {1099, 12, 0}, {1129, 1, 0}, {1159, 2, 0},
+    {1188, 3, 0}, {1218, 4, 0}, {1247, 5, 0}, {1276, 6, 0}, {1306, 7, 0}, {1335, 8, 0},
+    {1364, 9, 0}, {1394, 10, 0}, {1424, 11, 0}, {1453, 12, 0}, {1483, 1, 0}, {1513, 2, 0},
+    {1543, 3, 0}, {1572, 4, 0}, {1602, 4, 1}, {1631, 5, 0}, {1660, 6, 0}, {1690, 7, 0},
+    {1719, 8, 0}, {1748, 9, 0}, {1778, 10, 0}, {1808, 11, 0}, {1837, 12, 0}, {1867, 1, 0},
+    {1897, 2, 0}, {1927, 3, 0}, {1956, 4, 0}, {1986, 5, 0}, {2015, 6, 0}, {2044, 7, 0},
+    {2074, 8, 0}, {2103, 9, 0}, {2132, 10, 0}, {2162, 11, 0}, {2191, 12, 0}, {2221, 1, 0},
+    {2251, 2, 0}, {2281, 3, 0}, {2310, 4, 0}, {2340, 5, 0}, {2369, 6, 0}, {2399, 7, 0},
+    {2428, 8, 0}, {2458, 8, 1}, {2487, 9, 0}, {2516, 10, 0}, {2546, 11, 0}, {2575, 12, 0},
+    {2605, 1, 0}, {2635, 2, 0}, {2664, 3, 0}, {2694, 4, 0}, {2724, 5, 0}, {2753, 6, 0},
+    {2783, 7, 0}, {2812, 8, 0}, {2842, 9, 0}, {2871, 10, 0}, {2901, 11, 0}, {2930, 12, 0},
+    {2959, 1, 0}, {2989, 2, 0}, {3018, 3, 0}, {3048, 4, 0}, {3078, 5, 0}, {3107, 6, 0},
+    {3137, 7, 0}, {3167, 8, 0}, {3196, 9, 0}, {3226, 10, 0}, {3255, 11, 0}, {3285, 12, 0},
+    {3314, 1, 0}, {3344, 2, 0}, {3373, 3, 0}, {3402, 4, 0}, {3432, 5, 0}, {3461, 6, 0},
+    {3491, 6, 1}, {3521, 7, 0}, {3550, 8, 0}, {3580, 9, 0}, {3610, 10, 0}, {3639, 11, 0},
+    {3669, 12, 0}, {3698, 1, 0}, {3728, 2, 0}, {3757, 3, 0}, {3786, 4, 0}, {3816, 5, 0},
+    {3845, 6, 0}, {3875, 7, 0}, {3904, 8, 0}, {3934, 9, 0}, {3964, 10, 0}, {3993, 11, 0},
+    {4023, 12, 0}, {4053, 1, 0}, {4082, 2, 0}, {4112, 3, 0}, {4141, 4, 0}, {4170, 5, 0},
+    {4200, 6, 0}, {4229, 7, 0}, {4258, 8, 0}, {4288, 9, 0}, {4318, 10, 0}, {4347, 11, 0},
+    {4377, 12, 0}, {4407, 1, 0}, {4437, 2, 0}, {4466, 3, 0}, {4496, 4, 0}, {4525, 4, 1},
+    {4554, 5, 0}, {4584, 6, 0}, {4613, 7, 0}, {4642, 8, 0}, {4672, 9, 0}, {4701, 10, 0},
+    {4731, 11, 0}, {4761, 12, 0}, {4791, 1, 0}, {4821, 2, 0}, {4850, 3, 0}, {4880, 4, 0},
+    {4909, 5, 0}, {4938, 6, 0}, {4968, 7, 0}, {4997, 8, 0}, {5026, 9, 0}, {5056, 10, 0},
+    {5085, 11, 0}, {5115, 12, 0}, {5145, 1, 0}, {5175, 2, 0}, {5204, 3, 0}, {5234, 4, 0},
+    {5264, 5, 0}, {5293, 6, 0}, {5322, 7, 0}, {5352, 8, 0}, {5381, 9, 0}, {5410, 10, 0},
+    {5440, 10, 1}, {5469, 11, 0}, {5499, 12, 0}, {5529, 1, 0}, {5558, 2, 0}, {5588, 3, 0},
+    {5618, 4, 0}, {5647, 5, 0}, {5677, 6, 0}, {5706, 7, 0}, {5736, 8, 0}, {5765, 9, 0},
+    {5794, 10, 0}, {5824, 11, 0}, {5853, 12, 0}, {5883, 1, 0}, {5912, 2, 0}, {5942, 3, 0},
+    {5972, 4, 0}, {6001, 5, 0}, {6031, 6, 0}, {6061, 7, 0}, {6090, 8, 0}, {6120, 9, 0},
+    {6149, 10, 0}, {6179, 11, 0}, {6208, 12, 0}, {6237, 1, 0}, {6267, 2, 0}, {6296, 3, 0},
+    {6326, 4, 0}, {6355, 5, 0}, {6385, 6, 0}, {6415, 7, 0}, {6444, 7, 1}, {6474, 8, 0},
+    {6504, 9, 0}, {6533, 10, 0}, {6563, 11, 0}, {6592, 12, 0}, {6621, 1, 0}, {6651, 2, 0},
+    {6680, 3, 0}, {6710, 4, 0}, {6739, 5, 0}, {6769, 6, 0}, {6798, 7, 0}, {6828, 8, 0},
+    {6858, 9, 0}, {6887, 10, 0}, {6917, 11, 0}, {6947, 12, 0}, {6976, 1, 0}, {7006, 2, 0},
+    {7035, 3, 0}, {7064, 4, 0}, {7094, 5, 0}, {7123, 6, 0}, {7153, 7, 0}, {7182, 8, 0},
+    {7212, 9, 0}, {7241, 10, 0}, {7271, 11, 0}, {7301, 12, 0}, {7331, 1, 0}, {7360, 2, 0},
+    {7390, 3, 0}, {7419, 4, 0}, {7448, 5, 0}, {7478, 5, 1}, {7507, 6, 0}, {7536, 7, 0},
+    {7566, 8, 0}, {7595, 9, 0}, {7625, 10, 0}, {7655, 11, 0}, {7685, 12, 0}, {7715, 1, 0},
+    {7744, 2, 0}, {7774, 3, 0}, {7803, 4, 0}, {7832, 5, 0}, {7862, 6, 0}, {7891, 7, 0},
+    {7920, 8, 0}, {7950, 9, 0}, {7979, 10, 0}, {8009, 11, 0}, {8039, 12, 0}, {8069, 1, 0},
+    {8098, 2, 0}, {8128, 3, 0}, {8158, 4, 0}, {8187, 5, 0}, {8216, 6, 0}, {8246, 7, 0},
+    {8275, 8, 0}, {8304, 9, 0}, {8334, 10, 0}, {8363, 11, 0}, {8393, 12, 0}, {8423, 1, 0},
+    {8452, 2, 0}, {8482, 3, 0}, {8512, 3, 1}, {8541, 4, 0}, {8571, 5, 0}, {8600, 6, 0},
+    {8630, 7, 0}, {8659, 8, 0}, {8688, 9, 0}, {8718, 10, 0}, {8747, 11, 0}, {8777, 12, 0},
+    {8806, 1, 0}, {8836, 2, 0}, {8866, 3, 0}, {8896, 4, 0}, {8925, 5, 0}, {8955, 6, 0},
+    {8984, 7, 0}, {9014, 8, 0}, {9043, 9, 0}, {9072, 10, 0}, {9102, 11, 0}, {9131, 12, 0},
+    {9161, 1, 0}, {9190, 2, 0}, {9220, 3, 0}, {9250, 4, 0}, {9279, 5, 0}, {9309, 6, 0},
+    {9338, 7, 0}, {9368, 8, 0}, {9398, 8, 1}, {9427, 9, 0}, {9456, 10, 0}, {9486, 11, 0},
+    {9515, 12, 0}, {9545, 1, 0}, {9574, 2, 0}, {9604, 3, 0}, {9633, 4, 0}, {9663, 5, 0},
+    {9693, 6, 0}, {9722, 7, 0}, {9752, 8, 0}, {9781, 9, 0}, {9811, 10, 0}, {9841, 11, 0},
+    {9870, 12, 0}, {9899, 1, 0}, {9929, 2, 0}, {9958, 3, 0}, {9988, 4, 0}, {10017, 5, 0},
+    {10047, 6, 0}, {10076, 7, 0}, {10106, 8, 0}, {10136, 9, 0}, {10165, 10, 0}, {10195, 11, 0},
+    {10225, 12, 0}, {10254, 1, 0}, {10284, 2, 0}, {10313, 3, 0}, {10342, 4, 0}, {10372, 5, 0},
+    {10401, 5, 1}, {10430, 6, 0}, {10460, 7, 0}, {10490, 8, 0}, {10519, 9, 0}, {10549, 10, 0},
+    {10579, 11, 0}, {10609, 12, 0}, {10638, 1, 0}, {10668, 2, 0}, {10697, 3, 0}, {10726, 4, 0},
+    {10756, 5, 0}, {10785, 6, 0}, {10814, 7, 0}, {10844, 8, 0}, {10873, 9, 0}, {10903, 10, 0},
+    {10933, 11, 0}, {10963, 12, 0}, {10992, 1, 0}, {11022, 2, 0}, {11052, 3, 0}, {11081, 4, 0},
+    {11110, 5, 0}, {11140, 6, 0}, {11169, 7, 0}, {11198, 8, 0}, {11228, 9, 0}, {11257, 10, 0},
+    {11287, 11, 0}, {11317, 12, 0}, {11346, 1, 0}, {11376, 2, 0}, {11406, 3, 0}, {11435, 4, 0},
+    {11465, 4, 1}, {11494, 5, 0}, {11524, 6, 0}, {11553, 7, 0}, {11582, 8, 0}, {11612, 9, 0},
+    {11641, 10, 0}, {11671, 11, 0}, {11700, 12, 0}, {11730, 1, 0}, {11760, 2, 0}, {11790, 3, 0},
+    {11819, 4, 0}, {11849, 5, 0}, {11878, 6, 0}, {11908, 7, 0}, {11937, 8, 0}, {11966, 9, 0},
+    {11996, 10, 0}, {12025, 11, 0}, {12055, 12, 0}, {12084, 1, 0}, {12114, 2, 0}, {12144, 3, 0},
+    {12173, 4, 0}, {12203, 5, 0}, {12233, 6, 0}, {12262, 7, 0}, {12292, 8, 0}, {12321, 9, 0},
+    {12350, 10, 0}, {12380, 11, 0}, {12409, 12, 0}, {12439, 1, 0}, {12468, 2, 0}, {12498, 2, 1},
+    {12527, 3, 0}, {12557, 4, 0}, {12587, 5, 0}, {12616, 6, 0}, {12646, 7, 0}, {12675, 8, 0},
+    {12705, 9, 0}, {12734, 10, 0}, {12764, 11, 0}, {12793, 12, 0}, {12823, 1, 0}, {12852, 2, 0},
+    {12882, 3, 0}, {12911, 4, 0}, {12941, 5, 0}, {12970, 6, 0}, {13000, 7, 0}, {13030, 8, 0},
+    {13059, 9, 0}, {13089, 10, 0}, {13118, 11, 0}, {13148, 12, 0}, {13177, 1, 0}, {13207, 2, 0},
+    {13236, 3, 0}, {13266, 4, 0}, {13295, 5, 0}, {13325, 6, 0}, {13354, 7, 0}, {13384, 7, 1},
+    {13413, 8, 0}, {13443, 9, 0}, {13473, 10, 0}, {13502, 11, 0}, {13532, 12, 0}, {13562, 1, 0},
+    {13591, 2, 0}, {13620, 3, 0}, {13650, 4, 0}, {13679, 5, 0}, {13708, 6, 0}, {13738, 7, 0},
+    {13767, 8, 0}, {13797, 9, 0}, {13827, 10, 0}, {13857, 11, 0}, {13886, 12, 0}, {13916, 1, 0},
+    {13946, 2, 0}, {13975, 3, 0}, {14004, 4, 0}, {14034, 5, 0}, {14063, 6, 0}, {14092, 7, 0},
+    {14122, 8, 0}, {14151, 9, 0}, {14181, 10, 0}, {14211, 11, 0}, {14240, 12, 0}, {14270, 1, 0},
+    {14300, 2, 0}, {14330, 3, 0}, {14359, 4, 0}, {14388, 5, 0}, {14418, 5, 1}, {14447, 6, 0},
+    {14476, 7, 0}, {14506, 8, 0}, {14535, 9, 0}, {14565, 10, 0}, {14594, 11, 0}, {14624, 12, 0},
+    {14654, 1, 0}, {14684, 2, 0}, {14713, 3, 0}, {14743, 4, 0}, {14772, 5, 0}, {14802, 6, 0},
+    {14831, 7, 0}, {14860, 8, 0}, {14890, 9, 0}, {14919, 10, 0}, {14949, 11, 0}, {14978, 12, 0},
+    {15008, 1, 0}, {15038, 2, 0}, {15067, 3, 0}, {15097, 4, 0}, {15127, 5, 0}, {15156, 6, 0},
+    {15186, 7, 0}, {15215, 8, 0}, {15244, 9, 0}, {15274, 10, 0}, {15303, 11, 0}, {15333, 12, 0},
+    {15362, 1, 0}, {15392, 2, 0}, {15421, 3, 0}, {15451, 4, 0}, {15481, 4, 1}, {15510, 5, 0},
+    {15540, 6, 0}, {15570, 7, 0}, {15599, 8, 0}, {15628, 9, 0}, {15658, 10, 0}, {15687, 11, 0},
+    {15717, 12, 0}, {15746, 1, 0}, {15776, 2, 0}, {15805, 3, 0}, {15835, 4, 0}, {15864, 5, 0},
+    {15894, 6, 0}, {15924, 7, 0}, {15953, 8, 0}, {15983, 9, 0}, {16012, 10, 0}, {16042, 11, 0},
+    {16071, 12, 0}, {16101, 1, 0}, {16130, 2, 0}, {16160, 3, 0}, {16189, 4, 0}, {16219, 5, 0},
+    {16248, 6, 0}, {16278, 7, 0}, {16307, 8, 0}, {16337, 9, 0}, {16367, 9, 1}, {16396, 10, 0},
+    {16426, 11, 0}, {16455, 12, 0}, {16485, 1, 0}, {16514, 2, 0}, {16544, 3, 0}, {16573, 4, 0},
+    {16602, 5, 0}, {16632, 6, 0}, {16661, 7, 0}, {16691, 8, 0}, {16721, 9, 0}, {16751, 10, 0},
+    {16780, 11, 0}, {16810, 12, 0}, {16839, 1, 0}, {16869, 2, 0}, {16898, 3, 0}, {16928, 4, 0},
+    {16957, 5, 0}, {16986, 6, 0}, {17016, 7, 0}, {17045, 8, 0}, {17075, 9, 0}, {17105, 10, 0},
+    {17134, 11, 0}, {17164, 12, 0}, {17194, 1, 0}, {17223, 2, 0}, {17253, 3, 0}, {17282, 4, 0},
+    {17312, 5, 0}, {17341, 6, 0}, {17370, 6, 1}, {17400, 7, 0}, {17429, 8, 0}, {17459, 9, 0},
+    {17488, 10, 0}, {17518, 11, 0}, {17548, 12, 0}, {17578, 1, 0}, {17607, 2, 0}, {17637, 3, 0},
+    {17666, 4, 0}, {17696, 5, 0}, {17725, 6, 0}, {17754, 7, 0}, {17784, 8, 0}, {17813, 9, 0},
+    {17842, 10, 0}, {17872, 11, 0}, {17902, 12, 0}, {17932, 1, 0}, {17962, 2, 0}, {17991, 3, 0},
+    {18021, 4, 0}, {18050, 5, 0}, {18080, 6, 0}, {18109, 7, 0}, {18138, 8, 0}, {18168, 9, 0},
+    {18197, 10, 0}, {18226, 11, 0}, {18256, 12, 0}, {18286, 1, 0}, {18315, 2, 0}, {18345, 3, 0},
+    {18375, 4, 0}, {18405, 4, 1}, {18434, 5, 0}, {18464, 6, 0}, {18493, 7, 0}, {18522, 8, 0},
+    {18552, 9, 0}, {18581, 10, 0}, {18611, 11, 0}, {18640, 12, 0}, {18670, 1, 0}, {18699, 2, 0},
+    {18729, 3, 0}, {18759, 4, 0}, {18788, 5, 0}, {18818, 6, 0}, {18847, 7, 0}, {18877, 8, 0},
+    {18906, 9, 0}, {18936, 10, 0}, {18965, 11, 0}, {18995, 12, 0}, {19024, 1, 0}, {19054, 2, 0},
+    {19083, 3, 0}, {19113, 4, 0}, {19142, 5, 0}, {19172, 6, 0}, {19202, 7, 0}, {19231, 8, 0},
+    {19261, 9, 0}, {19290, 10, 0}, {19320, 11, 0}, {19349, 12, 0}, {19379, 1, 0}, {19408, 2, 0},
+    {19438, 2, 1}, {19467, 3, 0}, {19496, 4, 0}, {19526, 5, 0}, {19556, 6, 0}, {19585, 7, 0},
+    {19615, 8, 0}, {19645, 9, 0}, {19674, 10, 0}, {19704, 11, 0}, {19733, 12, 0}, {19763, 1, 0},
+    {19792, 2, 0}, {19822, 3, 0}, {19851, 4, 0}, {19880, 5, 0}, {19910, 6, 0}, {19939, 7, 0},
+    {19969, 8, 0}, {19999, 9, 0}, {20028, 10, 0}, {20058, 11, 0}, {20088, 12, 0}, {20117, 1, 0},
+    {20147, 2, 0}, {20176, 3, 0}, {20206, 4, 0}, {20235, 5, 0}, {20264, 6, 0}, {20294, 6, 1},
+    {20323, 7, 0}, {20353, 8, 0}, {20382, 9, 0}, {20412, 10, 0}, {20442, 11, 0}, {20472, 12, 0},
+    {20501, 1, 0}, {20531, 2, 0}, {20560, 3, 0}, {20590, 4, 0}, {20619, 5, 0}, {20648, 6, 0},
+    {20678, 7, 0}, {20707, 8, 0}, {20736, 9, 0}, {20766, 10, 0}, {20796, 11, 0}, {20826, 12, 0},
+    {20856, 1, 0}, {20885, 2, 0}, {20915, 3, 0}, {20944, 4, 0}, {20974, 5, 0}, {21003, 6, 0},
+    {21032, 7, 0}, {21062, 8, 0}, {21091, 9, 0}, {21120, 10, 0}, {21150, 11, 0}, {21180, 12, 0},
+    {21209, 1, 0}, {21239, 2, 0}, {21269, 3, 0}, {21299, 4, 0}, {21328, 5, 0}, {21358, 5, 1},
+    {21387, 6, 0}, {21416, 7, 0}, {21446, 8, 0}, {21475, 9, 0}, {21504, 10, 0}, {21534, 11, 0},
+    {21564, 12, 0}, {21593, 1, 0}, {21623, 2, 0}, {21653, 3, 0}, {21682, 4, 0}, {21712, 5, 0},
+    {21741, 6, 0}, {21771, 7, 0}, {21800, 8, 0}, {21830, 9, 0}, {21859, 10, 0}, {21888, 11, 0},
+    {21918, 12, 0}, {21947, 1, 0}, {21977, 2, 0}, {22007, 3, 0}, {22036, 4, 0}, {22066, 5, 0},
+    {22096, 6, 0}, {22125, 7, 0}, {22155, 8, 0}, {22184, 9, 0}, {22214, 10, 0}, {22243, 11, 0},
+    {22273, 12, 0}, {22302, 1, 0}, {22331, 2, 0}, {22361, 3, 0}, {22391, 3, 1}, {22420, 4, 0},
+    {22450, 5, 0}, {22479, 6, 0}, {22509, 7, 0}, {22539, 8, 0}, {22568, 9, 0}, {22598, 10, 0},
+    {22627, 11, 0}, {22657, 12, 0}, {22686, 1, 0}, {22716, 2, 0}, {22745, 3, 0}, {22774, 4, 0},
+    {22804, 5, 0}, {22833, 6, 0}, {22863, 7, 0}, {22893, 8, 0}, {22922, 9, 0}, {22952, 10, 0},
+    {22982, 11, 0}, {23011, 12, 0}, {23041, 1, 0}, {23070, 2, 0}, {23100, 3, 0}, {23129, 4, 0},
+    {23158, 5, 0}, {23188, 6, 0}, {23217, 7, 0}, {23247, 8, 0}, {23276, 9, 0}, {23306, 10, 0},
+    {23336, 11, 0}, {23366, 11, 1}, {23395, 12, 0}, {23425, 1, 0}, {23454, 2, 0}, {23484, 3, 0},
+    {23513, 4, 0}, {23542, 5, 0}, {23572, 6, 0}, {23601, 7, 0}, {23631, 8, 0}, {23660, 9, 0},
+    {23690, 10, 0}, {23720, 11, 0}, {23749, 12, 0}, {23779, 1, 0}, {23809, 2, 0}, {23838, 3, 0},
+    {23868, 4, 0}, {23897, 5, 0}, {23926, 6, 0}, {23956, 7, 0}, {23985, 8, 0}, {24014, 9, 0},
+    {24044, 10, 0}, {24074, 11, 0}, {24103, 12, 0}, {24133, 1, 0}, {24163, 2, 0}, {24193, 3, 0},
+    {24222, 4, 0}, {24252, 5, 0}, {24281, 6, 0}, {24310, 6, 1}, {24340, 7, 0}, {24369, 8, 0},
+    {24398, 9, 0}, {24428, 10, 0}, {24457, 11, 0}, {24487, 12, 0}, {24517, 1, 0}, {24547, 2, 0},
+    {24577, 3, 0}, {24606, 4, 0}, {24636, 5, 0}, {24665, 6, 0}, {24694, 7, 0}, {24724, 8, 0},
+    {24753, 9, 0}, {24782, 10, 0}, {24812, 11, 0}, {24841, 12, 0}, {24871, 1, 0}, {24901, 2, 0},
+    {24931, 3, 0}, {24960, 4, 0}, {24990, 5, 0}, {25019, 6, 0}, {25049, 7, 0}, {25078, 8, 0},
+    {25108, 9, 0}, {25137, 10, 0}, {25166, 11, 0}, {25196, 12, 0}, {25225, 1, 0}, {25255, 2, 0},
+    {25285, 3, 0}, {25314, 4, 0}, {25344, 5, 0}, {25374, 5, 1}, {25403, 6, 0}, {25433, 7, 0},
+    {25462, 8, 0}, {25492, 9, 0}, {25521, 10, 0}, {25551, 11, 0}, {25580, 12, 0}, {25609, 1, 0},
+    {25639, 2, 0}, {25668, 3, 0}, {25698, 4, 0}, {25728, 5, 0}, {25757, 6, 0}, {25787, 7, 0},
+    {25816, 8, 0}, {25846, 9, 0}, {25876, 10, 0}, {25905, 11, 0}, {25935, 12, 0}, {25964, 1, 0},
+    {25993, 2, 0}, {26023, 3, 0}, {26052, 4, 0}, {26082, 5, 0}, {26111, 6, 0}, {26141, 7, 0},
+    {26171, 8, 0}, {26200, 9, 0}, {26230, 10, 0}, {26260, 11, 0}, {26289, 12, 0}, {26319, 1, 0},
+    {26348, 2, 0}, {26378, 2, 1}, {26407, 3, 0}, {26436, 4, 0}, {26466, 5, 0}, {26495, 6, 0},
+    {26525, 7, 0}, {26554, 8, 0}, {26584, 9, 0}, {26614, 10, 0}, {26643, 11, 0}, {26673, 12, 0},
+    {26703, 1, 0}, {26732, 2, 0}, {26762, 3, 0}, {26791, 4, 0}, {26820, 5, 0}, {26850, 6, 0},
+    {26879, 7, 0}, {26908, 8, 0}, {26938, 9, 0}, {26968, 10, 0}, {26997, 11, 0}, {27027, 12, 0},
+    {27057, 1, 0}, {27087, 2, 0}, {27116, 3, 0}, {27146, 4, 0}, {27175, 5, 0}, {27204, 6, 0},
+    {27234, 7, 0}, {27263, 7, 1}, {27292, 8, 0}, {27322, 9, 0}, {27351, 10, 0}, {27381, 11, 0},
+    {27411, 12, 0}, {27441, 1, 0}, {27471, 2, 0}, {27500, 3, 0}, {27530, 4, 0}, {27559, 5, 0},
+    {27588, 6, 0}, {27618, 7, 0}, {27647, 8, 0}, {27676, 9, 0}, {27706, 10, 0}, {27735, 11, 0},
+    {27765, 12, 0}, {27795, 1, 0}, {27825, 2, 0}, {27854, 3, 0}, {27884, 4, 0}, {27913, 5, 0},
+    {27943, 6, 0}, {27972, 7, 0}, {28002, 8, 0}, {28031, 9, 0}, {28060, 10, 0}, {28090, 11, 0},
+    {28119, 12, 0}, {28149, 1, 0}, {28179, 2, 0}, {28208, 3, 0}, {28238, 4, 0}, {28268, 5, 0},
+    {28297, 5, 1}, {28327, 6, 0}, {28356, 7, 0}, {28386, 8, 0}, {28415, 9, 0}, {28444, 10, 0},
+    {28474, 11, 0}, {28503, 12, 0}, {28533, 1, 0}, {28562, 2, 0}, {28592, 3, 0}, {28622, 4, 0},
+    {28651, 5, 0}, {28681, 6, 0}, {28711, 7, 0}, {28740, 8, 0}, {28770, 9, 0}, {28799, 10, 0},
+    {28828, 11, 0}, {28858, 12, 0}, {28887, 1, 0}, {28917, 2, 0}, {28946, 3, 0}, {28976, 4, 0},
+    {29005, 5, 0}, {29035, 6, 0}, {29065, 7, 0}, {29094, 8, 0}, {29124, 9, 0}, {29154, 10, 0},
+    {29183, 11, 0}, {29213, 12, 0}, {29242, 1, 0}, {29271, 2, 0}, {29301, 3, 0}, {29330, 3, 1},
+    {29360, 4, 0}, {29389, 5, 0}, {29419, 6, 0}, {29448, 7, 0}, {29478, 8, 0}, {29508, 9, 0},
+    {29537, 10, 0}, {29567, 11, 0}, {29597, 12, 0}, {29626, 1, 0}, {29656, 2, 0}, {29685, 3, 0},
+    {29714, 4, 0}, {29744, 5, 0}, {29773, 6, 0}, {29802, 7, 0}, {29832, 8, 0}, {29862, 9, 0},
+    {29891, 10, 0}, {29921, 11, 0}, {29951, 12, 0}, {29981, 1, 0}, {30010, 2, 0}, {30040, 3, 0},
+    {30069, 4, 0}, {30098, 5, 0}, {30128, 6, 0}, {30157, 7, 0}, {30186, 8, 0}, {30216, 8, 1},
+    {30245, 9, 0}, {30275, 10, 0}, {30305, 11, 0}, {30335, 12, 0}, {30365, 1, 0}, {30394, 2, 0},
+    {30424, 3, 0}, {30453, 4, 0}, {30482, 5, 0}, {30512, 6, 0}, {30541, 7, 0}, {30570, 8, 0},
+    {30600, 9, 0}, {30629, 10, 0}, {30659, 11, 0}, {30689, 12, 0}, {30719, 1, 0}, {30748, 2, 0},
+    {30778, 3, 0}, {30808, 4, 0}, {30837, 5, 0}, {30866, 6, 0}, {30896, 7, 0}, {30925, 8, 0},
+    {30954, 9, 0}, {30984, 10, 0}, {31013, 11, 0}, {31043, 12, 0}, {31073, 1, 0}, {31102, 2, 0},
+    {31132, 3, 0}, {31162, 4, 0}, {31191, 5, 0}, {31221, 6, 0}, {31250, 6, 1}, {31280, 7, 0},
+    {31309, 8, 0}, {31338, 9, 0}, {31368, 10, 0}, {31397, 11, 0}, {31427, 12, 0}, {31456, 1, 0},
+    {31486, 2, 0}, {31516, 3, 0}, {31546, 4, 0}, {31575, 5, 0}, {31605, 6, 0}, {31634, 7, 0},
+    {31664, 8, 0}, {31693, 9, 0}, {31722, 10, 0}, {31752, 11, 0}, {31781, 12, 0}, {31811, 1, 0},
+    {31840, 2, 0}, {31870, 3, 0}, {31900, 4, 0}, {31929, 5, 0}, {31959, 6, 0}, {31988, 7, 0},
+    {32018, 8, 0}, {32048, 9, 0}, {32077, 10, 0}, {32106, 11, 0}, {32136, 12, 0}, {32165, 1, 0},
+    {32195, 2, 0}, {32224, 3, 0}, {32254, 4, 0}, {32283, 4, 1}, {32313, 5, 0}, {32342, 6, 0},
+    {32372, 7, 0}, {32402, 8, 0}, {32431, 9, 0}, {32461, 10, 0}, {32491, 11, 0}, {32520, 12, 0},
+    {32549, 1, 0}, {32579, 2, 0}, {32608, 3, 0}, {32638, 4, 0}, {32667, 5, 0}, {32697, 6, 0},
+    {32726, 7, 0}, {32756, 8, 0}, {32785, 9, 0}, {32815, 10, 0}, {32845, 11, 0}, {32875, 12, 0},
+    {32904, 1, 0}, {32934, 2, 0}, {32963, 3, 0}, {32992, 4, 0}, {33022, 5, 0}, {33051, 6, 0},
+    {33080, 7, 0}, {33110, 8, 0}, {33139, 9, 0}, {33169, 10, 0}, {33199, 11, 0}, {33229, 12, 0},
+    {33258, 1, 0}, {33288, 2, 0}, {33318, 3, 0}, {33347, 3, 1}, {33376, 4, 0}, {33406, 5, 0},
+    {33435, 6, 0}, {33464, 7, 0}, {33494, 8, 0}, {33523, 9, 0}, {33553, 10, 0}, {33583, 11, 0},
+    {33613, 12, 0}, {33642, 1, 0}, {33672, 2, 0}, {33702, 3, 0}, {33731, 4, 0}, {33760, 5, 0},
+    {33790, 6, 0}, {33819, 7, 0}, {33848, 8, 0}, {33878, 9, 0}, {33907, 10, 0}, {33937, 11, 0},
+    {33967, 12, 0}, {33996, 1, 0}, {34026, 2, 0}, {34056, 3, 0}, {34085, 4, 0}, {34115, 5, 0},
+    {34144, 6, 0}, {34174, 7, 0}, {34203, 7, 1}, {34232, 8, 0}, {34262, 9, 0}, {34291, 10, 0},
+    {34321, 11, 0}, {34350, 12, 0}, {34380, 1, 0}, {34410, 2, 0}, {34440, 3, 0}, {34469, 4, 0},
+    {34499, 5, 0}, {34528, 6, 0}, {34558, 7, 0}, {34587, 8, 0}, {34616, 9, 0}, {34646, 10, 0},
+    {34675, 11, 0}, {34705, 12, 0}, {34734, 1, 0}, {34764, 2, 0}, {34794, 3, 0}, {34823, 4, 0},
+    {34853, 5, 0}, {34883, 6, 0}, {34912, 7, 0}, {34942, 8, 0}, {34971, 9, 0}, {35000, 10, 0},
+    {35030, 11, 0}, {35059, 12, 0}, {35089, 1, 0}, {35118, 2, 0}, {35148, 3, 0}, {35177, 4, 0},
+    {35207, 5, 0}, {35237, 5, 1}, {35266, 6, 0}, {35296, 7, 0}, {35325, 8, 0}, {35355, 9, 0},
+    {35384, 10, 0}, {35414, 11, 0}, {35443, 12, 0}, {35473, 1, 0}, {35502, 2, 0}, {35532, 3, 0},
+    {35561, 4, 0}, {35591, 5, 0}, {35620, 6, 0}, {35650, 7, 0}, {35680, 8, 0}, {35709, 9, 0},
+    {35739, 10, 0}, {35768, 11, 0}, {35798, 12, 0}, {35827, 1, 0}, {35857, 2, 0}, {35886, 3, 0},
+    {35916, 4, 0}, {35945, 5, 0}, {35974, 6, 0}, {36004, 7, 0}, {36034, 8, 0}, {36063, 9, 0},
+    {36093, 10, 0}, {36123, 11, 0}, {36152, 12, 0}, {36182, 1, 0}, {36211, 2, 0}, {36241, 3, 0},
+    {36270, 4, 0}, {36300, 4, 1}, {36329, 5, 0}, {36358, 6, 0}, {36388, 7, 0}, {36417, 8, 0},
+    {36447, 9, 0}, {36477, 10, 0}, {36507, 11, 0}, {36536, 12, 0}, {36566, 1, 0}, {36596, 2, 0},
+    {36625, 3, 0}, {36654, 4, 0}, {36684, 5, 0}, {36713, 6, 0}, {36742, 7, 0}, {36772, 8, 0},
+    {36801, 9, 0}, {36831, 10, 0}, {36861, 11, 0}, {36890, 12, 0}, {36920, 1, 0}, {36950, 2, 0},
+    {36979, 3, 0}, {37009, 4, 0}, {37038, 5, 0}, {37068, 6, 0}, {37097, 7, 0}, {37126, 8, 0},
+    {37156, 8, 1}, {37185, 9, 0}, {37215, 10, 0}, {37244, 11, 0}, {37274, 12, 0}, {37304, 1, 0},
+    {37334, 2, 0}, {37363, 3, 0}, {37393, 4, 0}, {37422, 5, 0}, {37452, 6, 0}, {37481, 7, 0},
+    {37510, 8, 0}, {37540, 9, 0}, {37569, 10, 0}, {37599, 11, 0}, {37628, 12, 0}, {37658, 1, 0},
+    {37688, 2, 0}, {37717, 3, 0}, {37747, 4, 0}, {37777, 5, 0}, {37806, 6, 0}, {37836, 7, 0},
+    {37865, 8, 0}, {37894, 9, 0}, {37924, 10, 0}, {37953, 11, 0}, {37983, 12, 0}, {38012, 1, 0},
+    {38042, 2, 0}, {38071, 3, 0}, {38101, 4, 0}, {38131, 5, 0}, {38160, 6, 0}, {38190, 6, 1},
+    {38219, 7, 0}, {38249, 8, 0}, {38278, 9, 0}, {38308, 10, 0}, {38337, 11, 0}, {38367, 12, 0},
+    {38396, 1, 0}, {38426, 2, 0}, {38455, 3, 0}, {38485, 4, 0}, {38514, 5, 0}, {38544, 6, 0},
+    {38574, 7, 0}, {38603, 8, 0}, {38633, 9, 0}, {38662, 10, 0}, {38692, 11, 0}, {38721, 12, 0},
+    {38751, 1, 0}, {38780, 2, 0}, {38810, 3, 0}, {38839, 4, 0}, {38869, 5, 0}, {38898, 6, 0},
+    {38928, 7, 0}, {38957, 8, 0}, {38987, 9, 0}, {39017, 10, 0}, {39046, 11, 0}, {39076, 12, 0},
+    {39105, 1, 0}, {39135, 2, 0}, {39164, 3, 0}, {39194, 4, 0}, {39223, 4, 1}, {39252, 5, 0},
+    {39282, 6, 0}, {39311, 7, 0}, {39341, 8, 0}, {39371, 9, 0}, {39401, 10, 0}, {39430, 11, 0},
+    {39460, 12, 0}, {39489, 1, 0}, {39519, 2, 0}, {39548, 3, 0}, {39578, 4, 0}, {39607, 5, 0},
+    {39636, 6, 0}, {39666, 7, 0}, {39695, 8, 0}, {39725, 9, 0}, {39755, 10, 0}, {39784, 11, 0},
+    {39814, 12, 0}, {39844, 1, 0}, {39873, 2, 0}, {39903, 3, 0}, {39932, 4, 0}, {39962, 5, 0},
+    {39991, 6, 0}, {40020, 7, 0}, {40050, 8, 0}, {40079, 9, 0}, {40109, 10, 0}, {40138, 11, 0},
+    {40168, 12, 0}, {40198, 1, 0}, {40228, 2, 0}, {40257, 3, 0}, {40287, 3, 1}, {40316, 4, 0},
+    {40346, 5, 0}, {40375, 6, 0}, {40404, 7, 0}, {40434, 8, 0}, {40463, 9, 0}, {40492, 10, 0},
+    {40522, 11, 0}, {40552, 12, 0}, {40582, 1, 0}, {40611, 2, 0}, {40641, 3, 0}, {40671, 4, 0},
+    {40700, 5, 0}, {40730, 6, 0}, {40759, 7, 0}, {40788, 8, 0}, {40818, 9, 0}, {40847, 10, 0},
+    {40876, 11, 0}, {40906, 12, 0}, {40936, 1, 0}, {40965, 2, 0}, {40995, 3, 0}, {41025, 4, 0},
+    {41055, 5, 0}, {41084, 6, 0}, {41113, 7, 0}, {41143, 7, 1}, {41172, 8, 0}, {41202, 9, 0},
+    {41231, 10, 0}, {41260, 11, 0}, {41290, 12, 0}, {41320, 1, 0}, {41349, 2, 0}, {41379, 3, 0},
+    {41409, 4, 0}, {41438, 5, 0}, {41468, 6, 0}, {41497, 7, 0}, {41527, 8, 0}, {41556, 9, 0},
+    {41586, 10, 0}, {41615, 11, 0}, {41645, 12, 0}, {41674, 1, 0}, {41704, 2, 0}, {41733, 3, 0},
+    {41763, 4, 0}, {41792, 5, 0}, {41822, 6, 0}, {41852, 7, 0}, {41881, 8, 0}, {41911, 9, 0},
+    {41940, 10, 0}, {41970, 11, 0}, {41999, 12, 0}, {42029, 1, 0}, {42058, 2, 0}, {42088, 3, 0},
+    {42117, 4, 0}, {42146, 5, 0}, {42176, 5, 1}, {42206, 6, 0}, {42235, 7, 0}, {42265, 8, 0},
+    {42295, 9, 0}, {42324, 10, 0}, {42354, 11, 0}, {42383, 12, 0}, {42413, 1, 0}, {42442, 2, 0},
+    {42472, 3, 0}, {42501, 4, 0}, {42530, 5, 0}, {42560, 6, 0}, {42589, 7, 0}, {42619, 8, 0},
+    {42649, 9, 0}, {42678, 10, 0}, {42708, 11, 0}, {42738, 12, 0}, {42767, 1, 0}, {42797, 2, 0},
+    {42826, 3, 0}, {42856, 4, 0}, {42885, 5, 0}, {42914, 6, 0}, {42944, 7, 0}, {42973, 8, 0},
+    {43003, 9, 0}, {43032, 10, 0}, {43062, 11, 0}, {43092, 12, 0}, {43122, 1, 0}, {43151, 2, 0},
+    {43181, 3, 0}, {43210, 4, 0}, {43240, 4, 1}, {43269, 5, 0}, {43298, 6, 0}, {43328, 7, 0},
+    {43357, 8, 0}, {43386, 9, 0}, {43416, 10, 0}, {43446, 11, 0}, {43476, 12, 0}, {43505, 1, 0},
+    {43535, 2, 0}, {43565, 3, 0}, {43594, 4, 0}, {43624, 5, 0}, {43653, 6, 0}, {43682, 7, 0},
+    {43711, 8, 0}, {43741, 9, 0}, {43770, 10, 0}, {43800, 11, 0}, {43830, 12, 0}, {43859, 1, 0},
+    {43889, 2, 0}, {43919, 3, 0}, {43949, 4, 0}, {43978, 5, 0}, {44008, 6, 0}, {44037, 7, 0},
+    {44066, 8, 0}, {44096, 8, 1}, {44125, 9, 0}, {44154, 10, 0}, {44184, 11, 0}, {44214, 12, 0},
+    {44243, 1, 0}, {44273, 2, 0}, {44303, 3, 0}, {44332, 4, 0}, {44362, 5, 0}, {44391, 6, 0},
+    {44421, 7, 0}, {44450, 8, 0}, {44480, 9, 0}, {44509, 10, 0}, {44538, 11, 0}, {44568, 12, 0},
+    {44597, 1, 0}, {44627, 2, 0}, {44657, 3, 0}, {44686, 4, 0}, {44716, 5, 0}, {44746, 6, 0},
+    {44775, 7, 0}, {44805, 8, 0}, {44834, 9, 0}, {44864, 10, 0}, {44893, 11, 0}, {44923, 12, 0},
+    {44952, 1, 0}, {44981, 2, 0}, {45011, 3, 0}, {45041, 4, 0}, {45070, 5, 0}, {45100, 6, 0},
+    {45129, 6, 1}, {45159, 7, 0}, {45189, 8, 0}, {45218, 9, 0}, {45248, 10, 0}, {45277, 11, 0},
+    {45307, 12, 0}, {45336, 1, 0}, {45365, 2, 0}, {45395, 3, 0}, {45424, 4, 0}, {45454, 5, 0},
+    {45483, 6, 0}, {45513, 7, 0}, {45543, 8, 0}, {45572, 9, 0}, {45602, 10, 0}, {45632, 11, 0},
+    {45661, 12, 0}, {45691, 1, 0}, {45720, 2, 0}, {45750, 3, 0}, {45779, 4, 0}, {45808, 5, 0},
+    {45838, 6, 0}, {45867, 7, 0}, {45897, 8, 0}, {45926, 9, 0}, {45956, 10, 0}, {45986, 11, 0},
+    {46016, 12, 0}, {46045, 1, 0}, {46075, 2, 0}, {46104, 3, 0}, {46134, 4, 0}, {46163, 4, 1},
+    {46192, 5, 0}, {46222, 6, 0}, {46251, 7, 0}, {46280, 8, 0}, {46310, 9, 0}, {46340, 10, 0},
+    {46370, 11, 0}, {46399, 12, 0}, {46429, 1, 0}, {46459, 2, 0}, {46488, 3, 0}, {46518, 4, 0},
+    {46547, 5, 0}, {46576, 6, 0}, {46605, 7, 0}, {46635, 8, 0}, {46664, 9, 0}, {46694, 10, 0},
+    {46724, 11, 0}, {46753, 12, 0}, {46783, 1, 0}, {46813, 2, 0}, {46843, 3, 0}, {46872, 4, 0},
+    {46902, 5, 0}, {46931, 6, 0}, {46960, 7, 0}, {46989, 8, 0}, {47019, 9, 0}, {47048, 10, 0},
+    {47078, 11, 0}, {47107, 12, 0}, {47137, 1, 0}, {47167, 2, 0}, {47197, 2, 1}, {47226, 3, 0},
+    {47256, 4, 0}, {47286, 5, 0}, {47315, 6, 0}, {47344, 7, 0}, {47374, 8, 0}, {47403, 9, 0},
+    {47432, 10, 0}, {47462, 11, 0}, {47491, 12, 0}, {47521, 1, 0}, {47551, 2, 0}, {47581, 3, 0},
+    {47610, 4, 0}, {47640, 5, 0}, {47669, 6, 0}, {47699, 7, 0}, {47728, 8, 0}, {47758, 9, 0},
+    {47787, 10, 0}, {47816, 11, 0}, {47846, 12, 0}, {47875, 1, 0}, {47905, 2, 0},
+};
@@ -0,0 +1,162 @@
+// 農曆查表的完整驗證
+//
+// 以 ICU 中國曆逐日產生的參考資料（lunar_reference.h，由 gen_lunar_reference.js 產生）為準，
+// 對查表涵蓋的每一天比對 lunar_from_gregorian 的月、日與閏月，並確認範圍外的日期回傳 false；
+// 再開啟農曆模式，比對數個已知日期於日期列各格顯示的字形，以及切回公曆後「日」重新出現。
+//
+// 用法：lunar_test（全部通過時回傳 0）
+#define main ccwatchface_main
+#include "../../src/c/ccwatchface.c"
+#undef main
+
+#include "host.h"
+#include "lunar_reference.h"
+
+#include <stdarg.h>
+
+#define SECONDS_PER_DAY 86400
+
+static int s_checks;
+static int s_failures;
+
+static void fail(const char *format, ...) {
+    if (s_failures++ >= 20) return;
+    va_list args;
+    va_start(args, format);
+    fprintf(stderr, "  ");
+    vfprintf(stderr, format, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+}
+
+static struct tm tm_for_epoch_day(int32_t epoch_day) {
+    time_t t = (time_t)epoch_day * SECONDS_PER_DAY;
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    return tm;
+}
+
+// ==================== 逐日比對 ====================
+
+static void check_every_day(void) {
+    const size_t count = ARRAY_LENGTH(LUNAR_REFERENCE);
+    size_t month = 0;
+
+    for (int32_t day = LUNAR_REFERENCE[0].epoch_day; day < LUNAR_REFERENCE[count - 1].epoch_day; day++) {
+        while (month + 1 < count && LUNAR_REFERENCE[month + 1].epoch_day <= day) month++;
+
+        struct tm tm = tm_for_epoch_day(day);
+        int year = tm.tm_year + 1900;
+        LunarDate lunar;
+        bool found = lunar_from_gregorian(year, tm.tm_yday, &lunar);
+        s_checks++;
+
+        // 查表從 1900 年正月初一起，至公曆 2100 年底止
+        bool covered = day >= LUNAR_REFERENCE[1].epoch_day && year <= LUNAR_LAST_YEAR;
+        if (!covered) {
+            if (found) fail("%d day %d: outside the table but converted", year, tm.tm_yday + 1);
+            continue;
+        }
+        if (!found) {
+            fail("%d day %d: not converted", year, tm.tm_yday + 1);
+            continue;
+        }
+
+        const LunarMonthStart *expected = &LUNAR_REFERENCE[month];
+        int expected_day = day - expected->epoch_day + 1;
+        if (lunar.month != expected->month || lunar.leap != expected->leap || lunar.day != expected_day) {
+            fail("%d day %d: got month %d leap %d day %d, expected month %d leap %d day %d",
+                 year, tm.tm_yday + 1, lunar.month, lunar.leap, lunar.day,
+                 expected->month, expected->leap, expected_day);
+        }
+    }
+}
+
+// ==================== 日期列字形 ====================
+
+typedef struct {
+    int year, month, mday;          // 公曆
+    GlyphId cells[5];               // 月十位、月個位、日十位、日個位、星期
+} LunarDisplayCase;
+
+static const LunarDisplayCase DISPLAY_CASES[] = {
+    {2024, 2, 10, {GLYPH_NONE, GLYPH_SZHENG, GLYPH_CHU, GLYPH_SL1, GLYPH_SL6}},     // 正月初一
+    {2023, 3, 22, {GLYPH_RUN, GLYPH_SL2, GLYPH_CHU, GLYPH_SL1, GLYPH_SL3}},        // 閏二月初一
+    {1984, 2, 2, {GLYPH_NONE, GLYPH_SZHENG, GLYPH_CHU, GLYPH_SL1, GLYPH_SL4}},     // 正月初一
+    {2033, 12, 22, {GLYPH_RUN, GLYPH_DONG, GLYPH_CHU, GLYPH_SL1, GLYPH_SL4}},      // 閏冬月初一
+    {2025, 10, 6, {GLYPH_NONE, GLYPH_SL8, GLYPH_SL10, GLYPH_SL5, GLYPH_SL1}},      // 八月十五
+    {2026, 2, 7, {GLYPH_NONE, GLYPH_LA, GLYPH_SL2, GLYPH_SL10, GLYPH_SL6}},        // 臘月二十
+    {2026, 2, 16, {GLYPH_NONE, GLYPH_LA, GLYPH_SL20, GLYPH_SL9, GLYPH_SL1}},       // 臘月廿九
+    {2026, 1, 18, {GLYPH_NONE, GLYPH_DONG, GLYPH_SL3, GLYPH_SL10, GLYPH_RI}},      // 冬月三十
+    {2026, 10, 17, {GLYPH_NONE, GLYPH_SL9, GLYPH_CHU, GLYPH_SL8, GLYPH_SL6}},      // 九月初八
+    {2026, 11, 1, {GLYPH_NONE, GLYPH_SL9, GLYPH_SL20, GLYPH_SL3, GLYPH_RI}},       // 九月廿三
+};
+
+static DisplayLayer *const DATE_ROW_CELLS[] = {
+    &s_app.month_layers[0], &s_app.month_layers[1], &s_app.day_layers[0], &s_app.day_layers[1],
+    &s_app.week_layer,
+};
+
+static struct tm tm_for_date(int year, int month, int mday) {
+    struct tm tm = {.tm_year = year - 1900, .tm_mon = month - 1, .tm_mday = mday};
+    time_t t = timegm(&tm);
+    gmtime_r(&t, &tm);
+    return tm;
+}
+
+static void set_lunar_date(bool enabled) {
+    const uint32_t keys[] = {KEY_LUNAR_DATE};
+    const int32_t values[] = {enabled};
+    host_deliver_message(keys, values, ARRAY_LENGTH(keys));
+    host_run_until_idle();
+}
+
+static void check_display(void) {
+    set_lunar_date(true);
+    for (size_t i = 0; i < ARRAY_LENGTH(DISPLAY_CASES); i++) {
+        const LunarDisplayCase *c = &DISPLAY_CASES[i];
+        struct tm tm = tm_for_date(c->year, c->month, c->mday);
+        update_date_display(&tm);
+
+        for (size_t cell = 0; cell < ARRAY_LENGTH(DATE_ROW_CELLS); cell++) {
+            s_checks++;
+            if (DATE_ROW_CELLS[cell]->current_glyph != c->cells[cell]) {
+                fail("%d-%02d-%02d cell %d: got %d, expected %d", c->year, c->month, c->mday, (int)cell,
+                     (int)DATE_ROW_CELLS[cell]->current_glyph, (int)c->cells[cell]);
+            }
+        }
+        s_checks++;
+        if (s_app.ri_layer.current_glyph != GLYPH_NONE) {
+            fail("%d-%02d-%02d: 日 still shown", c->year, c->month, c->mday);
+        }
+    }
+
+    // 切回公曆：日期列立即改為公曆並重新顯示「日」
+    struct tm tm = tm_for_date(2026, 10, 17);
+    host_set_time(timegm(&tm));
+    set_lunar_date(false);
+    s_checks += 2;
+    if (s_app.ri_layer.current_glyph != GLYPH_RI) fail("gregorian: 日 hidden");
+    if (s_app.month_layers[1].current_glyph != MONTH_GLYPHS[10][1]) {
+        fail("gregorian: month cell %d, expected %d", (int)s_app.month_layers[1].current_glyph,
+             (int)MONTH_GLYPHS[10][1]);
+    }
+}
+
+int main(void) {
+    check_every_day();
+
+    host_persist_clear();
+    host_reset();
+    host_set_time(0);
+    // 關閉動畫，讓每次更新立即生效
+    persist_write_bool(KEY_ANIMATION_ENABLED, false);
+
+    app_init();
+    host_run_until_idle();
+    check_display();
+    app_deinit();
+
+    printf("lunar: %d checks, %d failures\n", s_checks, s_failures);
+    return s_failures ? 1 : 0;
+}
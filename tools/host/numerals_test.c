@@ -0,0 +1,169 @@
+// 中文數字查表的完整驗證
+//
+// 以查表化之前 update_time_display / update_date_display 的手寫規則作為參考實作，
+// 對 12/24 小時制一天中的每一分鐘、每個月與日、每個星期，比對錶盤實際顯示於各格子的字形。
+//
+// 用法：numerals_test（全部通過時回傳 0）
+#define main ccwatchface_main
+#include "../../src/c/ccwatchface.c"
+#undef main
+
+#include "host.h"
+
+// ==================== 參考實作 ====================
+
+static const GlyphId REF_TIME_UPPERCASE_TENS[] = {
+    GLYPH_NONE, GLYPH_U10, GLYPH_U2,
+};
+
+static const GlyphId REF_TIME_UPPERCASE_ONES[] = {
+    GLYPH_U10, GLYPH_U1, GLYPH_U2, GLYPH_U3, GLYPH_U4,
+    GLYPH_U5, GLYPH_U6, GLYPH_U7, GLYPH_U8, GLYPH_U9
+};
+
+static const GlyphId REF_TIME_LOWERCASE_TENS[] = {
+    GLYPH_L0, GLYPH_L10, GLYPH_L20, GLYPH_L30, GLYPH_L4, GLYPH_L5,
+};
+
+static const GlyphId REF_TIME_LOWERCASE_ONES[] = {
+    GLYPH_L10, GLYPH_L1, GLYPH_L2, GLYPH_L3, GLYPH_L4,
+    GLYPH_L5, GLYPH_L6, GLYPH_L7, GLYPH_L8, GLYPH_L9
+};
+
+static const GlyphId REF_DATE_UPPERCASE_ONES[] = {
+    GLYPH_SU10, GLYPH_SU1, GLYPH_SU2, GLYPH_SU3, GLYPH_SU4,
+    GLYPH_SU5, GLYPH_SU6, GLYPH_SU7, GLYPH_SU8, GLYPH_SU9
+};
+
+static const GlyphId REF_DATE_LOWERCASE_TENS[] = {
+    GLYPH_NONE, GLYPH_SL10, GLYPH_SL20, GLYPH_SL30,
+};
+
+static const GlyphId REF_DATE_LOWERCASE_ONES[] = {
+    GLYPH_SL10, GLYPH_SL1, GLYPH_SL2, GLYPH_SL3, GLYPH_SL4,
+    GLYPH_SL5, GLYPH_SL6, GLYPH_SL7, GLYPH_SL8, GLYPH_SL9,
+};
+
+// out：時十位、時個位、分十位、分個位
+static void reference_time(int tm_hour, int tm_min, bool is_24h, GlyphId out[4]) {
+    int hour = tm_hour;
+    if (!is_24h) {
+        hour = hour % 12;
+        if (hour == 0) hour = 12;
+    }
+
+    out[0] = (hour == 10) ? GLYPH_NONE : REF_TIME_UPPERCASE_TENS[hour / 10];
+    out[1] = (hour == 0) ? GLYPH_U0 : REF_TIME_UPPERCASE_ONES[hour % 10];
+
+    if (tm_min == 0) {
+        out[2] = GLYPH_DIAN;
+        out[3] = GLYPH_ZHENG;
+    } else if (tm_min == 30) {
+        out[2] = GLYPH_DIAN;
+        out[3] = GLYPH_BAN;
+    } else if (tm_min == 10) {
+        out[2] = GLYPH_L1;
+        out[3] = GLYPH_L0;
+    } else {
+        int m1 = tm_min / 10;
+        int m2 = tm_min % 10;
+        out[2] = (m2 == 0) ? REF_TIME_LOWERCASE_ONES[m1] : REF_TIME_LOWERCASE_TENS[m1];
+        out[3] = REF_TIME_LOWERCASE_ONES[m2];
+    }
+}
+
+// out：月十位、月個位、日十位、日個位、星期
+static void reference_date(int tm_mon, int tm_mday, int tm_wday, GlyphId out[5]) {
+    int month = tm_mon + 1;
+    out[0] = (month > 10) ? GLYPH_SU10 : GLYPH_NONE;
+    out[1] = REF_DATE_UPPERCASE_ONES[month % 10];
+
+    int d1 = tm_mday / 10;
+    int d2 = tm_mday % 10;
+    out[2] = GLYPH_NONE;
+    out[3] = REF_DATE_LOWERCASE_ONES[d2];
+    if (tm_mday > 10) {
+        out[2] = (d2 == 0) ? REF_DATE_LOWERCASE_ONES[d1] : REF_DATE_LOWERCASE_TENS[d1];
+    }
+
+    out[4] = (tm_wday == 0) ? GLYPH_RI : REF_DATE_LOWERCASE_ONES[tm_wday];
+}
+
+// ==================== 比對 ====================
+
+static int s_checks;
+static int s_failures;
+
+static void expect_cells(const char *label, DisplayLayer *const *cells, const GlyphId *expected, int count) {
+    for (int i = 0; i < count; i++) {
+        s_checks++;
+        if (cells[i]->current_glyph != expected[i]) {
+            if (s_failures++ < 20) {
+                fprintf(stderr, "  %s cell %d: got %d, expected %d\n",
+                        label, i, (int)cells[i]->current_glyph, (int)expected[i]);
+            }
+        }
+    }
+}
+
+static void check_every_minute(bool is_24h) {
+    DisplayLayer *const cells[] = {
+        &s_app.hour_layers[0], &s_app.hour_layers[1], &s_app.minute_layers[0], &s_app.minute_layers[1],
+    };
+    host_set_24h_style(is_24h);
+
+    for (int hour = 0; hour < 24; hour++) {
+        for (int minute = 0; minute < 60; minute++) {
+            struct tm t = {.tm_hour = hour, .tm_min = minute};
+            update_time_display(&t);
+
+            GlyphId expected[4];
+            reference_time(hour, minute, is_24h, expected);
+            char label[32];
+            snprintf(label, sizeof(label), "%s %02d:%02d", is_24h ? "24h" : "12h", hour, minute);
+            expect_cells(label, cells, expected, 4);
+        }
+    }
+}
+
+static void check_every_date(void) {
+    DisplayLayer *const cells[] = {
+        &s_app.month_layers[0], &s_app.month_layers[1], &s_app.day_layers[0], &s_app.day_layers[1],
+        &s_app.week_layer,
+    };
+
+    for (int mon = 0; mon < 12; mon++) {
+        for (int mday = 1; mday <= 31; mday++) {
+            for (int wday = 0; wday < 7; wday++) {
+                struct tm t = {.tm_mon = mon, .tm_mday = mday, .tm_wday = wday};
+                update_date_display(&t);
+
+                GlyphId expected[5];
+                reference_date(mon, mday, wday, expected);
+                char label[32];
+                snprintf(label, sizeof(label), "%02d-%02d wday %d", mon + 1, mday, wday);
+                expect_cells(label, cells, expected, 5);
+            }
+        }
+    }
+}
+
+int main(void) {
+    host_persist_clear();
+    host_reset();
+    host_set_time(0);
+    // 關閉動畫，讓每次更新立即生效
+    persist_write_bool(KEY_ANIMATION_ENABLED, false);
+
+    app_init();
+    host_run_until_idle();
+
+    check_every_minute(false);
+    check_every_minute(true);
+    check_every_date();
+
+    app_deinit();
+
+    printf("numerals: %d checks, %d failures\n", s_checks, s_failures);
+    return s_failures ? 1 : 0;
+}
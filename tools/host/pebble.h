@@ -0,0 +1,547 @@
+// 主機端 pebble.h 替身
+//
+// 只涵蓋 src/c 實際使用到的 Pebble SDK 介面，讓錶盤原始碼不經修改即可在 Linux 上編譯。
+// 型別與常數盡量貼近 SDK 3.x 的定義；行為由 host_pebble.c 以軟體模擬，
+// 並在 host.h 的 HostCounters 中記錄資源載入、配置、動畫與重繪次數供基準測試使用。
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "resource_ids.auto.h"
+
+// ==================== 平台巨集 ====================
+
+#if defined(PBL_PLATFORM_APLITE) || defined(PBL_PLATFORM_DIORITE)
+    #define PBL_BW
+#else
+    #define PBL_COLOR
+#endif
+#define PBL_RECT
+
+#if defined(PBL_COLOR)
+    #define PBL_IF_COLOR_ELSE(if_true, if_false) (if_true)
+    #define PBL_IF_BW_ELSE(if_true, if_false) (if_false)
+#else
+    #define PBL_IF_COLOR_ELSE(if_true, if_false) (if_false)
+    #define PBL_IF_BW_ELSE(if_true, if_false) (if_true)
+#endif
+
+#define ARRAY_LENGTH(array) (sizeof((array)) / sizeof((array)[0]))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+// ==================== 日誌 ====================
+
+typedef enum {
+    APP_LOG_LEVEL_ERROR = 1,
+    APP_LOG_LEVEL_WARNING = 50,
+    APP_LOG_LEVEL_INFO = 100,
+    APP_LOG_LEVEL_DEBUG = 200,
+    APP_LOG_LEVEL_DEBUG_VERBOSE = 255,
+} AppLogLevel;
+
+void app_log(uint8_t log_level, const char *src_filename, int src_line_number, const char *fmt, ...);
+#define APP_LOG(level, fmt, ...) app_log(level, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
+
+// ==================== 堆積 ====================
+//
+// 錶盤程式碼中的 malloc/free 一律導向受追蹤的配置器，以便統計配置量與峰值。
+
+void *host_malloc(size_t size);
+void *host_calloc(size_t count, size_t size);
+void host_free(void *ptr);
+#define malloc(size) host_malloc(size)
+#define calloc(count, size) host_calloc(count, size)
+#define free(ptr) host_free(ptr)
+
+size_t heap_bytes_used(void);
+size_t heap_bytes_free(void);
+
+// ==================== 幾何與色彩 ====================
+
+typedef struct GPoint {
+    int16_t x;
+    int16_t y;
+} GPoint;
+
+typedef struct GSize {
+    int16_t w;
+    int16_t h;
+} GSize;
+
+typedef struct GRect {
+    GPoint origin;
+    GSize size;
+} GRect;
+
+// 屬性動畫的存取函式型別，須在 GRect() 巨集之前宣告
+typedef void (*GRectSetter)(void *subject, GRect grect);
+typedef GRect (*GRectGetter)(void *subject);
+
+#define GPoint(x, y) ((GPoint){(x), (y)})
+#define GPointZero GPoint(0, 0)
+#define GSize(w, h) ((GSize){(w), (h)})
+#define GSizeZero GSize(0, 0)
+#define GRect(x, y, w, h) ((GRect){{(x), (y)}, {(w), (h)}})
+#define GRectZero GRect(0, 0, 0, 0)
+
+bool grect_equal(const GRect *rect_a, const GRect *rect_b);
+bool grect_is_empty(const GRect *const rect);
+void grect_clip(GRect *const rect_to_clip, const GRect *const rect_clipper);
+bool gpoint_equal(const GPoint *point_a, const GPoint *point_b);
+
+typedef union GColor8 {
+    uint8_t argb;
+    struct {
+        uint8_t b:2;
+        uint8_t g:2;
+        uint8_t r:2;
+        uint8_t a:2;
+    };
+} GColor8;
+
+typedef GColor8 GColor;
+
+#define GColorARGB8(argb_value) ((GColor8){.argb = (argb_value)})
+#define GColorFromRGBA(r, g, b, a) \
+    GColorARGB8((uint8_t)((((a) >> 6) << 6) | (((r) >> 6) << 4) | (((g) >> 6) << 2) | ((b) >> 6)))
+#define GColorFromRGB(r, g, b) GColorFromRGBA((r), (g), (b), 255)
+#define GColorFromHEX(v) GColorFromRGB(((v) >> 16) & 0xff, ((v) >> 8) & 0xff, ((v) & 0xff))
+
+#define GColorClear GColorARGB8(0x00)
+#define GColorBlack GColorARGB8(0xC0)
+#define GColorWhite GColorARGB8(0xFF)
+#define GColorRed GColorARGB8(0xF0)
+#define GColorChromeYellow GColorARGB8(0xF8)
+#define GColorDarkGray GColorARGB8(0xD5)
+#define GColorLightGray GColorARGB8(0xEA)
+
+bool gcolor_equal(GColor8 x, GColor8 y);
+
+// ==================== 點陣圖 ====================
+
+typedef enum GBitmapFormat {
+    GBitmapFormat1Bit = 0,
+    GBitmapFormat8Bit,
+    GBitmapFormat1BitPalette,
+    GBitmapFormat2BitPalette,
+    GBitmapFormat4BitPalette,
+    GBitmapFormat8BitCircular,
+} GBitmapFormat;
+
+typedef struct GBitmap GBitmap;
+
+GBitmap *gbitmap_create_with_resource(uint32_t resource_id);
+GBitmap *gbitmap_create_as_sub_bitmap(const GBitmap *base_bitmap, GRect sub_rect);
+GBitmap *gbitmap_create_blank(GSize size, GBitmapFormat format);
+GBitmap *gbitmap_create_blank_with_palette(GSize size, GBitmapFormat format, GColor *palette,
+                                           bool free_on_destroy);
+void gbitmap_destroy(GBitmap *bitmap);
+GBitmapFormat gbitmap_get_format(const GBitmap *bitmap);
+GColor *gbitmap_get_palette(const GBitmap *bitmap);
+void gbitmap_set_palette(GBitmap *bitmap, GColor *palette, bool free_on_destroy);
+GRect gbitmap_get_bounds(const GBitmap *bitmap);
+void gbitmap_set_bounds(GBitmap *bitmap, GRect bounds);
+uint16_t gbitmap_get_bytes_per_row(const GBitmap *bitmap);
+uint8_t *gbitmap_get_data(const GBitmap *bitmap);
+
+// ==================== 資源 ====================
+
+typedef const void *ResHandle;
+
+ResHandle resource_get_handle(uint32_t resource_id);
+size_t resource_size(ResHandle h);
+size_t resource_load(ResHandle h, uint8_t *buffer, size_t max_length);
+size_t resource_load_byte_range(ResHandle h, uint32_t start_offset, uint8_t *buffer, size_t num_bytes);
+
+// ==================== 圖層與視窗 ====================
+
+typedef struct Layer Layer;
+typedef struct BitmapLayer BitmapLayer;
+typedef struct Window Window;
+typedef struct GContext GContext;
+
+typedef void (*LayerUpdateProc)(Layer *layer, GContext *ctx);
+
+Layer *layer_create(GRect frame);
+Layer *layer_create_with_data(GRect frame, size_t data_size);
+void layer_destroy(Layer *layer);
+void *layer_get_data(const Layer *layer);
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc);
+void layer_mark_dirty(Layer *layer);
+void layer_set_frame(Layer *layer, GRect frame);
+GRect layer_get_frame(const Layer *layer);
+void layer_set_bounds(Layer *layer, GRect bounds);
+GRect layer_get_bounds(const Layer *layer);
+void layer_set_hidden(Layer *layer, bool hidden);
+bool layer_get_hidden(const Layer *layer);
+void layer_add_child(Layer *parent, Layer *child);
+void layer_remove_from_parent(Layer *child);
+
+typedef enum {
+    GCompOpAssign,
+    GCompOpAssignInverted,
+    GCompOpOr,
+    GCompOpAnd,
+    GCompOpClear,
+    GCompOpSet,
+} GCompOp;
+
+typedef enum {
+    GAlignCenter,
+    GAlignTopLeft,
+    GAlignTopRight,
+    GAlignTop,
+    GAlignLeft,
+    GAlignBottom,
+    GAlignRight,
+    GAlignBottomRight,
+    GAlignBottomLeft,
+} GAlign;
+
+BitmapLayer *bitmap_layer_create(GRect frame);
+void bitmap_layer_destroy(BitmapLayer *bitmap_layer);
+Layer *bitmap_layer_get_layer(const BitmapLayer *bitmap_layer);
+void bitmap_layer_set_bitmap(BitmapLayer *bitmap_layer, const GBitmap *bitmap);
+void bitmap_layer_set_background_color(BitmapLayer *bitmap_layer, GColor color);
+void bitmap_layer_set_compositing_mode(BitmapLayer *bitmap_layer, GCompOp mode);
+void bitmap_layer_set_alignment(BitmapLayer *bitmap_layer, GAlign alignment);
+
+typedef void (*WindowHandler)(Window *window);
+
+typedef struct WindowHandlers {
+    WindowHandler load;
+    WindowHandler appear;
+    WindowHandler disappear;
+    WindowHandler unload;
+} WindowHandlers;
+
+Window *window_create(void);
+void window_destroy(Window *window);
+void window_set_window_handlers(Window *window, WindowHandlers handlers);
+void window_set_background_color(Window *window, GColor background_color);
+Layer *window_get_root_layer(const Window *window);
+void window_stack_push(Window *window, bool animated);
+
+// ==================== 繪圖 ====================
+
+typedef enum {
+    GCornerNone = 0,
+    GCornerTopLeft = 1 << 0,
+    GCornerTopRight = 1 << 1,
+    GCornerBottomLeft = 1 << 2,
+    GCornerBottomRight = 1 << 3,
+    GCornersAll = GCornerTopLeft | GCornerTopRight | GCornerBottomLeft | GCornerBottomRight,
+} GCornerMask;
+
+void graphics_context_set_fill_color(GContext *ctx, GColor color);
+void graphics_context_set_compositing_mode(GContext *ctx, GCompOp mode);
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask);
+void graphics_draw_bitmap_in_rect(GContext *ctx, const GBitmap *bitmap, GRect rect);
+
+// 直接存取畫面：彩色平台為 GBitmapFormat8Bit，黑白平台為 GBitmapFormat1Bit（LSB 在前，每列 4 bytes 對齊）。
+// 擷取期間不可呼叫其他 graphics_* 繪圖函式
+GBitmap *graphics_capture_frame_buffer(GContext *ctx);
+bool graphics_release_frame_buffer(GContext *ctx, GBitmap *buffer);
+
+// 文字：僅供 PERF_COUNTERS 的除錯覆蓋層使用，模擬環境不繪製字型
+typedef struct HostFont *GFont;
+
+typedef enum {
+    GTextOverflowModeWordWrap,
+    GTextOverflowModeTrailingEllipsis,
+    GTextOverflowModeFill,
+} GTextOverflowMode;
+
+typedef enum {
+    GTextAlignmentLeft,
+    GTextAlignmentCenter,
+    GTextAlignmentRight,
+} GTextAlignment;
+
+typedef struct GTextAttributes GTextAttributes;
+
+#define FONT_KEY_GOTHIC_14 "RESOURCE_ID_GOTHIC_14"
+
+GFont fonts_get_system_font(const char *font_key);
+void graphics_context_set_text_color(GContext *ctx, GColor color);
+void graphics_draw_text(GContext *ctx, const char *text, const GFont font, const GRect box,
+                        const GTextOverflowMode overflow_mode, const GTextAlignment alignment,
+                        GTextAttributes *text_attributes);
+
+// ==================== 動畫 ====================
+
+typedef struct Animation Animation;
+typedef struct PropertyAnimation PropertyAnimation;
+
+typedef int32_t AnimationProgress;
+#define ANIMATION_NORMALIZED_MIN 0
+#define ANIMATION_NORMALIZED_MAX 65535
+
+typedef enum {
+    AnimationCurveLinear = 0,
+    AnimationCurveEaseIn = 1,
+    AnimationCurveEaseOut = 2,
+    AnimationCurveEaseInOut = 3,
+    AnimationCurveDefault = AnimationCurveEaseInOut,
+} AnimationCurve;
+
+typedef void (*AnimationStartedHandler)(Animation *animation, void *context);
+typedef void (*AnimationStoppedHandler)(Animation *animation, bool finished, void *context);
+
+typedef struct AnimationHandlers {
+    AnimationStartedHandler started;
+    AnimationStoppedHandler stopped;
+} AnimationHandlers;
+
+typedef void (*AnimationSetupImplementation)(Animation *animation);
+typedef void (*AnimationUpdateImplementation)(Animation *animation, const AnimationProgress progress);
+typedef void (*AnimationTeardownImplementation)(Animation *animation);
+
+typedef struct AnimationImplementation {
+    AnimationSetupImplementation setup;
+    AnimationUpdateImplementation update;
+    AnimationTeardownImplementation teardown;
+} AnimationImplementation;
+
+Animation *animation_create(void);
+bool animation_destroy(Animation *animation);
+bool animation_set_duration(Animation *animation, uint32_t duration_ms);
+bool animation_set_delay(Animation *animation, uint32_t delay_ms);
+bool animation_set_curve(Animation *animation, AnimationCurve curve);
+bool animation_set_handlers(Animation *animation, AnimationHandlers callbacks, void *context);
+bool animation_set_implementation(Animation *animation, const AnimationImplementation *implementation);
+void *animation_get_context(Animation *animation);
+bool animation_schedule(Animation *animation);
+bool animation_unschedule(Animation *animation);
+bool animation_is_scheduled(Animation *animation);
+
+typedef struct PropertyAnimationAccessors {
+    union {
+        GRectSetter grect;
+    } setter;
+    union {
+        GRectGetter grect;
+    } getter;
+} PropertyAnimationAccessors;
+
+typedef struct PropertyAnimationImplementation {
+    AnimationImplementation base;
+    PropertyAnimationAccessors accessors;
+} PropertyAnimationImplementation;
+
+PropertyAnimation *property_animation_create(const PropertyAnimationImplementation *implementation,
+                                             void *subject, void *from_value, void *to_value);
+PropertyAnimation *property_animation_create_layer_frame(Layer *layer, GRect *from_frame, GRect *to_frame);
+void property_animation_update_grect(PropertyAnimation *property_animation, const uint32_t distance_normalized);
+void property_animation_destroy(PropertyAnimation *property_animation);
+Animation *property_animation_get_animation(PropertyAnimation *property_animation);
+
+// ==================== 計時器 ====================
+
+typedef struct AppTimer AppTimer;
+typedef void (*AppTimerCallback)(void *data);
+
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data);
+bool app_timer_reschedule(AppTimer *timer_handle, uint32_t new_timeout_ms);
+void app_timer_cancel(AppTimer *timer_handle);
+
+// ==================== 時間服務 ====================
+
+#define SECONDS_PER_MINUTE 60
+
+typedef enum {
+    SECOND_UNIT = 1 << 0,
+    MINUTE_UNIT = 1 << 1,
+    HOUR_UNIT = 1 << 2,
+    DAY_UNIT = 1 << 3,
+    MONTH_UNIT = 1 << 4,
+    YEAR_UNIT = 1 << 5,
+} TimeUnits;
+
+typedef void (*TickHandler)(struct tm *tick_time, TimeUnits units_changed);
+
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler);
+void tick_timer_service_unsubscribe(void);
+bool clock_is_24h_style(void);
+
+// 錶盤呼叫 time() 取得的是模擬時鐘，確保基準測試可重現
+time_t host_time(time_t *tloc);
+#define time(tloc) host_time(tloc)
+uint16_t time_ms(time_t *tloc, uint16_t *out_ms);
+
+// ==================== 系統事件服務 ====================
+
+typedef struct {
+    uint8_t charge_percent;
+    bool is_charging;
+    bool is_plugged;
+} BatteryChargeState;
+
+typedef void (*BatteryStateHandler)(BatteryChargeState charge);
+
+void battery_state_service_subscribe(BatteryStateHandler handler);
+void battery_state_service_unsubscribe(void);
+BatteryChargeState battery_state_service_peek(void);
+
+typedef void (*AppFocusHandler)(bool in_focus);
+
+typedef struct {
+    AppFocusHandler will_focus;
+    AppFocusHandler did_focus;
+} AppFocusHandlers;
+
+void app_focus_service_subscribe_handlers(AppFocusHandlers handlers);
+void app_focus_service_unsubscribe(void);
+
+// 勿擾模式查詢僅 Basalt 以後的韌體提供
+#if !defined(PBL_PLATFORM_APLITE)
+bool quiet_time_is_active(void);
+#endif
+
+// 未遮蔽區域（Timeline Quick View 等由下方遮蔽錶盤）同樣僅 Basalt 以後的韌體提供
+#if !defined(PBL_PLATFORM_APLITE)
+typedef void (*UnobstructedAreaWillChangeHandler)(GRect final_unobstructed_screen_area, void *context);
+typedef void (*UnobstructedAreaChangeHandler)(AnimationProgress progress, void *context);
+typedef void (*UnobstructedAreaDidChangeHandler)(void *context);
+
+typedef struct {
+    UnobstructedAreaWillChangeHandler will_change;
+    UnobstructedAreaChangeHandler change;
+    UnobstructedAreaDidChangeHandler did_change;
+} UnobstructedAreaHandlers;
+
+void unobstructed_area_service_subscribe(UnobstructedAreaHandlers handlers, void *context);
+void unobstructed_area_service_unsubscribe(void);
+GRect layer_get_unobstructed_bounds(const Layer *layer);
+#endif
+
+// 加速度計：輕敲（甩動手腕）事件與最近一次取樣的查詢；取樣單位為 mG。
+// 與韌體相同，accel_service_peek 須先訂閱資料服務（samples_per_update 為 0）才能使用，否則回傳負值
+typedef enum {
+    ACCEL_AXIS_X = 0,
+    ACCEL_AXIS_Y = 1,
+    ACCEL_AXIS_Z = 2,
+} AccelAxisType;
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t z;
+    bool did_vibrate;
+    uint64_t timestamp;
+} AccelData;
+
+typedef enum {
+    ACCEL_SAMPLING_10HZ = 10,
+    ACCEL_SAMPLING_25HZ = 25,
+    ACCEL_SAMPLING_50HZ = 50,
+    ACCEL_SAMPLING_100HZ = 100,
+} AccelSamplingRate;
+
+typedef void (*AccelTapHandler)(AccelAxisType axis, int32_t direction);
+typedef void (*AccelDataHandler)(AccelData *data, uint32_t num_samples);
+
+void accel_tap_service_subscribe(AccelTapHandler handler);
+void accel_tap_service_unsubscribe(void);
+void accel_data_service_subscribe(uint32_t samples_per_update, AccelDataHandler handler);
+void accel_data_service_unsubscribe(void);
+int accel_service_set_sampling_rate(AccelSamplingRate rate);
+int accel_service_peek(AccelData *data);
+
+// ==================== 持久化儲存 ====================
+
+#define PERSIST_DATA_MAX_LENGTH 256
+
+typedef int32_t status_t;
+
+typedef enum {
+    S_SUCCESS = 0,
+    E_DOES_NOT_EXIST = -10,
+} StatusCode;
+
+bool persist_exists(uint32_t key);
+int persist_get_size(uint32_t key);
+bool persist_read_bool(uint32_t key);
+int32_t persist_read_int(uint32_t key);
+int persist_read_data(uint32_t key, void *buffer, size_t buffer_size);
+status_t persist_write_bool(uint32_t key, bool value);
+status_t persist_write_int(uint32_t key, int32_t value);
+int persist_write_data(uint32_t key, const void *data, size_t size);
+status_t persist_delete(uint32_t key);
+
+// ==================== AppMessage ====================
+
+typedef enum {
+    TUPLE_BYTE_ARRAY = 0,
+    TUPLE_CSTRING = 1,
+    TUPLE_UINT = 2,
+    TUPLE_INT = 3,
+} TupleType;
+
+typedef struct Tuple {
+    uint32_t key;
+    TupleType type;
+    uint16_t length;
+    union {
+        uint8_t data[4];
+        char cstring[4];
+        uint8_t uint8;
+        uint16_t uint16;
+        uint32_t uint32;
+        int8_t int8;
+        int16_t int16;
+        int32_t int32;
+    } value[1];
+} Tuple;
+
+typedef struct DictionaryIterator DictionaryIterator;
+
+typedef enum {
+    DICT_OK = 0,
+    DICT_NOT_ENOUGH_STORAGE = 1 << 1,
+    DICT_INVALID_ARGS = 1 << 2,
+} DictionaryResult;
+
+Tuple *dict_find(const DictionaryIterator *iter, const uint32_t key);
+Tuple *dict_read_first(DictionaryIterator *iter);
+Tuple *dict_read_next(DictionaryIterator *iter);
+DictionaryResult dict_write_int32(DictionaryIterator *iter, const uint32_t key, const int32_t value);
+
+typedef enum {
+    APP_MSG_OK = 0,
+    APP_MSG_SEND_TIMEOUT = 1 << 1,
+    APP_MSG_SEND_REJECTED = 1 << 2,
+    APP_MSG_NOT_CONNECTED = 1 << 3,
+    APP_MSG_APP_NOT_RUNNING = 1 << 4,
+    APP_MSG_INVALID_ARGS = 1 << 5,
+    APP_MSG_BUSY = 1 << 6,
+    APP_MSG_BUFFER_OVERFLOW = 1 << 7,
+    APP_MSG_OUT_OF_MEMORY = 1 << 10,
+    APP_MSG_CLOSED = 1 << 11,
+    APP_MSG_INTERNAL_ERROR = 1 << 12,
+} AppMessageResult;
+
+typedef void (*AppMessageInboxReceived)(DictionaryIterator *iterator, void *context);
+typedef void (*AppMessageInboxDropped)(AppMessageResult reason, void *context);
+typedef void (*AppMessageOutboxSent)(DictionaryIterator *iterator, void *context);
+typedef void (*AppMessageOutboxFailed)(DictionaryIterator *iterator, AppMessageResult reason, void *context);
+
+AppMessageResult app_message_open(const uint32_t size_inbound, const uint32_t size_outbound);
+void app_message_deregister_callbacks(void);
+AppMessageInboxReceived app_message_register_inbox_received(AppMessageInboxReceived received_callback);
+AppMessageInboxDropped app_message_register_inbox_dropped(AppMessageInboxDropped dropped_callback);
+AppMessageOutboxSent app_message_register_outbox_sent(AppMessageOutboxSent sent_callback);
+AppMessageOutboxFailed app_message_register_outbox_failed(AppMessageOutboxFailed failed_callback);
+AppMessageResult app_message_outbox_begin(DictionaryIterator **iterator);
+AppMessageResult app_message_outbox_send(void);
+
+// ==================== 應用程式 ====================
+
+void app_event_loop(void);
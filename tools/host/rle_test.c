@@ -0,0 +1,180 @@
+// 字形串流的檢查（以 -DUSE_RLE_GLYPHS 與字形串流的資源清單編譯）
+//
+// 確認：
+//   每張字形的串流恰好解出 寬 x 高 個像素，插槽不超出調色盤；
+//   以 blit_glyph 直接寫入畫面的結果，與測試自行整張解碼後逐像素套用主題色的參考結果相同，
+//   包括各 LayerType 的配色、放大倍數、超出畫面邊緣與格子小於字形時的裁切，且不寫到範圍外；
+//   下方被裁掉的部分不再讀取；
+//   啟動後除了 SDK 物件沒有任何字形記憶體，整個畫面重畫時不配置堆積。
+// 與圖集 / 快取路徑的畫面是否一致，見 make compare 中 bench 與 bench-rle 的 framebuffer hash。
+//
+// 用法：rle_test（全部通過時回傳 0）
+#define main ccwatchface_main
+#include "../../src/c/ccwatchface.c"
+#undef main
+
+#include "host.h"
+
+// 起點：2026-01-01 09:41:00 UTC
+#define START_EPOCH 1767260460
+
+static void launch(void) {
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(START_EPOCH);
+    host_set_rendering(true);
+    app_init();
+    host_run_until_idle();
+}
+
+static void quit(void) {
+    app_deinit();
+    host_set_rendering(false);
+}
+
+// 整張解碼到 slots（寬 x 高 個插槽索引）；像素數不符或插槽超出調色盤時回傳 false
+static bool reference_decode(GlyphId glyph, uint8_t *slots) {
+    const GlyphRle *rle = &GLYPH_RLE_INDEX[glyph];
+    uint8_t data[1024];
+    if (rle->size > sizeof(data)) return false;
+    if (resource_load_byte_range(s_app.glyph_stream.handle, rle->offset, data, rle->size) != rle->size) return false;
+
+    int pixels = rle->width * rle->height;
+    int n = 0;
+    for (int i = 0; i < rle->size; i++) {
+        int slot = data[i] >> GLYPH_RLE_SLOT_SHIFT;
+        int run = (data[i] & GLYPH_RLE_LENGTH_MASK) + 1;
+        if (slot >= GLYPH_PALETTE_SIZE || n + run > pixels) return false;
+        memset(slots + n, slot, run);
+        n += run;
+    }
+    return n == pixels;
+}
+
+// ==================== 串流格式 ====================
+
+static void check_streams(void) {
+    const char *label = "streams";
+    launch();
+    bool ok = true;
+    uint8_t slots[88 * 88];
+    for (int g = GLYPH_NONE + 1; g < GLYPH_COUNT; g++) {
+        const GlyphRle *rle = &GLYPH_RLE_INDEX[g];
+        ok &= rle->width * rle->height <= (int)sizeof(slots) && reference_decode((GlyphId)g, slots);
+    }
+    host_check(ok, label, "a stream does not decode to exactly width x height pixels");
+    quit();
+}
+
+// ==================== 直寫畫面 ====================
+
+// 以 sentinel 填滿畫面後畫出字形，與參考結果逐像素比較
+static bool blit_matches(GlyphId glyph, LayerType type, GRect frame, GColor sentinel) {
+    GBitmap *fb = graphics_capture_frame_buffer(NULL);
+    if (!fb) return false;
+    blit_fill(fb, gbitmap_get_bounds(fb), sentinel);
+    blit_glyph(fb, glyph, frame, type);
+    graphics_release_frame_buffer(NULL, fb);
+
+    const GlyphRle *rle = &GLYPH_RLE_INDEX[glyph];
+    uint8_t slots[88 * 88];
+    if (!reference_decode(glyph, slots)) return false;
+    const GColor *palette = s_app.glyph_stream.palettes[type];
+    int scale = glyph_scale(type);
+    GSize size = host_screen_size();
+    const GColor8 *pixels = host_framebuffer();
+    for (int y = 0; y < size.h; y++) {
+        for (int x = 0; x < size.w; x++) {
+            int gx = x - frame.origin.x;
+            int gy = y - frame.origin.y;
+            GColor expected = sentinel;
+            if (gx >= 0 && gy >= 0 && gx < frame.size.w && gy < frame.size.h &&
+                gx < rle->width * scale && gy < rle->height * scale) {
+                GColor color = palette[slots[gy / scale * rle->width + gx / scale]];
+                if (color.a) expected = color;
+            }
+            if ((pixels[y * size.w + x].argb | 0xC0) != (expected.argb | 0xC0)) return false;
+        }
+    }
+    return true;
+}
+
+static void check_blit(void) {
+    const char *label = "blit";
+    launch();
+    GSize screen = host_screen_size();
+    // 與畫面上任何主題色都不同的填色（黑白平台只能以黑、白兩種各畫一次）
+    const GColor sentinels[] = {GColorBlack, GColorWhite};
+
+    bool ok = true;
+    for (int g = GLYPH_NONE + 1; g < GLYPH_COUNT; g++) {
+        const GlyphRle *rle = &GLYPH_RLE_INDEX[g];
+        for (int type = 0; type < LAYER_TYPE_COUNT; type++) {
+            int scale = glyph_scale((LayerType)type);
+            GSize size = GSize(rle->width * scale, rle->height * scale);
+            const GRect frames[] = {
+                GRect(3, 7, size.w, size.h),                                       // 完整
+                GRect(-size.w / 3, -size.h / 2, size.w, size.h),                    // 超出左上
+                GRect(screen.w - size.w / 2, screen.h - size.h / 3, size.w, size.h), // 超出右下
+                GRect(5, 2, size.w - 3, size.h / 2 + 1),                           // 格子小於字形
+            };
+            for (size_t f = 0; f < ARRAY_LENGTH(frames); f++) {
+                for (size_t s = 0; s < ARRAY_LENGTH(sentinels); s++) {
+                    ok &= blit_matches((GlyphId)g, (LayerType)type, frames[f], sentinels[s]);
+                }
+            }
+        }
+    }
+    host_check(ok, label, "streamed glyph differs from the reference decode");
+    quit();
+}
+
+// ==================== 讀取量與堆積 ====================
+
+static void check_reads(void) {
+    const char *label = "reads";
+    launch();
+
+    // 最長的串流只畫上半部：下方的位元組不讀取
+    GlyphId longest = GLYPH_NONE + 1;
+    for (int g = GLYPH_NONE + 1; g < GLYPH_COUNT; g++) {
+        if (GLYPH_RLE_INDEX[g].size > GLYPH_RLE_INDEX[longest].size) longest = (GlyphId)g;
+    }
+    const GlyphRle *rle = &GLYPH_RLE_INDEX[longest];
+    int scale = glyph_scale(LAYER_TYPE_HOUR);
+    GBitmap *fb = graphics_capture_frame_buffer(NULL);
+    uint64_t before = host_counters.resource_bytes_read;
+    blit_glyph(fb, longest, GRect(0, 0, rle->width * scale, rle->height * scale / 2), LAYER_TYPE_HOUR);
+    uint64_t half = host_counters.resource_bytes_read - before;
+    before = host_counters.resource_bytes_read;
+    blit_glyph(fb, longest, GRect(0, 0, rle->width * scale, rle->height * scale), LAYER_TYPE_HOUR);
+    uint64_t full = host_counters.resource_bytes_read - before;
+    graphics_release_frame_buffer(NULL, fb);
+    host_check(full == rle->size, label, "full glyph not read exactly once");
+    host_check(half < full, label, "clipped rows still read");
+
+    // 整個畫面重畫：只讀取資源，不配置堆積
+    HostCounters counters = host_counters;
+    canvas_mark_all_dirty();
+    host_render_pending();
+    host_check(host_counters.frames_rendered > counters.frames_rendered, label, "full redraw not rendered");
+    host_check(host_counters.heap_allocs == counters.heap_allocs, label, "full redraw allocated heap");
+    host_check(host_counters.resource_bytes_read > counters.resource_bytes_read, label, "full redraw read no glyphs");
+    host_check(host_counters.resource_bitmap_loads == counters.resource_bitmap_loads, label, "bitmap resource loaded");
+    quit();
+}
+
+int main(void) {
+    setenv("TZ", "UTC", 1);
+    tzset();
+
+    check_streams();
+    check_blit();
+    check_reads();
+
+    size_t bytes = 0;
+    for (int g = GLYPH_NONE + 1; g < GLYPH_COUNT; g++) bytes += GLYPH_RLE_INDEX[g].size;
+    printf("rle: %d checks, %d failures (%zu B for %d glyphs)\n", host_checks, host_failures, bytes, GLYPH_COUNT - 1);
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,245 @@
+// 秒數指示的重繪範圍與自動關閉檢查
+//
+// 開啟秒數指示後逐秒送出 tick，確認：
+//   每秒只標記秒數圖層需重繪，不觸碰 12 個格子、不配置堆積也不載入資源，進度條以外的畫面不變；
+//   每秒的重畫面積不超過新增的欄位，換分鐘時清除整條、格子照常換字；
+//   顯示期間以最低取樣率訂閱加速度計資料服務，關閉後取消訂閱；
+//   逾時、手腕放下、錶盤被覆蓋時自動關閉並清除進度條，之後只收到分鐘 tick；甩動手腕再次開始；
+//   進度條隨版面重排移動或隱藏；關閉設定後畫面與從未開啟時相同。
+// 以 -DUSE_BITMAP_LAYERS 編譯時檢查 BitmapLayer 模式（格子群組於只有進度條變動時隱藏）。
+//
+// 用法：seconds_test（全部通過時回傳 0）
+#define main ccwatchface_main
+#include "../../src/c/ccwatchface.c"
+#undef main
+
+#include "host.h"
+
+// 起點：2026-01-01 09:41:00 UTC
+#define START_EPOCH 1767260460
+// 測試用的自動關閉秒數；檢查重繪範圍時改用較長的時間，不在檢查途中關閉
+#define TEST_TIMEOUT_S 20
+#define TEST_LONG_TIMEOUT_S 120
+
+static uint32_t framebuffer_hash(void) {
+    GSize size = host_screen_size();
+    const uint8_t *pixels = (const uint8_t *)host_framebuffer();
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < size.w * size.h; i++) {
+        hash = (hash ^ pixels[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// 進度條以外的畫面雜湊
+static uint32_t framebuffer_hash_outside(GRect bar) {
+    GSize size = host_screen_size();
+    const uint8_t *pixels = (const uint8_t *)host_framebuffer();
+    uint32_t hash = 2166136261u;
+    for (int y = 0; y < size.h; y++) {
+        for (int x = 0; x < size.w; x++) {
+            if (x >= bar.origin.x && x < bar.origin.x + bar.size.w &&
+                y >= bar.origin.y && y < bar.origin.y + bar.size.h) continue;
+            hash = (hash ^ pixels[y * size.w + x]) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+static bool bar_is_background(GRect bar) {
+    GSize size = host_screen_size();
+    const GColor8 *pixels = host_framebuffer();
+    GColor8 background = s_app.theme.background;
+    background.a = 3;
+    for (int y = bar.origin.y; y < bar.origin.y + bar.size.h; y++) {
+        for (int x = bar.origin.x; x < bar.origin.x + bar.size.w; x++) {
+            if (pixels[y * size.w + x].argb != background.argb) return false;
+        }
+    }
+    return true;
+}
+
+static void set_seconds(bool enabled, int32_t timeout_s) {
+    const uint32_t keys[] = {KEY_SECONDS_INDICATOR, KEY_SECONDS_TIMEOUT};
+    const int32_t values[] = {enabled, timeout_s};
+    host_deliver_message(keys, values, ARRAY_LENGTH(keys));
+    host_run_until_idle();
+}
+
+static void launch(void) {
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(START_EPOCH);
+    host_set_rendering(true);
+    app_init();
+    host_run_until_idle();
+}
+
+static void quit(void) {
+    app_deinit();
+    host_set_rendering(false);
+}
+
+// 推進一秒並送出 tick（跨分鐘時含 MINUTE_UNIT）
+static void next_second(void) {
+    time_t prev = host_get_time();
+    host_advance_ms(1000);
+    host_tick(prev / 60 != (prev + 1) / 60 ? MINUTE_UNIT : SECOND_UNIT);
+}
+
+// ==================== 每秒的重繪範圍 ====================
+
+static void check_bounded_redraw(void) {
+    const char *label = "bounded redraw";
+    launch();
+    set_seconds(true, TEST_LONG_TIMEOUT_S);
+    host_check(s_app.seconds.active, label, "not shown after enabling");
+    host_check(host_accel_sampling_hz() == ACCEL_SAMPLING_10HZ, label, "accel data service not at 10 Hz while shown");
+
+    GRect bar = layer_get_frame(s_app.seconds.layer);
+    int16_t per_second = bar.size.w / 60 + 1;
+    uint32_t outside = framebuffer_hash_outside(bar);
+    bool marks_ok = true, pixels_ok = true, alloc_ok = true, outside_ok = true;
+
+    // 同一分鐘內的 50 秒
+    for (int s = 0; s < 50; s++) {
+        HostCounters before = host_counters;
+        next_second();
+        marks_ok &= host_counters.layers_marked_dirty - before.layers_marked_dirty == 1;
+        pixels_ok &= host_counters.pixels_drawn - before.pixels_drawn <= (uint64_t)per_second * bar.size.h;
+        alloc_ok &= host_counters.heap_allocs == before.heap_allocs &&
+                    host_counters.resource_bitmap_loads + host_counters.resource_raw_loads ==
+                    before.resource_bitmap_loads + before.resource_raw_loads;
+        outside_ok &= framebuffer_hash_outside(bar) == outside;
+    }
+    host_check(marks_ok, label, "a seconds tick marked more than the seconds layer dirty");
+    host_check(pixels_ok, label, "a seconds tick redrew more than the new columns");
+    host_check(alloc_ok, label, "heap allocations or resource loads on seconds ticks");
+    host_check(outside_ok, label, "pixels outside the bar changed");
+    host_check(!bar_is_background(bar), label, "bar not drawn");
+
+    // 跨過分鐘交界：格子照常換字，進度條清空後重新累積
+    GlyphId minute = s_app.minute_layers[1].current_glyph;
+    while (host_get_time() % 60 != 0) next_second();
+    host_run_until_idle();
+    host_check(s_app.minute_layers[1].current_glyph != minute, label, "minute not updated in seconds mode");
+    host_check(s_app.seconds.drawn_width == 0, label, "bar not cleared at the minute");
+    quit();
+}
+
+// ==================== 自動關閉 ====================
+
+static void check_timeout(void) {
+    const char *label = "timeout";
+    launch();
+    set_seconds(true, TEST_TIMEOUT_S);
+    GRect bar = layer_get_frame(s_app.seconds.layer);
+
+    for (int s = 0; s < TEST_TIMEOUT_S - 1; s++) next_second();
+    host_check(s_app.seconds.active, label, "stopped before the timeout");
+    next_second();
+    host_check(!s_app.seconds.active, label, "still shown after the timeout");
+    host_check(bar_is_background(bar), label, "bar not cleared");
+    host_check(host_accel_sampling_hz() == 0, label, "accel data service still subscribed after stopping");
+
+    // 之後只收到分鐘 tick
+    HostCounters before = host_counters;
+    for (int s = 0; s < 5 && host_get_time() % 60 != 59; s++) next_second();
+    host_check(host_counters.frames_rendered == before.frames_rendered, label, "redraws after stopping");
+
+    host_accel_tap();
+    host_check(s_app.seconds.active, label, "wrist flick did not restart it");
+    quit();
+}
+
+static void check_wrist_down(void) {
+    const char *label = "wrist down";
+    launch();
+    set_seconds(true, TEST_TIMEOUT_S);
+    GRect bar = layer_get_frame(s_app.seconds.layer);
+    next_second();
+
+    // 錶面轉向側面
+    host_set_accel(-1000, 0, -100);
+    for (int s = 0; s < SECONDS_WRIST_DOWN_S - 1; s++) next_second();
+    host_check(s_app.seconds.active, label, "stopped before the wrist stayed down");
+    next_second();
+    host_check(!s_app.seconds.active, label, "still shown with the wrist down");
+    host_check(bar_is_background(bar), label, "bar not cleared");
+
+    host_set_accel(0, 0, -1000);
+    host_accel_tap();
+    host_check(s_app.seconds.active, label, "wrist flick did not restart it");
+
+    // 錶盤被覆蓋
+    host_set_focus(false);
+    next_second();
+    host_check(!s_app.seconds.active, label, "still shown while obscured");
+    host_set_focus(true);
+    quit();
+}
+
+#if defined(USE_UNOBSTRUCTED_AREA)
+// ==================== 版面重排 ====================
+
+// 進度條隨日期列上移，放不下時一併隱藏；遮蔽物離開後回到原位
+static void check_reflow(void) {
+    const char *label = "reflow";
+    int16_t screen_h = host_screen_size().h;
+    launch();
+    set_seconds(true, TEST_LONG_TIMEOUT_S);
+    GRect bar = layer_get_frame(s_app.seconds.layer);
+
+    host_set_unobstructed_height(screen_h - 5);
+    host_run_until_idle();
+    GRect shifted = layer_get_frame(s_app.seconds.layer);
+    host_check(shifted.origin.y == bar.origin.y - 5 && !layer_get_hidden(s_app.seconds.layer), label,
+               "bar not moved with the date row");
+
+    host_set_unobstructed_height(screen_h - 51);
+    host_run_until_idle();
+    host_check(layer_get_hidden(s_app.seconds.layer), label, "bar not hidden with the date row");
+
+    host_set_unobstructed_height(screen_h);
+    host_run_until_idle();
+    GRect restored = layer_get_frame(s_app.seconds.layer);
+    host_check(grect_equal(&restored, &bar) && !layer_get_hidden(s_app.seconds.layer), label, "bar not restored");
+    quit();
+}
+#endif
+
+// ==================== 關閉設定 ====================
+
+static void check_disable(void) {
+    const char *label = "disable";
+    launch();
+    uint32_t ref_hash = framebuffer_hash();
+    size_t ref_heap = heap_bytes_used();
+
+    set_seconds(true, TEST_TIMEOUT_S);
+    for (int s = 0; s < 10; s++) next_second();
+    set_seconds(false, TEST_TIMEOUT_S);
+    host_check(s_app.seconds.layer == NULL && !s_app.seconds.active, label, "layer not removed");
+    host_check(heap_bytes_used() == ref_heap, label, "heap not returned");
+    host_check(framebuffer_hash() == ref_hash, label, "face differs from never enabling it");
+
+    host_accel_tap();
+    host_check(!s_app.seconds.active, label, "wrist flick shows it while disabled");
+    quit();
+}
+
+int main(void) {
+    setenv("TZ", "UTC", 1);
+    tzset();
+
+    check_bounded_redraw();
+    check_timeout();
+    check_wrist_down();
+#if defined(USE_UNOBSTRUCTED_AREA)
+    check_reflow();
+#endif
+    check_disable();
+    printf("seconds: %d checks, %d failures\n", host_checks, host_failures);
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,165 @@
+// 設定差異同步的手機端檢查（src/js/settings_sync.js）
+//
+// 以替身 Pebble 物件與 localStorage 模擬設定頁儲存與錶盤回覆，確認：
+//   首次儲存送出全部鍵值；錶盤確認後只送出變動的鍵值並附上所依據的版本；沒有變動時不送出；
+//   上一筆尚未確認或傳送失敗時改送全部鍵值，已被取代的訊息的回覆不觸發重送；
+//   錶盤回覆的版本與手機紀錄不一致時改送全部鍵值。
+// 並列出全部鍵值與單一設定變動時的訊息大小。
+//
+// 用法：node settings_sync_test.js（全部通過時回傳 0）
+'use strict';
+
+const path = require('path');
+const SettingsSync = require('../../src/js/settings_sync');
+
+const REPO = path.join(__dirname, '..', '..');
+const MESSAGE_KEYS = require(path.join(REPO, 'package.json')).pebble.messageKeys;
+const CONFIG = require(path.join(REPO, 'src', 'js', 'config.json'));
+
+let checks = 0;
+let failures = 0;
+let fullBytes = 0;
+let deltaBytes = 0;
+
+function check(ok, label, what) {
+    checks++;
+    if (ok) return;
+    failures++;
+    console.error(`  ${label}: ${what}`);
+}
+
+// 與 Clay 於彩色平台（basalt）的 getSettings() 相同：鍵為 AppMessage 鍵值，開關為 1 / 0，顏色為整數，
+// 黑白平台專用的項目不送出
+function claySettings(overrides) {
+    const settings = {};
+    (function walk(items) {
+        for (const item of items) {
+            if (item.items) walk(item.items);
+            if (!item.messageKey || (item.capabilities || []).includes('NOT_COLOR')) continue;
+            let value = item.defaultValue;
+            if (item.type === 'color') value = parseInt(value, 16);
+            if (typeof value === 'boolean') value = value ? 1 : 0;
+            settings[MESSAGE_KEYS[item.messageKey]] = value;
+        }
+    })(CONFIG);
+    for (const name in overrides) settings[MESSAGE_KEYS[name]] = overrides[name];
+    return settings;
+}
+
+// AppMessage 字典的位元組數：1 byte 數量，每個鍵值 7 bytes 標頭加 int32 內容
+function messageBytes(message) {
+    return 1 + Object.keys(message).length * (7 + 4);
+}
+
+function createPhone() {
+    const storage = new Map();
+    const phone = {
+        sent: [],
+        failNext: false,
+        sendAppMessage(message, success, failure) {
+            phone.sent.push(message);
+            if (phone.failNext) {
+                phone.failNext = false;
+                failure({ error: 'NACK' });
+            } else {
+                success();
+            }
+        },
+    };
+    const localStorage = {
+        getItem: (key) => (storage.has(key) ? storage.get(key) : null),
+        setItem: (key, value) => storage.set(key, String(value)),
+    };
+    phone.sync = new SettingsSync(phone, localStorage,
+        { version: MESSAGE_KEYS.KEY_SETTINGS_VERSION, base: MESSAGE_KEYS.KEY_SETTINGS_BASE });
+    return phone;
+}
+
+// 訊息中的設定鍵（不含版本鍵）
+function settingKeys(message) {
+    return Object.keys(message).map(Number).filter((key) =>
+        key !== MESSAGE_KEYS.KEY_SETTINGS_VERSION && key !== MESSAGE_KEYS.KEY_SETTINGS_BASE);
+}
+
+function checkDelta() {
+    const label = 'delta';
+    const phone = createPhone();
+    const defaults = claySettings({});
+    const keyCount = Object.keys(defaults).length;
+
+    const full = phone.sync.send(defaults);
+    check(settingKeys(full).length === keyCount, label, 'first save not a full set');
+    check(full[MESSAGE_KEYS.KEY_SETTINGS_BASE] === undefined, label, 'full set has a base');
+    phone.sync.acknowledge(full[MESSAGE_KEYS.KEY_SETTINGS_VERSION]);
+
+    const delta = phone.sync.send(claySettings({ KEY_HOUR_COLOR: 0x55AAFF }));
+    check(settingKeys(delta).join() === String(MESSAGE_KEYS.KEY_HOUR_COLOR), label, 'delta not only the changed key');
+    check(delta[MESSAGE_KEYS.KEY_SETTINGS_BASE] === full[MESSAGE_KEYS.KEY_SETTINGS_VERSION], label, 'delta base wrong');
+    phone.sync.acknowledge(delta[MESSAGE_KEYS.KEY_SETTINGS_VERSION]);
+
+    const sent = phone.sent.length;
+    check(phone.sync.send(claySettings({ KEY_HOUR_COLOR: 0x55AAFF })) === null && phone.sent.length === sent, label,
+          'unchanged save sent a message');
+
+    // 改回原值也是變動
+    const revert = phone.sync.send(defaults);
+    check(settingKeys(revert).join() === String(MESSAGE_KEYS.KEY_HOUR_COLOR), label, 'reverting not sent as a delta');
+
+    fullBytes = messageBytes(full);
+    deltaBytes = messageBytes(delta);
+}
+
+function checkUnacknowledged() {
+    const label = 'unacknowledged';
+    const phone = createPhone();
+    const first = phone.sync.send(claySettings({}));
+    phone.sync.acknowledge(first[MESSAGE_KEYS.KEY_SETTINGS_VERSION]);
+
+    // 回覆前再次儲存：改送全部鍵值，先前訊息的回覆不觸發重送
+    const a = phone.sync.send(claySettings({ KEY_LUNAR_DATE: 1 }));
+    const b = phone.sync.send(claySettings({ KEY_LUNAR_DATE: 1, KEY_ANIMATION_ENABLED: 0 }));
+    check(settingKeys(a).length === 1, label, 'first save not a delta');
+    check(b[MESSAGE_KEYS.KEY_SETTINGS_BASE] === undefined, label, 'save while pending not a full set');
+    const sent = phone.sent.length;
+    check(!phone.sync.acknowledge(a[MESSAGE_KEYS.KEY_SETTINGS_VERSION]) && phone.sent.length === sent, label,
+          'reply to a superseded message triggered a resend');
+    phone.sync.acknowledge(b[MESSAGE_KEYS.KEY_SETTINGS_VERSION]);
+    const after = phone.sync.send(claySettings({ KEY_LUNAR_DATE: 1, KEY_ANIMATION_ENABLED: 1 }));
+    check(settingKeys(after).join() === String(MESSAGE_KEYS.KEY_ANIMATION_ENABLED), label, 'not a delta after the ack');
+
+    // 傳送失敗：下次儲存改送全部鍵值
+    phone.sync.acknowledge(after[MESSAGE_KEYS.KEY_SETTINGS_VERSION]);
+    const log = console.log;
+    console.log = () => {};
+    phone.failNext = true;
+    phone.sync.send(claySettings({ KEY_LUNAR_DATE: 0 }));
+    console.log = log;
+    const retry = phone.sync.send(claySettings({ KEY_LUNAR_DATE: 0 }));
+    check(retry !== null && retry[MESSAGE_KEYS.KEY_SETTINGS_BASE] === undefined, label, 'save after a failure not a full set');
+}
+
+function checkResync() {
+    const label = 'resync';
+    const phone = createPhone();
+    const first = phone.sync.send(claySettings({}));
+    phone.sync.acknowledge(first[MESSAGE_KEYS.KEY_SETTINGS_VERSION]);
+
+    // 錶盤重新安裝後持有版本 0，拒絕依據手機版本的差異
+    phone.sync.send(claySettings({ KEY_SECONDS_INDICATOR: 1 }));
+    check(phone.sync.acknowledge(0), label, 'mismatched reply did not resync');
+    const full = phone.sent[phone.sent.length - 1];
+    check(full[MESSAGE_KEYS.KEY_SETTINGS_BASE] === undefined, label, 'resync has a base');
+    check(settingKeys(full).length === Object.keys(claySettings({})).length, label, 'resync not a full set');
+    check(full[MESSAGE_KEYS.KEY_SECONDS_INDICATOR] === 1, label, 'resync lost the latest change');
+
+    phone.sync.acknowledge(full[MESSAGE_KEYS.KEY_SETTINGS_VERSION]);
+    const delta = phone.sync.send(claySettings({ KEY_SECONDS_INDICATOR: 0 }));
+    check(delta[MESSAGE_KEYS.KEY_SETTINGS_BASE] === full[MESSAGE_KEYS.KEY_SETTINGS_VERSION], label,
+          'delta after a resync not based on it');
+}
+
+checkDelta();
+checkUnacknowledged();
+checkResync();
+console.log(`settings sync: ${checks} checks, ${failures} failures (full set ${fullBytes} B, one setting ${deltaBytes} B)`);
+process.exit(failures ? 1 : 0);
@@ -0,0 +1,215 @@
+// 設定差異同步的錶盤端檢查
+//
+// 以手機送出的完整設定與差異，確認：
+//   完整設定一律接受並回覆其版本，版本隨設定寫入 flash，重新啟動後保留；
+//   差異依據的版本與錶盤持有的相同時接受；不同時鍵值照常套用，但回覆舊版本讓手機改送完整設定；
+//   未附版本的訊息（舊版手機端）照常套用，不回覆；
+//   只更新受影響的部分：值未變動的差異不標記任何重繪，動畫開關不重畫整個畫面，
+//   改色後的畫面與以該設定啟動時相同；
+//   離開時保存的畫面只在版本、字形數與主題皆相符時還原，換色後的舊畫面作廢。
+// 手機端的差異計算見 settings_sync_test.js。
+//
+// 用法：settings_test（全部通過時回傳 0）
+#define main ccwatchface_main
+#include "../../src/c/ccwatchface.c"
+#undef main
+
+#include "host.h"
+
+// 起點：2026-01-01 09:41:00 UTC
+#define START_EPOCH 1767260460
+
+static uint32_t framebuffer_hash(void) {
+    GSize size = host_screen_size();
+    const uint8_t *pixels = (const uint8_t *)host_framebuffer();
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < size.w * size.h; i++) {
+        hash = (hash ^ pixels[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static void launch(void) {
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(START_EPOCH);
+    host_set_rendering(true);
+    app_init();
+    host_run_until_idle();
+}
+
+static void quit(void) {
+    app_deinit();
+    host_set_rendering(false);
+}
+
+static void deliver(const uint32_t *keys, const int32_t *values, int count) {
+    host_deliver_message(keys, values, count);
+    host_run_until_idle();
+}
+
+// 送出後回覆的版本；沒有回覆時為 -1
+static int32_t deliver_and_read_ack(const uint32_t *keys, const int32_t *values, int count) {
+    uint64_t sent = host_counters.app_messages_sent;
+    deliver(keys, values, count);
+    if (host_counters.app_messages_sent == sent) return -1;
+    Tuple *ack = dict_find(host_last_message_sent(), KEY_SETTINGS_VERSION);
+    return ack ? ack->value->int32 : -1;
+}
+
+// 改變外觀的設定鍵與值：彩色平台改背景色，黑白平台改深色主題
+#if defined(PBL_COLOR)
+    #define THEME_KEY KEY_BACKGROUND_COLOR
+    #define THEME_VALUE 0x0055AA
+#else
+    #define THEME_KEY KEY_THEME_IS_DARK
+    #define THEME_VALUE 0
+#endif
+
+// ==================== 版本 ====================
+
+static void check_versions(void) {
+    const char *label = "versions";
+    host_persist_clear();
+    launch();
+
+    // 首次同步：完整設定，不附 KEY_SETTINGS_BASE
+    const uint32_t full_keys[] = {KEY_ANIMATION_ENABLED, KEY_LUNAR_DATE, KEY_POWER_SAVE_BATTERY, KEY_SETTINGS_VERSION};
+    const int32_t full_values[] = {1, 0, POWER_SAVE_BATTERY_DEFAULT, 1};
+    host_check(deliver_and_read_ack(full_keys, full_values, ARRAY_LENGTH(full_keys)) == 1, label,
+               "full set not acknowledged");
+
+    // 依據目前版本的差異
+    const uint32_t delta_keys[] = {KEY_LUNAR_DATE, KEY_SETTINGS_VERSION, KEY_SETTINGS_BASE};
+    const int32_t delta_values[] = {1, 2, 1};
+    host_check(deliver_and_read_ack(delta_keys, delta_values, ARRAY_LENGTH(delta_keys)) == 2, label,
+               "delta not acknowledged");
+    host_check(s_app.lunar_date, label, "delta not applied");
+
+    // 依據錶盤沒有的版本：照常套用，回覆目前持有的版本
+    const uint32_t stale_keys[] = {KEY_LUNAR_DATE, KEY_SETTINGS_VERSION, KEY_SETTINGS_BASE};
+    const int32_t stale_values[] = {0, 7, 5};
+    host_check(deliver_and_read_ack(stale_keys, stale_values, ARRAY_LENGTH(stale_keys)) == 2, label,
+               "delta on an unknown base acknowledged");
+    host_check(!s_app.lunar_date, label, "delta on an unknown base not applied");
+
+    // 重新同步的完整設定一律接受
+    const int32_t resync_values[] = {1, 0, POWER_SAVE_BATTERY_DEFAULT, 8};
+    host_check(deliver_and_read_ack(full_keys, resync_values, ARRAY_LENGTH(full_keys)) == 8, label,
+               "resync not acknowledged");
+
+    // 舊版手機端：不附版本，照常套用且不回覆
+    const uint32_t legacy_keys[] = {KEY_LUNAR_DATE};
+    const int32_t legacy_values[] = {1};
+    host_check(deliver_and_read_ack(legacy_keys, legacy_values, ARRAY_LENGTH(legacy_keys)) == -1, label,
+               "message without a version acknowledged");
+    host_check(s_app.lunar_date, label, "message without a version not applied");
+    quit();
+
+    // 版本隨設定保存
+    launch();
+    host_check(s_app.sync_version == 8, label, "version not kept across launches");
+    host_check(s_app.lunar_date, label, "settings not kept across launches");
+    quit();
+}
+
+// ==================== 只更新受影響的部分 ====================
+
+static void check_affected_only(void) {
+    const char *label = "affected only";
+    GSize size = host_screen_size();
+    host_persist_clear();
+    launch();
+
+    // 值未變動的差異：只更新版本
+    HostCounters before = host_counters;
+    const uint32_t same_keys[] = {KEY_POWER_SAVE_BATTERY, KEY_ANIMATION_ENABLED, KEY_SETTINGS_VERSION};
+    const int32_t same_values[] = {POWER_SAVE_BATTERY_DEFAULT, 1, 1};
+    deliver(same_keys, same_values, ARRAY_LENGTH(same_keys));
+    host_check(host_counters.layers_marked_dirty == before.layers_marked_dirty, label,
+               "unchanged values marked layers dirty");
+    host_check(host_counters.persist_writes - before.persist_writes == 1, label, "version not written once");
+
+    // 動畫開關只移動格子，不重畫整個畫面
+    before = host_counters;
+    const uint32_t anim_keys[] = {KEY_ANIMATION_ENABLED, KEY_SETTINGS_VERSION, KEY_SETTINGS_BASE};
+    const int32_t anim_values[] = {0, 2, 1};
+    deliver(anim_keys, anim_values, ARRAY_LENGTH(anim_keys));
+    host_check(host_counters.pixels_drawn - before.pixels_drawn < (uint64_t)size.w * size.h, label,
+               "animation toggle repainted the whole face");
+    host_check(host_counters.resource_bitmap_loads + host_counters.resource_raw_loads ==
+               before.resource_bitmap_loads + before.resource_raw_loads, label, "animation toggle loaded resources");
+
+    // 改色：與以該設定啟動時的畫面相同
+    const uint32_t theme_keys[] = {THEME_KEY, KEY_SETTINGS_VERSION, KEY_SETTINGS_BASE};
+    const int32_t theme_values[] = {THEME_VALUE, 3, 2};
+    deliver(theme_keys, theme_values, ARRAY_LENGTH(theme_keys));
+    uint32_t hash = framebuffer_hash();
+    quit();
+
+    launch();
+    host_check(framebuffer_hash() == hash, label, "face after a colour delta differs from launching with it");
+    quit();
+}
+
+// ==================== 畫面保存 ====================
+
+// 以竄改後的保存內容重新啟動，回傳是否還原
+static bool relaunch_with_snapshot(const GlyphSnapshot *snapshot) {
+    persist_write_data(KEY_GLYPH_SNAPSHOT, snapshot, sizeof(GlyphSnapshot));
+    launch();
+    bool restored = s_app.glyph_snapshot.version == GLYPH_SNAPSHOT_VERSION;
+    quit();
+    return restored;
+}
+
+static void check_snapshot(void) {
+    const char *label = "snapshot";
+    host_persist_clear();
+    launch();
+    quit();
+
+    GlyphSnapshot saved;
+    host_check(persist_read_data(KEY_GLYPH_SNAPSHOT, &saved, sizeof(saved)) == (int)sizeof(saved), label,
+               "snapshot not saved on exit");
+    host_check(relaunch_with_snapshot(&saved), label, "matching snapshot discarded");
+
+    GlyphSnapshot stale = saved;
+    stale.version++;
+    host_check(!relaunch_with_snapshot(&stale), label, "snapshot of another version restored");
+
+    stale = saved;
+    stale.glyph_count++;
+    host_check(!relaunch_with_snapshot(&stale), label, "snapshot of another glyph table restored");
+
+    stale = saved;
+    stale.theme_generation ^= 1;
+    host_check(!relaunch_with_snapshot(&stale), label, "snapshot of another theme restored");
+
+    // 執行中換色：離開時以新主題保存，下次啟動照常還原
+    persist_write_data(KEY_GLYPH_SNAPSHOT, &saved, sizeof(saved));
+    launch();
+    const uint32_t theme_keys[] = {THEME_KEY};
+    const int32_t theme_values[] = {THEME_VALUE};
+    deliver(theme_keys, theme_values, ARRAY_LENGTH(theme_keys));
+    quit();
+    GlyphSnapshot recoloured;
+    persist_read_data(KEY_GLYPH_SNAPSHOT, &recoloured, sizeof(recoloured));
+    host_check(recoloured.theme_generation != saved.theme_generation, label,
+               "snapshot not resaved after a colour change");
+    launch();
+    host_check(s_app.glyph_snapshot.version == GLYPH_SNAPSHOT_VERSION, label,
+               "snapshot after a colour change discarded");
+    quit();
+}
+
+int main(void) {
+    setenv("TZ", "UTC", 1);
+    tzset();
+
+    check_versions();
+    check_affected_only();
+    check_snapshot();
+    printf("settings: %d checks, %d failures\n", host_checks, host_failures);
+    return host_failures ? 1 : 0;
+}
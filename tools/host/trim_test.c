@@ -0,0 +1,180 @@
+// 墨跡裁切的逐像素比對
+//
+// 確認：
+//   GLYPH_INK_RECTS 恰為每張方形字形不透明像素的外接矩形，範圍外全為透明；
+//   每個格子逐一顯示可顯示的每張字形時，整個畫面與將未裁切的方形字形（glyph_squares.auto.h）
+//   套用主題色畫在格子左上角的結果逐像素相同，換字時舊字形的墨跡範圍清除乾淨。
+// 以 -DUSE_GRAPHICS_BLIT、-DUSE_BITMAP_LAYERS、-DUSE_RLE_GLYPHS 編譯時分別檢查
+// graphics_draw_bitmap_in_rect、BitmapLayer（日期列合成）與字形串流的擺放。
+//
+// 用法：trim_test（全部通過時回傳 0）
+#define main ccwatchface_main
+#include "../../src/c/ccwatchface.c"
+#undef main
+
+#include "host.h"
+#include "glyph_squares.auto.h"
+
+// 起點：2026-01-01 09:41:00 UTC
+#define START_EPOCH 1767260460
+
+static void launch(void) {
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(START_EPOCH);
+    host_set_rendering(true);
+    app_init();
+    host_run_until_idle();
+}
+
+static void quit(void) {
+    app_deinit();
+    host_set_rendering(false);
+}
+
+// 整張方形字形解碼到 slots（寬 x 高 個語意色插槽索引）
+static bool square_decode(GlyphId glyph, uint8_t *slots) {
+    int pixels = HOST_GLYPH_SQUARES[glyph].width * HOST_GLYPH_SQUARES[glyph].height;
+    const uint8_t *data = HOST_GLYPH_SQUARE_DATA + HOST_GLYPH_SQUARES[glyph].offset;
+    int n = 0;
+    for (int i = 0; i < HOST_GLYPH_SQUARES[glyph].size; i++) {
+        int run = (data[i] & HOST_GLYPH_SQUARE_LENGTH_MASK) + 1;
+        if (n + run > pixels) return false;
+        memset(slots + n, data[i] >> HOST_GLYPH_SQUARE_SLOT_SHIFT, run);
+        n += run;
+    }
+    return n == pixels;
+}
+
+static bool is_date_glyph(GlyphId glyph) {
+    return glyph >= GLYPH_SU1;
+}
+
+// 格子只顯示同類的字形（Aplite 的時、分、日期字形各為不同的槽位格式）：時為 U*，分為點、整、半與 L*
+static bool glyph_fits_cell(GlyphId glyph, const DisplayLayer *dl) {
+    switch (dl->type) {
+        case LAYER_TYPE_HOUR:          return glyph < GLYPH_DIAN;
+        case LAYER_TYPE_MINUTE_ACCENT:
+        case LAYER_TYPE_MINUTE_NORMAL: return glyph >= GLYPH_DIAN && !is_date_glyph(glyph);
+        default:                       return is_date_glyph(glyph);
+    }
+}
+
+// 方形字形放大到格子尺寸的倍數（Emery 的日期字形為 2；底稿縮小的 --scale-time 建置仍以畫面尺寸比較）
+static int square_scale(GlyphId glyph) {
+    GSize cell = layout_cell_size(is_date_glyph(glyph) ? LAYER_TYPE_DATE : LAYER_TYPE_HOUR);
+    return cell.w / HOST_GLYPH_SQUARES[glyph].width;
+}
+
+static void show(DisplayLayer *dl, GlyphId glyph) {
+    display_layer_load_glyph(dl, glyph);
+    dl->current_glyph = glyph;
+    host_render_pending();
+}
+
+// ==================== 墨跡範圍 ====================
+
+static void check_ink_rects(void) {
+    const char *label = "ink rects";
+    bool ok = true;
+    uint8_t slots[88 * 88];
+    for (int g = GLYPH_NONE + 1; g < GLYPH_COUNT; g++) {
+        int w = HOST_GLYPH_SQUARES[g].width;
+        int h = HOST_GLYPH_SQUARES[g].height;
+        int scale = square_scale((GlyphId)g);
+        GRect ink = glyph_ink_rect((GlyphId)g, is_date_glyph((GlyphId)g) ? LAYER_TYPE_DATE : LAYER_TYPE_HOUR);
+        if (!square_decode((GlyphId)g, slots)) {
+            ok = false;
+            continue;
+        }
+        int x0 = w, y0 = h, x1 = 0, y1 = 0;
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                if (!slots[y * w + x]) continue;
+                x0 = MIN(x0, x);
+                y0 = MIN(y0, y);
+                x1 = MAX(x1, x + 1);
+                y1 = MAX(y1, y + 1);
+            }
+        }
+        ok &= x1 > x0 && ink.origin.x == x0 * scale && ink.origin.y == y0 * scale &&
+              ink.size.w == (x1 - x0) * scale && ink.size.h == (y1 - y0) * scale;
+    }
+    host_check(ok, label, "ink rect is not the bounding box of the opaque pixels");
+}
+
+// ==================== 畫面比對 ====================
+
+// 畫面是否為背景色加上 dl 格子左上角的方形字形
+static bool screen_matches(const DisplayLayer *dl, GlyphId glyph) {
+    static const GColor slot_colors[4] = {
+        GColorClear, GColorBlack, GColorWhite, PBL_IF_COLOR_ELSE(GColorRed, GColorClear),
+    };
+    GColor palette[4];
+    theme_map_palette(&s_app.theme, slot_colors, palette, 4, dl->type);
+
+    uint8_t slots[88 * 88];
+    if (!square_decode(glyph, slots)) return false;
+    int w = HOST_GLYPH_SQUARES[glyph].width;
+    int scale = square_scale(glyph);
+    GRect cell = dl->base_frame;
+    GSize size = host_screen_size();
+    const GColor8 *pixels = host_framebuffer();
+    for (int y = 0; y < size.h; y++) {
+        for (int x = 0; x < size.w; x++) {
+            GColor expected = s_app.theme.background;
+            int gx = x - cell.origin.x;
+            int gy = y - cell.origin.y;
+            if (gx >= 0 && gy >= 0 && gx < cell.size.w && gy < cell.size.h) {
+                GColor color = palette[slots[gy / scale * w + gx / scale]];
+                if (color.a) expected = color;
+            }
+            if ((pixels[y * size.w + x].argb | 0xC0) != (expected.argb | 0xC0)) return false;
+        }
+    }
+    return true;
+}
+
+static void check_cells(void) {
+    launch();
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        show(ALL_DISPLAY_LAYERS[i], GLYPH_NONE);
+    }
+
+    char label[32];
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        DisplayLayer *dl = ALL_DISPLAY_LAYERS[i];
+        GlyphId failed = GLYPH_NONE;
+        for (int g = GLYPH_NONE + 1; g < GLYPH_COUNT; g++) {
+            if (!glyph_fits_cell((GlyphId)g, dl)) continue;
+            show(dl, (GlyphId)g);
+            if (failed == GLYPH_NONE && !screen_matches(dl, (GlyphId)g)) failed = (GlyphId)g;
+        }
+        show(dl, GLYPH_NONE);
+        snprintf(label, sizeof(label), "cell %d", (int)i);
+        char what[48];
+        snprintf(what, sizeof(what), "glyph %d differs from the untrimmed square", (int)failed);
+        host_check(failed == GLYPH_NONE, label, what);
+    }
+    quit();
+}
+
+int main(void) {
+    setenv("TZ", "UTC", 1);
+    tzset();
+
+    check_ink_rects();
+    check_cells();
+
+    int ink = 0, square = 0;
+    for (int g = GLYPH_NONE + 1; g < GLYPH_COUNT; g++) {
+        GRect rect = glyph_ink_rect((GlyphId)g, is_date_glyph((GlyphId)g) ? LAYER_TYPE_DATE : LAYER_TYPE_HOUR);
+        int scale = square_scale((GlyphId)g);
+        ink += rect.size.w * rect.size.h;
+        square += HOST_GLYPH_SQUARES[g].width * HOST_GLYPH_SQUARES[g].height * scale * scale;
+    }
+    printf("trim: %d checks, %d failures (ink %d%% of the glyph squares)\n", host_checks, host_failures,
+           ink * 100 / square);
+    return host_failures ? 1 : 0;
+}
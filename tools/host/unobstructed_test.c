@@ -0,0 +1,244 @@
+// 未遮蔽區域的版面重排檢查
+//
+// 以 Timeline Quick View 的遮蔽高度與只遮住日期列下方空白的小遮蔽，確認：
+//   換圖動畫進行中遮蔽物進出，不增加資源載入與堆積配置、動畫影格數不變，結束後與未遮蔽時的畫面相同；
+//   放不下時日期列隱藏（畫面上只剩背景色），時間格子不動；放得下時日期列隨可見區域底部上移；
+//   啟動時已有遮蔽，日期列一開始就隱藏，遮蔽物離開後畫面與一般啟動相同；
+//   通知等視窗覆蓋錶盤時換分鐘不畫任何像素（BitmapLayer 模式隱藏格子群組），重新取得焦點後畫面與未被覆蓋時相同。
+// 以 -DUSE_BITMAP_LAYERS 編譯時檢查 BitmapLayer 模式（日期列合成）。Aplite 沒有未遮蔽區域，直接通過。
+//
+// 用法：unobstructed_test（全部通過時回傳 0）
+#define main ccwatchface_main
+#include "../../src/c/ccwatchface.c"
+#undef main
+
+#include "host.h"
+
+// 起點：2026-01-01 23:59 UTC，下一分鐘時間與日期列一起換字
+#define START_EPOCH 1767311940
+// Timeline Quick View 遮蔽的高度
+#define PEEK_HEIGHT 51
+// 只遮住日期列下方空白的小遮蔽
+#define SMALL_OBSTRUCTION 5
+
+#if defined(USE_UNOBSTRUCTED_AREA)
+static uint32_t framebuffer_hash(void) {
+    GSize size = host_screen_size();
+    const uint8_t *pixels = (const uint8_t *)host_framebuffer();
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < size.w * size.h; i++) {
+        hash = (hash ^ pixels[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static void launch(time_t now) {
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(now);
+    host_set_rendering(true);
+    app_init();
+    host_run_until_idle();
+}
+
+static void quit(void) {
+    app_deinit();
+    host_set_rendering(false);
+}
+
+static void next_minute(void) {
+    host_advance_ms(60 * 1000);
+    host_tick(MINUTE_UNIT | HOUR_UNIT | DAY_UNIT | MONTH_UNIT | YEAR_UNIT);
+}
+
+// 日期列於完整版面的範圍（含格子間的空白）
+static GRect date_row_rect(void) {
+    GRect rect = GRectZero;
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        if (CELL_LAYOUT[i].anchor != LAYOUT_ANCHOR_BOTTOM) continue;
+        GRect cell = (GRect){.origin = CELL_LAYOUT[i].origin, .size = layout_cell_size(CELL_LAYOUT[i].type)};
+        if (grect_is_empty(&rect)) {
+            rect = cell;
+            continue;
+        }
+        int16_t x1 = MAX(rect.origin.x + rect.size.w, cell.origin.x + cell.size.w);
+        rect.origin.x = MIN(rect.origin.x, cell.origin.x);
+        rect.size.w = x1 - rect.origin.x;
+    }
+    return rect;
+}
+
+// 畫面上 rect 範圍的像素與 reference（同尺寸的完整畫面）上移 dy 列後的內容相同
+static bool region_matches(const GColor8 *reference, GRect rect, int dy) {
+    GSize size = host_screen_size();
+    const GColor8 *pixels = host_framebuffer();
+    for (int y = rect.origin.y; y < rect.origin.y + rect.size.h; y++) {
+        for (int x = rect.origin.x; x < rect.origin.x + rect.size.w; x++) {
+            if (pixels[(y - dy) * size.w + x].argb != reference[y * size.w + x].argb) return false;
+        }
+    }
+    return true;
+}
+
+static bool region_is_background(GRect rect) {
+    GSize size = host_screen_size();
+    const GColor8 *pixels = host_framebuffer();
+    GColor8 background = s_app.theme.background;
+    background.a = 3;
+    for (int y = rect.origin.y; y < rect.origin.y + rect.size.h; y++) {
+        for (int x = rect.origin.x; x < rect.origin.x + rect.size.w; x++) {
+            if (pixels[y * size.w + x].argb != background.argb) return false;
+        }
+    }
+    return true;
+}
+
+static bool time_cells_in_place(void) {
+    for (size_t i = 0; i < DISPLAY_LAYER_COUNT; i++) {
+        if (CELL_LAYOUT[i].anchor != LAYOUT_ANCHOR_TOP) continue;
+        if (!gpoint_equal(&ALL_DISPLAY_LAYERS[i]->base_frame.origin, &CELL_LAYOUT[i].origin)) return false;
+    }
+    return true;
+}
+
+// ==================== 換圖動畫中遮蔽 ====================
+
+static void check_peek_during_minute_change(void) {
+    const char *label = "peek during minute change";
+    int16_t screen_h = host_screen_size().h;
+
+    // 基準：同一分鐘換字，沒有遮蔽
+    launch(START_EPOCH);
+    HostCounters before = host_counters;
+    next_minute();
+    host_run_until_idle();
+    uint64_t ref_loads = host_counters.resource_bitmap_loads + host_counters.resource_raw_loads -
+                         before.resource_bitmap_loads - before.resource_raw_loads;
+    uint64_t ref_allocs = host_counters.heap_allocs - before.heap_allocs;
+    uint64_t ref_frames = host_counters.animation_frames - before.animation_frames;
+    uint32_t ref_hash = framebuffer_hash();
+    quit();
+
+    // 換圖動畫播放到一半時遮蔽物進入，動畫結束後離開
+    launch(START_EPOCH);
+    before = host_counters;
+    next_minute();
+    host_advance_ms(HOST_FRAME_MS * 2);
+    host_set_unobstructed_height(screen_h - PEEK_HEIGHT);
+    host_check(s_app.layout.bottom_hidden, label, "date row not hidden when the peek starts");
+    host_run_until_idle();
+
+    host_check(region_is_background(date_row_rect()), label, "date row still drawn under the peek");
+    host_check(time_cells_in_place(), label, "time cells moved");
+
+    host_set_unobstructed_height(screen_h);
+    host_run_until_idle();
+    host_check(!s_app.layout.bottom_hidden, label, "date row still hidden after the peek");
+
+    uint64_t loads = host_counters.resource_bitmap_loads + host_counters.resource_raw_loads -
+                     before.resource_bitmap_loads - before.resource_raw_loads;
+    host_check(loads == ref_loads, label, "extra resource loads");
+    host_check(host_counters.heap_allocs - before.heap_allocs == ref_allocs, label, "extra heap allocations");
+    host_check(host_counters.animation_frames - before.animation_frames == ref_frames, label,
+               "animation frames changed");
+    host_check(host_invalid_animation_calls() == 0, label, "calls on freed animations");
+    host_check(framebuffer_hash() == ref_hash, label, "face differs from an unobstructed minute change");
+    quit();
+}
+
+// ==================== 小遮蔽 ====================
+
+static void check_small_obstruction(void) {
+    const char *label = "small obstruction";
+    GSize size = host_screen_size();
+
+    launch(START_EPOCH);
+    GColor8 *reference = malloc(sizeof(GColor8) * size.w * size.h);
+    memcpy(reference, host_framebuffer(), sizeof(GColor8) * size.w * size.h);
+    uint32_t ref_hash = framebuffer_hash();
+    HostCounters before = host_counters;
+
+    host_set_unobstructed_height(size.h - SMALL_OBSTRUCTION);
+    host_run_until_idle();
+    host_check(!s_app.layout.bottom_hidden && s_app.layout.bottom_shift == SMALL_OBSTRUCTION, label,
+               "date row not shifted by the obstruction");
+    host_check(region_matches(reference, date_row_rect(), SMALL_OBSTRUCTION), label, "date row not drawn shifted up");
+    host_check(time_cells_in_place(), label, "time cells moved");
+
+    host_set_unobstructed_height(size.h);
+    host_run_until_idle();
+    host_check(framebuffer_hash() == ref_hash, label, "face differs after the obstruction left");
+    host_check(host_counters.heap_allocs == before.heap_allocs, label, "heap allocations while reflowing");
+    host_check(host_counters.resource_bitmap_loads + host_counters.resource_raw_loads ==
+               before.resource_bitmap_loads + before.resource_raw_loads, label, "resource loads while reflowing");
+    free(reference);
+    quit();
+}
+
+// ==================== 啟動時已遮蔽 ====================
+
+static void check_launch_obstructed(void) {
+    const char *label = "launch obstructed";
+    int16_t screen_h = host_screen_size().h;
+
+    launch(START_EPOCH);
+    uint32_t ref_hash = framebuffer_hash();
+    quit();
+
+    host_persist_clear();
+    host_reset();
+    host_set_24h_style(true);
+    host_set_time(START_EPOCH);
+    host_set_unobstructed_height(screen_h - PEEK_HEIGHT);
+    host_run_until_idle();
+    host_set_rendering(true);
+    app_init();
+    host_run_until_idle();
+    host_check(s_app.layout.bottom_hidden, label, "date row not hidden at launch");
+    host_check(region_is_background(date_row_rect()), label, "date row drawn at launch");
+
+    host_set_unobstructed_height(screen_h);
+    host_run_until_idle();
+    host_check(framebuffer_hash() == ref_hash, label, "face differs from an unobstructed launch");
+    quit();
+}
+
+// ==================== 錶盤被覆蓋 ====================
+
+static void check_obscured_minute_change(void) {
+    const char *label = "obscured minute change";
+
+    launch(START_EPOCH);
+    next_minute();
+    host_run_until_idle();
+    uint32_t ref_hash = framebuffer_hash();
+    quit();
+
+    launch(START_EPOCH);
+    host_set_focus(false);
+    uint64_t pixels = host_counters.pixels_drawn;
+    next_minute();
+    host_run_until_idle();
+    host_check(host_counters.pixels_drawn == pixels, label, "cells redrawn while obscured");
+    host_check(s_app.power.tick_deferred, label, "deferred redraw not counted");
+
+    host_set_focus(true);
+    host_run_until_idle();
+    host_check(framebuffer_hash() == ref_hash, label, "face differs after regaining focus");
+    quit();
+}
+#endif
+
+int main(void) {
+#if defined(USE_UNOBSTRUCTED_AREA)
+    check_peek_during_minute_change();
+    check_small_obstruction();
+    check_launch_obstructed();
+    check_obscured_minute_change();
+    printf("unobstructed: %d checks, %d failures\n", host_checks, host_failures);
+#else
+    printf("unobstructed: not supported on this platform\n");
+#endif
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,152 @@
+"""
+極簡 PNG 讀寫工具（僅依賴標準函式庫）。
+
+供 tools/ 底下的資源處理腳本與主機端測試框架共用，
+讀取時統一轉為 RGBA 像素列，寫入時支援 RGBA 與調色盤（indexed）兩種格式。
+"""
+
+import struct
+import zlib
+
+PNG_SIGNATURE = b'\x89PNG\r\n\x1a\n'
+
+
+def _paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def _unfilter(raw, width_bytes, height, bpp):
+    rows = []
+    prev = bytearray(width_bytes)
+    pos = 0
+    for _ in range(height):
+        ftype = raw[pos]
+        pos += 1
+        line = bytearray(raw[pos:pos + width_bytes])
+        pos += width_bytes
+        for x in range(width_bytes):
+            a = line[x - bpp] if x >= bpp else 0
+            b = prev[x]
+            c = prev[x - bpp] if x >= bpp else 0
+            if ftype == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif ftype == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif ftype == 3:
+                line[x] = (line[x] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                line[x] = (line[x] + _paeth(a, b, c)) & 0xFF
+        rows.append(line)
+        prev = line
+    return rows
+
+
+def read_png(path):
+    """讀取 PNG，回傳 (width, height, rows)，rows 為每列 [(r, g, b, a), ...]。"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != PNG_SIGNATURE:
+        raise ValueError('%s: not a PNG file' % path)
+
+    pos = 8
+    idat = b''
+    palette = []
+    trns = b''
+    width = height = bit_depth = color_type = None
+    while pos < len(data):
+        length, = struct.unpack('>I', data[pos:pos + 4])
+        ctype = data[pos + 4:pos + 8]
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b'IHDR':
+            width, height, bit_depth, color_type, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+            if interlace:
+                raise ValueError('%s: interlaced PNG is not supported' % path)
+        elif ctype == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif ctype == b'tRNS':
+            trns = chunk
+        elif ctype == b'IDAT':
+            idat += chunk
+        elif ctype == b'IEND':
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    if color_type != 3 and bit_depth != 8:
+        raise ValueError('%s: only 8-bit non-indexed PNG is supported' % path)
+
+    bits_per_pixel = channels * bit_depth
+    width_bytes = (width * bits_per_pixel + 7) // 8
+    raw = zlib.decompress(idat)
+    rows = _unfilter(raw, width_bytes, height, max(1, bits_per_pixel // 8))
+
+    out = []
+    for line in rows:
+        pixels = []
+        for x in range(width):
+            if color_type == 6:
+                pixels.append(tuple(line[4 * x:4 * x + 4]))
+            elif color_type == 2:
+                pixels.append(tuple(line[3 * x:3 * x + 3]) + (255,))
+            elif color_type == 0:
+                pixels.append((line[x], line[x], line[x], 255))
+            elif color_type == 4:
+                pixels.append((line[2 * x], line[2 * x], line[2 * x], line[2 * x + 1]))
+            else:
+                bit = x * bit_depth
+                shift = 8 - bit_depth - (bit % 8)
+                index = (line[bit // 8] >> shift) & ((1 << bit_depth) - 1)
+                alpha = trns[index] if index < len(trns) else 255
+                pixels.append(palette[index] + (alpha,))
+        out.append(pixels)
+    return width, height, out
+
+
+def _chunk(ctype, payload):
+    crc = zlib.crc32(ctype + payload) & 0xFFFFFFFF
+    return struct.pack('>I', len(payload)) + ctype + payload + struct.pack('>I', crc)
+
+
+def _encode(width, height, bit_depth, color_type, raw_rows, extra_chunks=()):
+    raw = b''.join(b'\x00' + bytes(r) for r in raw_rows)
+    ihdr = struct.pack('>IIBBBBB', width, height, bit_depth, color_type, 0, 0, 0)
+    out = PNG_SIGNATURE + _chunk(b'IHDR', ihdr)
+    for ctype, payload in extra_chunks:
+        out += _chunk(ctype, payload)
+    out += _chunk(b'IDAT', zlib.compress(raw, 9)) + _chunk(b'IEND', b'')
+    return out
+
+
+def write_png_rgba(path, width, height, rows):
+    """以 8-bit RGBA 格式寫出 PNG。"""
+    raw_rows = [bytes(c for px in row for c in px) for row in rows]
+    with open(path, 'wb') as f:
+        f.write(_encode(width, height, 8, 6, raw_rows))
+
+
+def write_png_indexed(path, width, height, indices, palette):
+    """
+    以調色盤格式寫出 PNG。indices 為每列的調色盤索引，palette 為 [(r, g, b, a), ...]。
+    位元深度依調色盤大小自動選擇 1/2/4/8 bit。
+    """
+    count = len(palette)
+    bit_depth = 1 if count <= 2 else 2 if count <= 4 else 4 if count <= 16 else 8
+    raw_rows = []
+    for row in indices:
+        line = bytearray((width * bit_depth + 7) // 8)
+        for x, index in enumerate(row):
+            bit = x * bit_depth
+            line[bit // 8] |= index << (8 - bit_depth - (bit % 8))
+        raw_rows.append(line)
+
+    plte = bytes(c for rgba in palette for c in rgba[:3])
+    trns = bytes(rgba[3] for rgba in palette)
+    chunks = [(b'PLTE', plte)]
+    if any(a != 255 for a in trns):
+        chunks.append((b'tRNS', trns.rstrip(b'\xff')))
+    with open(path, 'wb') as f:
+        f.write(_encode(width, height, bit_depth, 3, raw_rows, chunks))